@@ -0,0 +1,140 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "context/ColumnBatch.h"
+
+namespace nebula {
+namespace graph {
+
+Column::Column(Type type, size_t size) : type_(type), valid_(size, 0) {
+    switch (type_) {
+        case Type::kInt:
+            ints_.resize(size);
+            break;
+        case Type::kFloat:
+            floats_.resize(size);
+            break;
+        case Type::kBool:
+            bools_.resize(size);
+            break;
+        case Type::kString:
+            strs_.resize(size);
+            break;
+    }
+}
+
+// static
+Column Column::constant(const Value& val, size_t size) {
+    Type type;
+    if (!typeOf(val, &type)) {
+        // All rows are invalid
+        return Column(Type::kInt, size);
+    }
+    Column column(type, size);
+    for (size_t i = 0; i < size; ++i) {
+        column.set(i, val);
+    }
+    return column;
+}
+
+// static
+bool Column::typeOf(const Value& val, Type* type) {
+    switch (val.type()) {
+        case Value::Type::INT:
+            *type = Type::kInt;
+            return true;
+        case Value::Type::FLOAT:
+            *type = Type::kFloat;
+            return true;
+        case Value::Type::BOOL:
+            *type = Type::kBool;
+            return true;
+        case Value::Type::STRING:
+            *type = Type::kString;
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool Column::allValid() const {
+    return std::all_of(valid_.begin(), valid_.end(), [](uint8_t v) { return v != 0; });
+}
+
+void Column::set(size_t i, const Value& val) {
+    switch (type_) {
+        case Type::kInt:
+            valid_[i] = val.isInt();
+            if (valid_[i]) {
+                ints_[i] = val.getInt();
+            }
+            break;
+        case Type::kFloat:
+            valid_[i] = val.isFloat();
+            if (valid_[i]) {
+                floats_[i] = val.getFloat();
+            }
+            break;
+        case Type::kBool:
+            valid_[i] = val.isBool();
+            if (valid_[i]) {
+                bools_[i] = val.getBool();
+            }
+            break;
+        case Type::kString:
+            valid_[i] = val.isStr();
+            if (valid_[i]) {
+                strs_[i] = &val.getStr();
+            }
+            break;
+    }
+}
+
+Value Column::value(size_t i) const {
+    DCHECK(isValid(i));
+    switch (type_) {
+        case Type::kInt:
+            return Value(ints_[i]);
+        case Type::kFloat:
+            return Value(floats_[i]);
+        case Type::kBool:
+            return Value(bools_[i] != 0);
+        case Type::kString:
+            return Value(*strs_[i]);
+    }
+    return Value::kEmpty;
+}
+
+std::shared_ptr<const Column> ColumnBatch::column(const std::string& name) {
+    auto found = columns_.find(name);
+    if (found != columns_.end()) {
+        return found->second;
+    }
+
+    std::shared_ptr<Column> column;
+    size_t i = 0;
+    for (iter_->reset(); iter_->valid(); iter_->next(), ++i) {
+        const auto& val = iter_->getColumn(name);
+        if (column == nullptr) {
+            Column::Type type;
+            if (val.isNull() || val.empty()) {
+                continue;
+            }
+            if (!Column::typeOf(val, &type)) {
+                break;
+            }
+            column = std::make_shared<Column>(type, size_);
+        }
+        column->set(i, val);
+    }
+    iter_->reset();
+
+    columns_.emplace(name, column);
+    return column;
+}
+
+}   // namespace graph
+}   // namespace nebula
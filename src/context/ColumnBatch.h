@@ -0,0 +1,131 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef CONTEXT_COLUMNBATCH_H_
+#define CONTEXT_COLUMNBATCH_H_
+
+#include "common/datatypes/Value.h"
+
+#include "context/Iterator.h"
+
+namespace nebula {
+namespace graph {
+
+// A column of values in the typed layout. The int, float, bool and string values are kept in
+// the contiguous vectors so that they could be evaluated in the tight loops, and a bitmap
+// tells which rows hold the value of the column type. The other rows, e.g. the null values,
+// are left to be evaluated row by row.
+class Column final {
+public:
+    enum class Type : uint8_t {
+        kInt,
+        kFloat,
+        kBool,
+        kString,
+    };
+
+    Column(Type type, size_t size);
+
+    // Same value in all rows
+    static Column constant(const Value& val, size_t size);
+
+    Type type() const {
+        return type_;
+    }
+
+    size_t size() const {
+        return valid_.size();
+    }
+
+    bool isValid(size_t i) const {
+        return valid_[i] != 0;
+    }
+
+    bool allValid() const;
+
+    // Materialize the value of the valid row
+    Value value(size_t i) const;
+
+    std::vector<uint8_t>& valid() {
+        return valid_;
+    }
+
+    const std::vector<uint8_t>& valid() const {
+        return valid_;
+    }
+
+    std::vector<int64_t>& ints() {
+        return ints_;
+    }
+
+    const std::vector<int64_t>& ints() const {
+        return ints_;
+    }
+
+    std::vector<double>& floats() {
+        return floats_;
+    }
+
+    const std::vector<double>& floats() const {
+        return floats_;
+    }
+
+    // The bool values are kept in bytes rather than bits to be vectorizable
+    std::vector<uint8_t>& bools() {
+        return bools_;
+    }
+
+    const std::vector<uint8_t>& bools() const {
+        return bools_;
+    }
+
+    // The strings are referred to the values of the input, not copied
+    std::vector<const std::string*>& strs() {
+        return strs_;
+    }
+
+    const std::vector<const std::string*>& strs() const {
+        return strs_;
+    }
+
+    // Set the value of the row if it's of the column type, or else mark the row invalid
+    void set(size_t i, const Value& val);
+
+    static bool typeOf(const Value& val, Type* type);
+
+private:
+    Type                                type_;
+    std::vector<uint8_t>                valid_;
+    std::vector<int64_t>                ints_;
+    std::vector<double>                 floats_;
+    std::vector<uint8_t>                bools_;
+    std::vector<const std::string*>     strs_;
+};
+
+// The columns of the rows of an iterator, the column is loaded on its first access.
+// The iterator and its values must outlive the batch.
+class ColumnBatch final {
+public:
+    explicit ColumnBatch(Iterator* iter) : iter_(iter), size_(iter->size()) {}
+
+    size_t size() const {
+        return size_;
+    }
+
+    // The column typed by its first non-null value, nullptr if there is no such value or it's
+    // none of the int, float, bool or string.
+    std::shared_ptr<const Column> column(const std::string& name);
+
+private:
+    Iterator*                                                       iter_;
+    size_t                                                          size_;
+    std::unordered_map<std::string, std::shared_ptr<const Column>>  columns_;
+};
+
+}   // namespace graph
+}   // namespace nebula
+
+#endif   // CONTEXT_COLUMNBATCH_H_
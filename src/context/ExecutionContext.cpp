@@ -21,10 +21,18 @@ void ExecutionContext::setValue(const std::string& name, Value&& val) {
 void ExecutionContext::setResult(const std::string& name, Result&& result) {
     auto& hist = valueMap_[name];
     hist.emplace_back(std::move(result));
+    charge(hist.back());
 }
 
 void ExecutionContext::deleteValue(const std::string& name) {
-    valueMap_.erase(name);
+    auto it = valueMap_.find(name);
+    if (it == valueMap_.end()) {
+        return;
+    }
+    for (const auto& result : it->second) {
+        discharge(result);
+    }
+    valueMap_.erase(it);
 }
 
 size_t ExecutionContext::numVersions(const std::string& name) const {
@@ -41,7 +49,11 @@ void ExecutionContext::truncHistory(const std::string& name, size_t numVersionsT
             return;
         }
         // Only keep the latest N values
-        it->second.erase(it->second.begin(), it->second.end() - numVersionsToKeep);
+        auto end = it->second.end() - numVersionsToKeep;
+        for (auto result = it->second.begin(); result != end; ++result) {
+            discharge(*result);
+        }
+        it->second.erase(it->second.begin(), end);
     }
 }
 
@@ -53,7 +65,16 @@ const Value& ExecutionContext::getValue(const std::string& name) const {
 Value ExecutionContext::moveValue(const std::string& name) {
     auto it = valueMap_.find(name);
     if (it != valueMap_.end() && !it->second.empty()) {
-        return it->second.back().moveValue();
+        auto& result = it->second.back();
+        if (memTracker_ != nullptr) {
+            // The value is moved out of all the results sharing it
+            auto found = charged_.find(result.valuePtr().get());
+            if (found != charged_.end()) {
+                memTracker_->release(found->second.first);
+                charged_.erase(found);
+            }
+        }
+        return result.moveValue();
     } else {
         return Value();
     }
@@ -87,5 +108,52 @@ const std::vector<Result>& ExecutionContext::getHistory(const std::string& name)
     }
 }
 
+void ExecutionContext::charge(const Result& result) {
+    if (memTracker_ == nullptr) {
+        return;
+    }
+    auto value = result.valuePtr();
+    if (value == nullptr) {
+        // The joined results refer to the rows of their inputs, which are charged already
+        return;
+    }
+    auto& charged = charged_[value.get()];
+    if (charged.second++ == 0) {
+        charged.first = MemoryTracker::estimate(*value);
+        memTracker_->consume(charged.first);
+    }
+}
+
+void ExecutionContext::discharge(const Result& result) {
+    if (memTracker_ == nullptr) {
+        return;
+    }
+    auto found = charged_.find(result.valuePtr().get());
+    if (found == charged_.end()) {
+        return;
+    }
+    if (--found->second.second == 0) {
+        memTracker_->release(found->second.first);
+        charged_.erase(found);
+    }
+}
+
+std::unique_ptr<ExecutionContext> ExecutionContext::copy() const {
+    auto ectx = std::make_unique<ExecutionContext>();
+    for (const auto& pair : valueMap_) {
+        auto& hist = ectx->valueMap_[pair.first];
+        hist.reserve(pair.second.size());
+        for (const auto& result : pair.second) {
+            // The iterators may erase the rows of the value in place, so copy the value
+            hist.emplace_back(ResultBuilder()
+                                  .value(Value(result.value()))
+                                  .iter(result.iter()->kind())
+                                  .state(result.state())
+                                  .finish());
+        }
+    }
+    return ectx;
+}
+
 }   // namespace graph
 }   // namespace nebula
@@ -9,6 +9,7 @@
 
 #include "common/base/Base.h"
 #include "common/datatypes/Value.h"
+#include "context/MemoryTracker.h"
 #include "context/Result.h"
 
 namespace nebula {
@@ -71,12 +72,29 @@ public:
         return valueMap_.find(name) != valueMap_.end();
     }
 
+    // Charge the memory of the results to the tracker
+    void setMemoryTracker(MemoryTracker* memTracker) {
+        memTracker_ = memTracker;
+    }
+
+    // A deep copy of all versions of the values, e.g. to keep the inputs prepared by
+    // the validators for the next execution of the same plan
+    std::unique_ptr<ExecutionContext> copy() const;
+
 private:
     friend class QueryInstance;
     Value moveValue(const std::string& name);
 
+    // The values shared by several results are charged once
+    void charge(const Result& result);
+    void discharge(const Result& result);
+
     // name -> Value with multiple versions
     std::unordered_map<std::string, std::vector<Result>>     valueMap_;
+
+    MemoryTracker*                                           memTracker_{nullptr};
+    // value -> {bytes, number of the results}
+    std::unordered_map<const Value*, std::pair<int64_t, size_t>>    charged_;
 };
 
 }  // namespace graph
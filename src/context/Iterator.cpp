@@ -46,8 +46,9 @@ bool equal_to<const nebula::graph::LogicalRow*>::operator()(
 
 namespace nebula {
 namespace graph {
-GetNeighborsIter::GetNeighborsIter(std::shared_ptr<Value> value)
-    : Iterator(value, Kind::kGetNeighbors) {
+GetNeighborsIter::GetNeighborsIter(std::shared_ptr<Value> value,
+                                   std::shared_ptr<const ColumnLayout> layout)
+    : Iterator(value, Kind::kGetNeighbors), layout_(std::move(layout)) {
     auto status = processList(value);
     if (UNLIKELY(!status.ok())) {
         LOG(ERROR) << status;
@@ -79,28 +80,31 @@ Status GetNeighborsIter::processList(std::shared_ptr<Value> value) {
 
 StatusOr<GetNeighborsIter::DataSetIndex> GetNeighborsIter::makeDataSetIndex(const DataSet& ds,
                                                                             size_t idx) {
+    if (layout_ == nullptr || layout_->colNames != ds.colNames) {
+        auto layout = makeColumnLayout(ds.colNames);
+        NG_RETURN_IF_ERROR(layout);
+        layout_ = std::move(layout).value();
+    }
     DataSetIndex dsIndex;
     dsIndex.ds = &ds;
-    auto buildResult = buildIndex(&dsIndex);
-    NG_RETURN_IF_ERROR(buildResult);
-    int64_t edgeStartIndex = std::move(buildResult).value();
-    if (edgeStartIndex < 0) {
+    dsIndex.layout = layout_;
+    if (layout_->edgeStartIndex < 0) {
         for (auto& row : dsIndex.ds->rows) {
-            logicalRows_.emplace_back(idx, &row, "", nullptr);
+            logicalRows_.emplace_back(idx, &row, nullptr, nullptr);
         }
     } else {
-        makeLogicalRowByEdge(edgeStartIndex, idx, dsIndex);
+        makeLogicalRowByEdge(idx, dsIndex);
     }
     return dsIndex;
 }
 
-void GetNeighborsIter::makeLogicalRowByEdge(int64_t edgeStartIndex,
-                                            size_t idx,
-                                            const DataSetIndex& dsIndex) {
+void GetNeighborsIter::makeLogicalRowByEdge(size_t idx, const DataSetIndex& dsIndex) {
+    const auto& edgeOfColumns = dsIndex.layout->edgeOfColumns;
     for (auto& row : dsIndex.ds->rows) {
         auto& cols = row.values;
         bool existEdge = false;
-        for (size_t column = edgeStartIndex; column < cols.size() - 1; ++column) {
+        auto numCols = std::min(cols.size(), edgeOfColumns.size());
+        for (size_t column = dsIndex.layout->edgeStartIndex; column + 1 < numCols; ++column) {
             if (!cols[column].isList()) {
                 // Ignore the bad value.
                 continue;
@@ -111,14 +115,13 @@ void GetNeighborsIter::makeLogicalRowByEdge(int64_t edgeStartIndex,
                     continue;
                 }
                 existEdge = true;
-                auto edgeName = dsIndex.tagEdgeNameIndices.find(column);
-                DCHECK(edgeName != dsIndex.tagEdgeNameIndices.end());
-                logicalRows_.emplace_back(
-                    idx, &row, edgeName->second, &edge.getList());
+                auto* edgeOfColumn = edgeOfColumns[column];
+                DCHECK(edgeOfColumn != nullptr);
+                logicalRows_.emplace_back(idx, &row, edgeOfColumn, &edge.getList());
             }
         }
         if (!existEdge) {
-            noEdgeRows_.emplace_back(idx, &row, "", nullptr);
+            noEdgeRows_.emplace_back(idx, &row, nullptr, nullptr);
         }
     }
 }
@@ -128,34 +131,45 @@ bool checkColumnNames(const std::vector<std::string>& colNames) {
            colNames.back().find("_expr") != 0;
 }
 
-StatusOr<int64_t> GetNeighborsIter::buildIndex(DataSetIndex* dsIndex) {
-    auto& colNames = dsIndex->ds->colNames;
+// static
+StatusOr<std::shared_ptr<const GetNeighborsIter::ColumnLayout>>
+GetNeighborsIter::makeColumnLayout(const std::vector<std::string>& colNames) {
+    auto layout = std::make_shared<ColumnLayout>();
+    layout->colNames = colNames;
+    NG_RETURN_IF_ERROR(buildIndex(layout.get()));
+    return std::shared_ptr<const ColumnLayout>(std::move(layout));
+}
+
+// static
+Status GetNeighborsIter::buildIndex(ColumnLayout* layout) {
+    auto& colNames = layout->colNames;
     if (UNLIKELY(checkColumnNames(colNames))) {
         return Status::Error("Bad column names.");
     }
-    int64_t edgeStartIndex = -1;
+    layout->edgeOfColumns.resize(colNames.size(), nullptr);
     for (size_t i = 0; i < colNames.size(); ++i) {
-        dsIndex->colIndices.emplace(colNames[i], i);
+        layout->colIndices.emplace(colNames[i], i);
         auto& colName = colNames[i];
         if (colName.find(nebula::kTag) == 0) {  // "_tag"
-            NG_RETURN_IF_ERROR(buildPropIndex(colName, i, false, dsIndex));
+            NG_RETURN_IF_ERROR(buildPropIndex(colName, i, false, layout));
         } else if (colName.find("_edge") == 0) {
-            NG_RETURN_IF_ERROR(buildPropIndex(colName, i, true, dsIndex));
-            if (edgeStartIndex < 0) {
-                edgeStartIndex = i;
+            NG_RETURN_IF_ERROR(buildPropIndex(colName, i, true, layout));
+            if (layout->edgeStartIndex < 0) {
+                layout->edgeStartIndex = i;
             }
         } else {
             // It is "_vid", "_stats", "_expr" in this situation.
         }
     }
 
-    return edgeStartIndex;
+    return Status::OK();
 }
 
+// static
 Status GetNeighborsIter::buildPropIndex(const std::string& props,
                                         size_t columnId,
                                         bool isEdge,
-                                        DataSetIndex* dsIndex) {
+                                        ColumnLayout* layout) {
     std::vector<std::string> pieces;
     folly::split(":", props, pieces);
     if (UNLIKELY(pieces.size() < 2)) {
@@ -174,16 +188,17 @@ Status GetNeighborsIter::buildPropIndex(const std::string& props,
     propIdx.propList.resize(pieces.size() - 2);
     std::move(pieces.begin() + 2, pieces.end(), propIdx.propList.begin());
     std::string name = pieces[1];
+    propIdx.name = name;
     if (isEdge) {
         // The first character of the edge name is +/-.
         if (UNLIKELY(name.empty() || (name[0] != '+' && name[0] != '-'))) {
             return Status::Error("Bad edge name: %s", name.c_str());
         }
-        dsIndex->tagEdgeNameIndices.emplace(columnId, name);
-        dsIndex->edgePropsMap.emplace(name, std::move(propIdx));
+        // The references to the elements are stable
+        auto& edge = layout->edgePropsMap.emplace(name, std::move(propIdx)).first->second;
+        layout->edgeOfColumns[columnId] = &edge;
     } else {
-        dsIndex->tagEdgeNameIndices.emplace(columnId, name);
-        dsIndex->tagPropsMap.emplace(name, std::move(propIdx));
+        layout->tagPropsMap.emplace(name, std::move(propIdx));
     }
 
     return Status::OK();
@@ -194,7 +209,7 @@ const Value& GetNeighborsIter::getColumn(const std::string& col) const {
         return Value::kNullValue;
     }
     auto segment = currentSeg();
-    auto& index = dsIndices_[segment].colIndices;
+    auto& index = dsIndices_[segment].layout->colIndices;
     auto found = index.find(col);
     if (found == index.end()) {
         return Value::kEmpty;
@@ -216,7 +231,7 @@ const Value& GetNeighborsIter::getTagProp(const std::string& tag,
     }
 
     auto segment = currentSeg();
-    auto &tagPropIndices = dsIndices_[segment].tagPropsMap;
+    auto &tagPropIndices = dsIndices_[segment].layout->tagPropsMap;
     auto index = tagPropIndices.find(tag);
     if (index == tagPropIndices.end()) {
         return Value::kEmpty;
@@ -242,21 +257,18 @@ const Value& GetNeighborsIter::getEdgeProp(const std::string& edge,
         return Value::kNullValue;
     }
 
-    auto currentEdge = currentEdgeName();
-    if (edge != "*" &&
-            (currentEdge.compare(1, std::string::npos, edge) != 0)) {
-        VLOG(1) << "Current edge: " << currentEdgeName() << " Wanted: " << edge;
+    auto* currentEdge = this->currentEdge();
+    if (currentEdge == nullptr) {
+        VLOG(1) << "No edge found: " << edge;
         return Value::kEmpty;
     }
-    auto segment = currentSeg();
-    auto index = dsIndices_[segment].edgePropsMap.find(currentEdge);
-    if (index == dsIndices_[segment].edgePropsMap.end()) {
-        VLOG(1) << "No edge found: " << edge;
-        VLOG(1) << "Current edge: " << currentEdge;
+    if (edge != "*" &&
+            (currentEdge->name.compare(1, std::string::npos, edge) != 0)) {
+        VLOG(1) << "Current edge: " << currentEdge->name << " Wanted: " << edge;
         return Value::kEmpty;
     }
-    auto propIndex = index->second.propIndices.find(prop);
-    if (propIndex == index->second.propIndices.end()) {
+    auto propIndex = currentEdge->propIndices.find(prop);
+    if (propIndex == currentEdge->propIndices.end()) {
         VLOG(1) << "No edge prop found: " << prop;
         return Value::kEmpty;
     }
@@ -276,7 +288,7 @@ Value GetNeighborsIter::getVertex() const {
     }
     Vertex vertex;
     vertex.vid = vidVal;
-    auto& tagPropMap = dsIndices_[segment].tagPropsMap;
+    auto& tagPropMap = dsIndices_[segment].layout->tagPropsMap;
     for (auto& tagProp : tagPropMap) {
         DCHECK_EQ(iter_->segments_.size(), 1);
         auto& row = *(iter_->segments_[0]);
@@ -304,7 +316,8 @@ Value GetNeighborsIter::getNoEdgeVertex() const {
         return Value::kNullValue;
     }
 
-    auto& index = dsIndices_[0].colIndices;
+    auto& layout = *dsIndices_[noEdgeIter_->dsIdx_].layout;
+    auto& index = layout.colIndices;
     auto found = index.find(nebula::kVid);
     if (found == index.end()) {
         return Value::kNullBadType;
@@ -316,7 +329,7 @@ Value GetNeighborsIter::getNoEdgeVertex() const {
     }
     Vertex vertex;
     vertex.vid = vidVal;
-    auto& tagPropMap = dsIndices_[0].tagPropsMap;
+    auto& tagPropMap = layout.tagPropsMap;
     bool existTag = false;
     for (auto& tagProp : tagPropMap) {
         DCHECK_EQ(noEdgeIter_->segments_.size(), 1);
@@ -369,9 +382,12 @@ Value GetNeighborsIter::getEdge() const {
         return Value::kNullValue;
     }
 
-    auto segment = currentSeg();
+    auto* currentEdge = this->currentEdge();
+    if (currentEdge == nullptr) {
+        return Value::kNullBadType;
+    }
     Edge edge;
-    auto edgeName = currentEdgeName().substr(1, std::string::npos);
+    auto edgeName = currentEdge->name.substr(1, std::string::npos);
     edge.name = edgeName;
 
     auto type = getEdgeProp(edgeName, kType);
@@ -398,16 +414,11 @@ Value GetNeighborsIter::getEdge() const {
     }
     edge.ranking = rank.getInt();
 
-    auto& edgePropMap = dsIndices_[segment].edgePropsMap;
-    auto edgeProp = edgePropMap.find(currentEdgeName());
-    if (edgeProp == edgePropMap.end()) {
-        return Value::kNullValue;
-    }
-    auto& edgeNamePropList = edgeProp->second.propList;
+    auto& edgeNamePropList = currentEdge->propList;
     auto& propList = currentEdgeProps()->values;
     DCHECK_EQ(edgeNamePropList.size(), propList.size());
     for (size_t i = 0; i < propList.size(); ++i) {
-        auto propName = edgeNamePropList[i];
+        const auto& propName = edgeNamePropList[i];
         if (propName == kSrc || propName == kDst
                 || propName == kRank || propName == kType) {
             continue;
@@ -444,6 +455,14 @@ SequentialIter::SequentialIter(std::shared_ptr<Value> value) : Iterator(value, K
     }
 }
 
+SequentialIter::SequentialIter(const SequentialIter& iter, size_t first, size_t last)
+    : Iterator(iter.valuePtr(), Kind::kSequential), colIndices_(iter.colIndices_) {
+    last = std::min(last, iter.rows_.size());
+    first = std::min(first, last);
+    rows_.assign(iter.rows_.begin() + first, iter.rows_.begin() + last);
+    iter_ = rows_.begin();
+}
+
 SequentialIter::SequentialIter(std::unique_ptr<Iterator> left, std::unique_ptr<Iterator> right)
     : Iterator(left->valuePtr(), Kind::kSequential) {
     std::vector<std::unique_ptr<Iterator>> iterators;
@@ -476,6 +495,22 @@ const Value& SequentialIter::getColumn(int32_t index) const {
     return getColumnByIndex(index, iter_);
 }
 
+JoinIter::JoinIter(const JoinIter& iter, size_t first, size_t last)
+    : Iterator(iter.valuePtr(), Kind::kJoin),
+      colNames_(iter.colNames_),
+      colIndices_(iter.colIndices_),
+      colIdxIndices_(iter.colIdxIndices_) {
+    last = std::min(last, iter.rows_.size());
+    first = std::min(first, last);
+    rows_.reserve(last - first);
+    for (auto i = first; i < last; ++i) {
+        auto& row = iter.rows_[i];
+        // Rebind the column index to this iterator
+        rows_.emplace_back(row.segments(), row.size(), &colIdxIndices_);
+    }
+    iter_ = rows_.begin();
+}
+
 void JoinIter::joinIndex(const Iterator* lhs, const Iterator* rhs) {
     size_t nextSeg = 0;
     if (lhs != nullptr) {
@@ -585,6 +620,14 @@ PropIter::PropIter(std::shared_ptr<Value> value) : Iterator(value, Kind::kProp)
     iter_ = rows_.begin();
 }
 
+PropIter::PropIter(const PropIter& iter, size_t first, size_t last)
+    : Iterator(iter.valuePtr(), Kind::kProp), dsIndex_(iter.dsIndex_) {
+    last = std::min(last, iter.rows_.size());
+    first = std::min(first, last);
+    rows_.assign(iter.rows_.begin() + first, iter.rows_.begin() + last);
+    iter_ = rows_.begin();
+}
+
 Status PropIter::makeDataSetIndex(const DataSet& ds) {
     dsIndex_.ds = &ds;
     auto& colNames = ds.colNames;
@@ -75,6 +75,15 @@ public:
 
     virtual std::unique_ptr<Iterator> copy() const = 0;
 
+    // Copy the logical rows in range [first, last) to a new iterator. The derived class
+    // could override it to avoid duplicating the rows out of the range.
+    virtual std::unique_ptr<Iterator> copyRange(size_t first, size_t last) const {
+        auto copy = this->copy();
+        copy->eraseRange(last, copy->size());
+        copy->eraseRange(0, first);
+        return copy;
+    }
+
     virtual bool valid() const = 0;
 
     virtual void next() = 0;
@@ -237,7 +246,48 @@ private:
 
 class GetNeighborsIter final : public Iterator {
 public:
-    explicit GetNeighborsIter(std::shared_ptr<Value> value);
+    struct PropIndex {
+        size_t colIdx;
+        // The tag name, or the edge name prefixed by +/-
+        std::string name;
+        std::vector<std::string> propList;
+        std::unordered_map<std::string, size_t> propIndices;
+    };
+
+    // The layout of the columns of the datasets returned by GetNeighbors, parsed from the
+    // column names once and shared by the datasets of the same column names and by the
+    // copies of the iterator. The datasets of the responses to one GetNeighbors plan node
+    // are all of the same column names.
+    struct ColumnLayout {
+        ColumnLayout() = default;
+        // The edges of the columns point into the maps
+        ColumnLayout(const ColumnLayout&) = delete;
+        ColumnLayout& operator=(const ColumnLayout&) = delete;
+
+        std::vector<std::string> colNames;
+        // | _vid | _stats | _tag:t1:p1:p2 | _edge:e1:p1:p2 |
+        // -> {_vid : 0, _stats : 1, _tag:t1:p1:p2 : 2, _edge:d1:p1:p2 : 3}
+        std::unordered_map<std::string, size_t> colIndices;
+        // _tag:t1:p1:p2  ->  {t1 : [column_idx, t1, [p1, p2], {p1 : 0, p2 : 1}]}
+        std::unordered_map<std::string, PropIndex> tagPropsMap;
+        // _edge:e1:p1:p2  ->  {e1 : [column_idx, e1, [p1, p2], {p1 : 0, p2 : 1}]}
+        std::unordered_map<std::string, PropIndex> edgePropsMap;
+        // The edge of each column, nullptr if it's not an edge column
+        std::vector<const PropIndex*> edgeOfColumns;
+        int64_t edgeStartIndex{-1};
+    };
+
+    // Reuse the layout if the datasets are of the same column names
+    explicit GetNeighborsIter(std::shared_ptr<Value> value,
+                              std::shared_ptr<const ColumnLayout> layout = nullptr);
+
+    static StatusOr<std::shared_ptr<const ColumnLayout>> makeColumnLayout(
+        const std::vector<std::string>& colNames);
+
+    // The layout of the last dataset, nullptr if none
+    const std::shared_ptr<const ColumnLayout>& layout() const {
+        return layout_;
+    }
 
     std::unique_ptr<Iterator> copy() const override {
         auto copy = std::make_unique<GetNeighborsIter>(*this);
@@ -335,40 +385,25 @@ private:
         return iter_->dsIdx_;
     }
 
-    inline const std::string& currentEdgeName() const {
-        return iter_->edgeName_;
+    inline const PropIndex* currentEdge() const {
+        return iter_->edge_;
     }
 
     inline const List* currentEdgeProps() const {
         return iter_->edgeProps_;
     }
 
-    struct PropIndex {
-        size_t colIdx;
-        std::vector<std::string> propList;
-        std::unordered_map<std::string, size_t> propIndices;
-    };
-
     struct DataSetIndex {
         const DataSet* ds;
-        // | _vid | _stats | _tag:t1:p1:p2 | _edge:e1:p1:p2 |
-        // -> {_vid : 0, _stats : 1, _tag:t1:p1:p2 : 2, _edge:d1:p1:p2 : 3}
-        std::unordered_map<std::string, size_t> colIndices;
-        // | _vid | _stats | _tag:t1:p1:p2 | _edge:e1:p1:p2 |
-        // -> {2 : t1, 3 : e1}
-        std::unordered_map<size_t, std::string> tagEdgeNameIndices;
-        // _tag:t1:p1:p2  ->  {t1 : [column_idx, [p1, p2], {p1 : 0, p2 : 1}]}
-        std::unordered_map<std::string, PropIndex> tagPropsMap;
-        // _edge:e1:p1:p2  ->  {e1 : [column_idx, [p1, p2], {p1 : 0, p2 : 1}]}
-        std::unordered_map<std::string, PropIndex> edgePropsMap;
+        std::shared_ptr<const ColumnLayout> layout;
     };
 
     class GetNbrLogicalRow final : public LogicalRow {
     public:
-        GetNbrLogicalRow(size_t dsIdx, const Row* row, std::string edgeName, const List* edgeProps)
+        GetNbrLogicalRow(size_t dsIdx, const Row* row, const PropIndex* edge, const List* edgeProps)
             : LogicalRow({row}),
               dsIdx_(dsIdx),
-              edgeName_(std::move(edgeName)),
+              edge_(edge),
               edgeProps_(edgeProps) {}
 
         GetNbrLogicalRow(const GetNbrLogicalRow &) = default;
@@ -383,7 +418,8 @@ private:
 
             segments_ = std::move(r.segments_);
 
-            edgeName_ = std::move(r.edgeName_);
+            edge_ = r.edge_;
+            r.edge_ = nullptr;
 
             edgeProps_ = r.edgeProps_;
             r.edgeProps_ = nullptr;
@@ -416,20 +452,22 @@ private:
     private:
         friend class GetNeighborsIter;
         size_t dsIdx_;
-        std::string edgeName_;
+        // Points into the layout of the dataset, nullptr if no edge
+        const PropIndex* edge_;
         const List* edgeProps_;
     };
 
-    StatusOr<int64_t> buildIndex(DataSetIndex* dsIndex);
-    Status buildPropIndex(const std::string& props,
-                          size_t columnId,
-                          bool isEdge,
-                          DataSetIndex* dsIndex);
+    static Status buildIndex(ColumnLayout* layout);
+    static Status buildPropIndex(const std::string& props,
+                                 size_t columnId,
+                                 bool isEdge,
+                                 ColumnLayout* layout);
     Status processList(std::shared_ptr<Value> value);
     StatusOr<DataSetIndex> makeDataSetIndex(const DataSet& ds, size_t idx);
-    void makeLogicalRowByEdge(int64_t edgeStartIndex, size_t idx, const DataSetIndex& dsIndex);
+    void makeLogicalRowByEdge(size_t idx, const DataSetIndex& dsIndex);
 
     FRIEND_TEST(IteratorTest, TestHead);
+    FRIEND_TEST(IteratorTest, GetNeighborsColumnLayout);
 
     bool                       valid_{false};
     RowsType<GetNbrLogicalRow> logicalRows_;
@@ -439,6 +477,7 @@ private:
     RowsType<GetNbrLogicalRow> noEdgeRows_;
     RowsIter<GetNbrLogicalRow> noEdgeIter_;
     std::vector<DataSetIndex>  dsIndices_;
+    std::shared_ptr<const ColumnLayout> layout_;
 };
 
 class SequentialIter final : public Iterator {
@@ -499,6 +538,10 @@ public:
         return copy;
     }
 
+    std::unique_ptr<Iterator> copyRange(size_t first, size_t last) const override {
+        return std::unique_ptr<Iterator>(new SequentialIter(*this, first, last));
+    }
+
     bool valid() const override {
         return iter_ < rows_.end();
     }
@@ -597,6 +640,8 @@ protected:
     }
 
 private:
+    SequentialIter(const SequentialIter& iter, size_t first, size_t last);
+
     void doReset(size_t pos) override {
         iter_ = rows_.begin() + pos;
     }
@@ -686,6 +731,10 @@ public:
         return copy;
     }
 
+    std::unique_ptr<Iterator> copyRange(size_t first, size_t last) const override {
+        return std::unique_ptr<Iterator>(new JoinIter(*this, first, last));
+    }
+
     std::vector<std::string> colNames() const {
         return colNames_;
     }
@@ -773,6 +822,8 @@ public:
     }
 
 private:
+    JoinIter(const JoinIter& iter, size_t first, size_t last);
+
     void doReset(size_t pos) override {
         iter_ = rows_.begin() + pos;
     }
@@ -848,6 +899,10 @@ public:
         return copy;
     }
 
+    std::unique_ptr<Iterator> copyRange(size_t first, size_t last) const override {
+        return std::unique_ptr<Iterator>(new PropIter(*this, first, last));
+    }
+
     bool valid() const override {
         return iter_ < rows_.end();
     }
@@ -931,6 +986,8 @@ public:
     Status buildPropIndex(const std::string& props, size_t columnIdx);
 
 private:
+    PropIter(const PropIter& iter, size_t first, size_t last);
+
     void doReset(size_t pos) override {
         iter_ = rows_.begin() + pos;
     }
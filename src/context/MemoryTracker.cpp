@@ -0,0 +1,160 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "context/MemoryTracker.h"
+
+#include <folly/SpinLock.h>
+
+#include "service/GraphFlags.h"
+
+namespace nebula {
+namespace graph {
+
+std::atomic<int64_t> MemoryTracker::totalUsed_{0};
+
+namespace {
+
+folly::SpinLock& registryLock() {
+    static folly::SpinLock lock;
+    return lock;
+}
+
+std::unordered_set<const MemoryTracker*>& registry() {
+    static std::unordered_set<const MemoryTracker*> trackers;
+    return trackers;
+}
+
+// The number of the elements to estimate a large container by
+constexpr size_t kSampleSize = 16;
+
+template <typename Container, typename Estimate>
+int64_t estimateElements(const Container& elements, Estimate&& estimate) {
+    int64_t bytes = 0;
+    size_t sampled = 0;
+    for (auto iter = elements.begin(); iter != elements.end() && sampled < kSampleSize;
+         ++iter, ++sampled) {
+        bytes += estimate(*iter);
+    }
+    if (sampled == 0) {
+        return 0;
+    }
+    return bytes / static_cast<int64_t>(sampled) * static_cast<int64_t>(elements.size());
+}
+
+int64_t estimateProps(const std::unordered_map<std::string, Value>& props) {
+    return estimateElements(props, [](const auto& kv) {
+        return static_cast<int64_t>(kv.first.capacity()) + MemoryTracker::estimate(kv.second);
+    });
+}
+
+int64_t estimateVertex(const Vertex& vertex) {
+    int64_t bytes = sizeof(Vertex) + MemoryTracker::estimate(vertex.vid);
+    for (const auto& tag : vertex.tags) {
+        bytes += sizeof(Tag) + tag.name.capacity() + estimateProps(tag.props);
+    }
+    return bytes;
+}
+
+}   // namespace
+
+MemoryTracker::MemoryTracker(int64_t sessionId, std::string query)
+    : sessionId_(sessionId), query_(std::move(query)) {
+    folly::SpinLockGuard guard(registryLock());
+    registry().emplace(this);
+}
+
+MemoryTracker::~MemoryTracker() {
+    totalUsed_.fetch_sub(used(), std::memory_order_relaxed);
+    folly::SpinLockGuard guard(registryLock());
+    registry().erase(this);
+}
+
+void MemoryTracker::consume(int64_t bytes) {
+    used_.fetch_add(bytes, std::memory_order_relaxed);
+    totalUsed_.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void MemoryTracker::release(int64_t bytes) {
+    used_.fetch_sub(bytes, std::memory_order_relaxed);
+    totalUsed_.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+Status MemoryTracker::checkLimit(int64_t bytes) const {
+    auto queryUsed = used() + bytes;
+    if (FLAGS_max_query_memory_bytes > 0 && queryUsed > FLAGS_max_query_memory_bytes) {
+        return Status::Error("The query used %ld bytes of memory, over the limit %ld bytes",
+                             queryUsed,
+                             FLAGS_max_query_memory_bytes);
+    }
+    auto allUsed = totalUsed() + bytes;
+    if (FLAGS_max_total_query_memory_bytes > 0 && allUsed > FLAGS_max_total_query_memory_bytes) {
+        return Status::Error("All queries used %ld bytes of memory, over the limit %ld bytes",
+                             allUsed,
+                             FLAGS_max_total_query_memory_bytes);
+    }
+    return Status::OK();
+}
+
+// static
+std::vector<MemoryTracker::QueryInfo> MemoryTracker::runningQueries() {
+    std::vector<QueryInfo> queries;
+    folly::SpinLockGuard guard(registryLock());
+    queries.reserve(registry().size());
+    for (auto* tracker : registry()) {
+        queries.emplace_back(QueryInfo{tracker->sessionId_,
+                                       tracker->query_,
+                                       tracker->used(),
+                                       tracker->duration_.elapsedInUSec()});
+    }
+    return queries;
+}
+
+// static
+int64_t MemoryTracker::estimate(const Value& value) {
+    int64_t bytes = sizeof(Value);
+    switch (value.type()) {
+        case Value::Type::STRING:
+            return bytes + value.getStr().capacity();
+        case Value::Type::VERTEX:
+            return bytes + estimateVertex(value.getVertex());
+        case Value::Type::EDGE: {
+            const auto& edge = value.getEdge();
+            return bytes + sizeof(Edge) + estimate(edge.src) + estimate(edge.dst) +
+                   edge.name.capacity() + estimateProps(edge.props);
+        }
+        case Value::Type::PATH: {
+            const auto& path = value.getPath();
+            bytes += sizeof(Path) + estimateVertex(path.src);
+            return bytes + estimateElements(path.steps, [](const Step& step) {
+                       return static_cast<int64_t>(sizeof(Step)) + estimateVertex(step.dst) +
+                              estimateProps(step.props);
+                   });
+        }
+        case Value::Type::LIST:
+            return bytes + sizeof(List) +
+                   estimateElements(value.getList().values,
+                                    [](const Value& v) { return estimate(v); });
+        case Value::Type::SET:
+            return bytes + sizeof(Set) +
+                   estimateElements(value.getSet().values,
+                                    [](const Value& v) { return estimate(v); });
+        case Value::Type::MAP:
+            return bytes + sizeof(Map) + estimateProps(value.getMap().kvs);
+        case Value::Type::DATASET: {
+            const auto& ds = value.getDataSet();
+            return bytes + sizeof(DataSet) + estimateElements(ds.rows, [](const Row& row) {
+                       return static_cast<int64_t>(sizeof(Row)) +
+                              estimateElements(row.values,
+                                               [](const Value& v) { return estimate(v); });
+                   });
+        }
+        default:
+            return bytes;
+    }
+}
+
+}   // namespace graph
+}   // namespace nebula
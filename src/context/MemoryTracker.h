@@ -0,0 +1,75 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef CONTEXT_MEMORYTRACKER_H_
+#define CONTEXT_MEMORYTRACKER_H_
+
+#include "common/base/Base.h"
+#include "common/base/Status.h"
+#include "common/datatypes/Value.h"
+#include "common/time/Duration.h"
+
+namespace nebula {
+namespace graph {
+
+/***************************************************************************
+ *
+ * The estimated memory held by the results of a query, charged when the
+ * executors put their results into the execution context and released when
+ * the results are dropped. The usage of each query and the total usage of all
+ * the running queries are limited by max_query_memory_bytes and
+ * max_total_query_memory_bytes, the query over the limits fails.
+ *
+ * The trackers of the running queries are registered to show by SHOW QUERIES.
+ *
+ **************************************************************************/
+class MemoryTracker final {
+public:
+    struct QueryInfo {
+        int64_t         sessionId;
+        std::string     query;
+        int64_t         memoryBytes;
+        int64_t         durationInUs;
+    };
+
+    MemoryTracker(int64_t sessionId, std::string query);
+
+    ~MemoryTracker();
+
+    void consume(int64_t bytes);
+
+    void release(int64_t bytes);
+
+    int64_t used() const {
+        return used_.load(std::memory_order_relaxed);
+    }
+
+    // Error if the query or all the queries would use more memory than the limits
+    // after consuming the bytes
+    Status checkLimit(int64_t bytes = 0) const;
+
+    static int64_t totalUsed() {
+        return totalUsed_.load(std::memory_order_relaxed);
+    }
+
+    static std::vector<QueryInfo> runningQueries();
+
+    // The approximate bytes of the value, the large containers are estimated by sampling
+    static int64_t estimate(const Value& value);
+
+private:
+    int64_t                             sessionId_;
+    std::string                         query_;
+    time::Duration                      duration_;
+    std::atomic<int64_t>                used_{0};
+
+    static std::atomic<int64_t>         totalUsed_;
+};
+
+}   // namespace graph
+}   // namespace nebula
+
+#endif   // CONTEXT_MEMORYTRACKER_H_
@@ -24,6 +24,7 @@ QueryContext::QueryContext(RequestContextPtr rctx,
       metaClient_(DCHECK_NOTNULL(metaClient)),
       charsetInfo_(DCHECK_NOTNULL(charsetInfo)) {
     init();
+    initMemTracker();
 }
 
 QueryContext::QueryContext() {
@@ -32,6 +33,7 @@ QueryContext::QueryContext() {
 
 void QueryContext::init() {
     objPool_ = std::make_unique<ObjectPool>();
+    execPool_ = std::make_unique<ObjectPool>();
     ep_ = std::make_unique<ExecutionPlan>();
     ectx_ = std::make_unique<ExecutionContext>();
     idGen_ = std::make_unique<IdGenerator>(0);
@@ -39,6 +41,25 @@ void QueryContext::init() {
     vctx_ = std::make_unique<ValidateContext>(std::make_unique<AnonVarGenerator>(symTable_.get()));
 }
 
+void QueryContext::reset(RequestContextPtr rctx, std::unique_ptr<ExecutionContext> ectx) {
+    rctx_ = std::move(rctx);
+    ectx_ = std::move(ectx);
+    execPool_ = std::make_unique<ObjectPool>();
+    planDescription_.reset();
+    initMemTracker();
+}
+
+void QueryContext::initMemTracker() {
+    memTracker_.reset();
+    if (rctx_ == nullptr) {
+        return;
+    }
+    memTracker_ = std::make_unique<MemoryTracker>(rctx_->session()->id(), rctx_->query());
+    if (ectx_ != nullptr) {
+        ectx_->setMemoryTracker(memTracker_.get());
+    }
+}
+
 void QueryContext::addProfilingData(int64_t planNodeId, ProfilingStats&& profilingStats) {
     // return directly if not enable profile
     if (!planDescription_) return;
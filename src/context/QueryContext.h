@@ -62,6 +62,14 @@ public:
         rctx_ = std::move(rctx);
     }
 
+    RequestContextPtr releaseRCtx() {
+        return std::move(rctx_);
+    }
+
+    // Bind another request to execute the validated and optimized plan again,
+    // from the values prepared by the validators in `ectx', see PlanCache
+    void reset(RequestContextPtr rctx, std::unique_ptr<ExecutionContext> ectx);
+
     void setSchemaManager(meta::SchemaManager* sm) {
         sm_ = sm;
     }
@@ -126,6 +134,15 @@ public:
         return objPool_.get();
     }
 
+    ObjectPool* execPool() const {
+        return execPool_.get();
+    }
+
+    // nullptr if no request, e.g. in the tests
+    MemoryTracker* memTracker() const {
+        return memTracker_.get();
+    }
+
     int64_t genId() const {
         return idGen_->id();
     }
@@ -149,6 +166,8 @@ public:
 private:
     void init();
 
+    void initMemTracker();
+
     RequestContextPtr                                       rctx_;
     std::unique_ptr<ValidateContext>                        vctx_;
     std::unique_ptr<ExecutionContext>                       ectx_;
@@ -162,6 +181,11 @@ private:
     // The Object Pool holds all internal generated objects.
     // e.g. expressions, plan nodes, executors
     std::unique_ptr<ObjectPool>                             objPool_;
+    // The executors of the current execution, renewed when the plan is executed again.
+    // The objects allocated at run time go here or are owned by the executors, since the
+    // plans are reused by the plan cache and objPool_ would grow with each execution.
+    std::unique_ptr<ObjectPool>                             execPool_;
+    std::unique_ptr<MemoryTracker>                          memTracker_;
 
     // plan description for explain and profile query
     std::unique_ptr<PlanDescription>                        planDescription_;
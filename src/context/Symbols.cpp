@@ -0,0 +1,43 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "context/Symbols.h"
+
+#include "planner/PlanNode.h"
+
+namespace nebula {
+namespace graph {
+
+constexpr size_t Variable::kAllVersions;
+
+void SymbolTable::analyzeHistory() {
+    for (auto& pair : vars_) {
+        auto* var = pair.second;
+        // The latest version is always kept for the result of the query
+        size_t numVersions = 1;
+        for (auto* node : var->writtenBy) {
+            if (node->refersToEarlierOutputs()) {
+                numVersions = Variable::kAllVersions;
+                break;
+            }
+        }
+        for (auto* node : var->readBy) {
+            if (numVersions == Variable::kAllVersions) {
+                break;
+            }
+            auto versions = node->numVersionsToRead(var->name);
+            if (versions == Variable::kAllVersions) {
+                numVersions = Variable::kAllVersions;
+                break;
+            }
+            numVersions = std::max(numVersions, versions);
+        }
+        var->numVersionsToKeep = numVersions;
+    }
+}
+
+}   // namespace graph
+}   // namespace nebula
@@ -36,6 +36,9 @@ struct ColDef {
 using ColsDef = std::vector<ColDef>;
 
 struct Variable {
+    // Keep the whole history of the variable
+    static constexpr size_t kAllVersions = 0;
+
     explicit Variable(std::string n) : name(std::move(n)) {}
 
     std::string name;
@@ -45,6 +48,10 @@ struct Variable {
 
     std::unordered_set<PlanNode*> readBy;
     std::unordered_set<PlanNode*> writtenBy;
+
+    // The number of the latest versions kept in the execution context,
+    // annotated by SymbolTable::analyzeHistory
+    size_t numVersionsToKeep{kAllVersions};
 };
 
 class SymbolTable final {
@@ -109,6 +116,10 @@ public:
         return deleteWrittenBy(oldVar, node) && writtenBy(newVar, node);
     }
 
+    // Liveness analysis of the versions of each variable by its readers, so the scheduler
+    // could drop the versions no longer read, e.g. the responses of the former steps in a loop.
+    void analyzeHistory();
+
     Variable* getVar(const std::string& varName) {
         auto var = vars_.find(varName);
         if (var == vars_.end()) {
@@ -41,6 +41,10 @@ struct NodeInfo {
     const std::string                      *alias{nullptr};
     const MapExpression                    *props{nullptr};
     Expression                             *filter{nullptr};
+    // The last node of a closed path, i.e. the first node again
+    bool                                    closing{false};
+    // The node of OPTIONAL MATCH bound by the previous clauses
+    bool                                    bound{false};
 };
 
 struct EdgeInfo {
@@ -139,6 +143,8 @@ struct MatchClauseContext final : CypherClauseContextBase {
     std::unique_ptr<WhereClauseContext>         where;
     std::unordered_map<std::string, AliasType>* aliasesUsed{nullptr};
     std::unordered_map<std::string, AliasType>  aliasesGenerated;
+    // Left outer joined with the previous clauses on the bound node
+    bool                                        isOptional{false};
 };
 
 struct UnwindClauseContext final : CypherClauseContextBase {
@@ -178,6 +184,11 @@ struct EdgeContext final : PatternContext {
         : PatternContext(PatternKind::kEdge, m), info(i) {}
 
     EdgeInfo* info{nullptr};
+
+    // Output fields
+    ScanInfo                    scanInfo;
+    // initialize start expression in project node, the vid of the node on the left of the edge
+    std::unique_ptr<Expression> initialExpr;
 };
 }  // namespace graph
 }  // namespace nebula
@@ -8,6 +8,7 @@
 
 #include <gtest/gtest.h>
 #include "common/base/Base.h"
+#include "service/GraphFlags.h"
 
 namespace nebula {
 namespace graph {
@@ -60,5 +61,41 @@ TEST(ExecutionContextTest, TestResult) {
     EXPECT_TRUE(result.valuePtr()->isDataSet());
 }
 
+TEST(ExecutionContextTest, TestMemoryTracker) {
+    MemoryTracker tracker(1, "GO FROM 1 OVER e");
+    ExecutionContext ctx;
+    ctx.setMemoryTracker(&tracker);
+
+    DataSet ds({"a", "b"});
+    for (int64_t i = 0; i < 100; ++i) {
+        ds.emplace_back(Row({i, "Hello world"}));
+    }
+    auto bytes = MemoryTracker::estimate(Value(ds));
+    EXPECT_GT(bytes, 0);
+
+    auto value = std::make_shared<Value>(std::move(ds));
+    ctx.setResult("v1", ResultBuilder().value(value).finish());
+    EXPECT_EQ(bytes, tracker.used());
+    // The shared value is charged once
+    ctx.setResult("v2", ResultBuilder().value(value).finish());
+    EXPECT_EQ(bytes, tracker.used());
+
+    auto queries = MemoryTracker::runningQueries();
+    ASSERT_EQ(1, queries.size());
+    EXPECT_EQ(1, queries[0].sessionId);
+    EXPECT_EQ("GO FROM 1 OVER e", queries[0].query);
+    EXPECT_EQ(bytes, queries[0].memoryBytes);
+
+    EXPECT_TRUE(tracker.checkLimit().ok());
+    FLAGS_max_query_memory_bytes = bytes - 1;
+    EXPECT_FALSE(tracker.checkLimit().ok());
+    FLAGS_max_query_memory_bytes = 0;
+
+    ctx.deleteValue("v1");
+    EXPECT_EQ(bytes, tracker.used());
+    ctx.deleteValue("v2");
+    EXPECT_EQ(0, tracker.used());
+}
+
 }   // namespace graph
 }   // namespace nebula
@@ -666,6 +666,34 @@ TEST(IteratorTest, EraseRange) {
     }
 }
 
+TEST(IteratorTest, CopyRange) {
+    DataSet ds({"col1", "col2"});
+    for (auto i = 0; i < 10; ++i) {
+        ds.rows.emplace_back(Row({i, folly::to<std::string>(i)}));
+    }
+    auto val = std::make_shared<Value>(std::move(ds));
+    SequentialIter iter(val);
+    {
+        auto copy = iter.copyRange(3, 7);
+        ASSERT_EQ(copy->size(), 4);
+        auto i = 3;
+        for (; copy->valid(); copy->next()) {
+            ASSERT_EQ(copy->getColumn("col1"), i);
+            ASSERT_EQ(copy->getColumn("col2"), folly::to<std::string>(i));
+            ++i;
+        }
+    }
+    // out of range
+    {
+        auto copy = iter.copyRange(8, 20);
+        ASSERT_EQ(copy->size(), 2);
+        copy = iter.copyRange(12, 20);
+        ASSERT_EQ(copy->size(), 0);
+    }
+    // the source iterator is untouched
+    EXPECT_EQ(iter.size(), 10);
+}
+
 TEST(IteratorTest, Join) {
     DataSet ds1;
     ds1.colNames = {kVid, "tag_prop", "edge_prop", kDst};
@@ -981,6 +1009,63 @@ TEST(IteratorTest, EraseBySwap) {
     }
     EXPECT_EQ(result, expected);
 }
+
+TEST(IteratorTest, GetNeighborsColumnLayout) {
+    auto makeDataSet = [](const std::string& edgeCol, int64_t start) {
+        DataSet ds;
+        ds.colNames = {kVid, "_stats", "_tag:tag1:prop1", edgeCol, "_expr"};
+        for (auto i = start; i < start + 2; ++i) {
+            List edge({"world", folly::to<std::string>(i + 1), 1, 0});
+            ds.rows.emplace_back(Row({folly::to<std::string>(i),
+                                      Value(),
+                                      Value(List({"hello"})),
+                                      Value(List({Value(std::move(edge))})),
+                                      Value()}));
+        }
+        return ds;
+    };
+    auto edgeCol = "_edge:+edge1:prop1:_dst:_type:_rank";
+    List datasets;
+    datasets.values.emplace_back(makeDataSet(edgeCol, 0));
+    datasets.values.emplace_back(makeDataSet(edgeCol, 2));
+    GetNeighborsIter iter(std::make_shared<Value>(std::move(datasets)));
+    auto layout = iter.layout();
+    ASSERT_NE(nullptr, layout);
+    EXPECT_EQ(3, layout->edgeStartIndex);
+    // The datasets of the same column names share the layout
+    ASSERT_EQ(2, iter.dsIndices_.size());
+    EXPECT_EQ(iter.dsIndices_[0].layout, iter.dsIndices_[1].layout);
+    std::vector<Value> dsts;
+    for (; iter.valid(); iter.next()) {
+        EXPECT_EQ(Value("hello"), iter.getTagProp("tag1", "prop1"));
+        EXPECT_EQ(Value("world"), iter.getEdgeProp("edge1", "prop1"));
+        EXPECT_EQ(Value::kEmpty, iter.getEdgeProp("edge2", "prop1"));
+        EXPECT_TRUE(iter.getEdge().isEdge());
+        dsts.emplace_back(iter.getEdgeProp("*", kDst));
+    }
+    EXPECT_EQ(std::vector<Value>({"1", "2", "3", "4"}), dsts);
+
+    // Reuse the layout of the previous iterator, and the copies share it too
+    {
+        List next;
+        next.values.emplace_back(makeDataSet(edgeCol, 4));
+        GetNeighborsIter nextIter(std::make_shared<Value>(std::move(next)), layout);
+        EXPECT_EQ(layout, nextIter.layout());
+        auto copy = nextIter.copy();
+        EXPECT_EQ(layout, static_cast<GetNeighborsIter*>(copy.get())->layout());
+        EXPECT_EQ(Value("5"), copy->getEdgeProp("edge1", kDst));
+    }
+    // Build a new layout for the different columns
+    {
+        List next;
+        next.values.emplace_back(makeDataSet("_edge:-edge2:prop1:_dst:_type:_rank", 4));
+        GetNeighborsIter nextIter(std::make_shared<Value>(std::move(next)), layout);
+        ASSERT_NE(nullptr, nextIter.layout());
+        EXPECT_NE(layout, nextIter.layout());
+        EXPECT_EQ(Value::kEmpty, nextIter.getEdgeProp("edge1", kDst));
+        EXPECT_EQ(Value("5"), nextIter.getEdgeProp("edge2", kDst));
+    }
+}
 }  // namespace graph
 }  // namespace nebula
 
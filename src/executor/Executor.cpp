@@ -28,6 +28,7 @@
 #include "executor/admin/RevokeRoleExecutor.h"
 #include "executor/admin/ShowBalanceExecutor.h"
 #include "executor/admin/ShowHostsExecutor.h"
+#include "executor/admin/ShowQueriesExecutor.h"
 #include "executor/admin/SnapshotExecutor.h"
 #include "executor/admin/ListenerExecutor.h"
 #include "executor/admin/SpaceExecutor.h"
@@ -50,6 +51,7 @@
 #include "executor/algo/ProduceAllPathsExecutor.h"
 #include "executor/algo/CartesianProductExecutor.h"
 #include "executor/algo/SubgraphExecutor.h"
+#include "executor/algo/IntersectNeighborsExecutor.h"
 #include "executor/logic/LoopExecutor.h"
 #include "executor/logic/PassThroughExecutor.h"
 #include "executor/logic/SelectExecutor.h"
@@ -77,6 +79,7 @@
 #include "executor/query/UnwindExecutor.h"
 #include "executor/query/SortExecutor.h"
 #include "executor/query/TopNExecutor.h"
+#include "executor/query/TraverseExecutor.h"
 #include "executor/query/UnionExecutor.h"
 #include "executor/query/UnionAllVersionVarExecutor.h"
 #include "executor/query/AssignExecutor.h"
@@ -87,6 +90,7 @@
 #include "planner/PlanNode.h"
 #include "planner/Query.h"
 #include "common/base/ObjectPool.h"
+#include "service/GraphFlags.h"
 #include "util/ScopedTimer.h"
 
 using folly::stringPrintf;
@@ -154,7 +158,7 @@ Executor *Executor::makeExecutor(const PlanNode *node,
 
 // static
 Executor *Executor::makeExecutor(QueryContext *qctx, const PlanNode *node) {
-    auto pool = qctx->objPool();
+    auto pool = qctx->execPool();
     switch (node->kind()) {
         case PlanNode::Kind::kPassThrough: {
             return pool->add(new PassThroughExecutor(node, qctx));
@@ -180,6 +184,9 @@ Executor *Executor::makeExecutor(QueryContext *qctx, const PlanNode *node) {
         case PlanNode::Kind::kGetNeighbors: {
             return pool->add(new GetNeighborsExecutor(node, qctx));
         }
+        case PlanNode::Kind::kTraverse: {
+            return pool->add(new TraverseExecutor(node, qctx));
+        }
         case PlanNode::Kind::kLimit: {
             return pool->add(new LimitExecutor(node, qctx));
         }
@@ -408,6 +415,9 @@ Executor *Executor::makeExecutor(QueryContext *qctx, const PlanNode *node) {
         case PlanNode::Kind::kShowCollation: {
             return pool->add(new ShowCollationExecutor(node, qctx));
         }
+        case PlanNode::Kind::kShowQueries: {
+            return pool->add(new ShowQueriesExecutor(node, qctx));
+        }
         case PlanNode::Kind::kBFSShortest: {
             return pool->add(new BFSShortestPathExecutor(node, qctx));
         }
@@ -426,6 +436,9 @@ Executor *Executor::makeExecutor(QueryContext *qctx, const PlanNode *node) {
         case PlanNode::Kind::kSubgraph: {
             return pool->add(new SubgraphExecutor(node, qctx));
         }
+        case PlanNode::Kind::kIntersectNeighbors: {
+            return pool->add(new IntersectNeighborsExecutor(node, qctx));
+        }
         case PlanNode::Kind::kAddGroup: {
             return pool->add(new AddGroupExecutor(node, qctx));
         }
@@ -538,6 +551,14 @@ folly::Future<Status> Executor::error(Status status) const {
 }
 
 Status Executor::finish(Result &&result) {
+    auto *memTracker = qctx()->memTracker();
+    if (memTracker != nullptr && result.valuePtr() != nullptr) {
+        // Fail before keeping the result over the limits
+        auto status = memTracker->checkLimit(MemoryTracker::estimate(result.value()));
+        if (!status.ok()) {
+            return status;
+        }
+    }
     numRows_ = result.size();
     ectx_->setResult(node()->outputVar(), std::move(result));
     return Status::OK();
@@ -555,5 +576,15 @@ folly::Executor *Executor::runner() const {
     return qctx()->rctx()->runner();
 }
 
+bool Executor::shouldRunMorsels(size_t numRows) const {
+    return FLAGS_min_morsel_parallel_rows > 0 &&
+           numRows >= static_cast<size_t>(FLAGS_min_morsel_parallel_rows) &&
+           numRows > morselSize();
+}
+
+size_t Executor::morselSize() const {
+    return std::max<size_t>(FLAGS_morsel_size, 1);
+}
+
 }   // namespace graph
 }   // namespace nebula
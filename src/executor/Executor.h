@@ -98,6 +98,18 @@ protected:
 
     folly::Executor *runner() const;
 
+    // Whether the input with `numRows' rows is large enough to be split into morsels
+    bool shouldRunMorsels(size_t numRows) const;
+
+    // Number of rows of each morsel
+    size_t morselSize() const;
+
+    // Split the input into morsels of consecutive rows and run `scatter' on each morsel by the
+    // workers of `runner()', then `gather' the results of all morsels in the order of rows.
+    // The `scatter' runs concurrently, so it should evaluate the expressions on its own clones.
+    template <typename Scatter, typename Gather>
+    folly::Future<Status> runMorsels(const Iterator *iter, Scatter scatter, Gather gather);
+
     // Store the result of this executor to execution context
     Status finish(Result &&result);
     // Store the default result which not used for later executor
@@ -126,6 +138,23 @@ protected:
     std::unique_ptr<std::unordered_map<std::string, std::string>> otherStats_;
 };
 
+template <typename Scatter, typename Gather>
+folly::Future<Status> Executor::runMorsels(const Iterator *iter, Scatter scatter, Gather gather) {
+    using ScatterResult = decltype(scatter(std::declval<Iterator *>()));
+    auto size = iter->size();
+    auto step = morselSize();
+    std::vector<folly::Future<ScatterResult>> futures;
+    futures.reserve((size + step - 1) / step);
+    for (size_t begin = 0; begin < size; begin += step) {
+        auto morsel = iter->copyRange(begin, begin + step);
+        futures.emplace_back(
+            folly::via(runner(), [scatter, morsel = std::move(morsel)]() mutable {
+                return scatter(morsel.get());
+            }));
+    }
+    return folly::collect(futures).via(runner()).then(std::move(gather));
+}
+
 }   // namespace graph
 }   // namespace nebula
 
@@ -0,0 +1,38 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+*
+* This source code is licensed under Apache 2.0 License,
+* attached with Common Clause Condition 1.0, found in the LICENSES directory.
+*/
+
+#include "executor/admin/ShowQueriesExecutor.h"
+#include "context/MemoryTracker.h"
+#include "util/ScopedTimer.h"
+
+namespace nebula {
+namespace graph {
+
+folly::Future<Status> ShowQueriesExecutor::execute() {
+    SCOPED_TIMER(&execTime_);
+
+    DataSet dataSet({"SessionID", "Query", "Memory(bytes)", "Duration(us)"});
+
+    auto queries = MemoryTracker::runningQueries();
+    // The most memory consuming first
+    std::sort(queries.begin(), queries.end(), [](const auto &a, const auto &b) {
+        return a.memoryBytes > b.memoryBytes;
+    });
+    for (auto &query : queries) {
+        Row row;
+        row.values.resize(4);
+        row.values[0].setInt(query.sessionId);
+        row.values[1].setStr(std::move(query.query));
+        row.values[2].setInt(query.memoryBytes);
+        row.values[3].setInt(query.durationInUs);
+        dataSet.emplace_back(std::move(row));
+    }
+
+    return finish(ResultBuilder().value(Value(std::move(dataSet))).finish());
+}
+
+}   // namespace graph
+}   // namespace nebula
@@ -20,32 +20,42 @@ folly::Future<Status> BFSShortestPathExecutor::execute() {
 
     DataSet ds;
     ds.colNames = node()->colNames();
-    std::multimap<Value, Value> interim;
+    // dst : <the id of dst, edge>
+    std::multimap<Value, std::pair<uint32_t, Value>> interim;
 
+    // The edges of a vertex are adjacent, so its vid is interned once for all of them
+    const Value* src = nullptr;
+    uint32_t srcId = VidInterner::kNotFound;
     for (; iter->valid(); iter->next()) {
         auto edgeVal = iter->getEdge();
         if (!edgeVal.isEdge()) {
             continue;
         }
         auto& edge = edgeVal.getEdge();
-        auto visited = visited_.find(edge.dst) != visited_.end();
-        if (visited) {
+        auto dstId = interner_.intern(edge.dst);
+        if (visited_.contains(dstId)) {
             continue;
         }
 
         // save the starts.
-        visited_.emplace(edge.src);
+        const auto& vid = iter->getColumn(kVid);
+        if (&vid != src) {
+            src = &vid;
+            srcId = interner_.intern(vid);
+        }
+        visited_.insert(srcId);
         VLOG(1) << "dst: " << edge.dst << " edge: " << edge;
-        interim.emplace(edge.dst, std::move(edgeVal));
+        auto dst = edge.dst;
+        interim.emplace(std::move(dst), std::make_pair(dstId, std::move(edgeVal)));
     }
     for (auto& kv : interim) {
         auto dst = std::move(kv.first);
-        auto edge = std::move(kv.second);
+        auto edge = std::move(kv.second.second);
+        visited_.insert(kv.second.first);
         Row row;
-        row.values.emplace_back(dst);
+        row.values.emplace_back(std::move(dst));
         row.values.emplace_back(std::move(edge));
         ds.rows.emplace_back(std::move(row));
-        visited_.emplace(dst);
     }
     return finish(ResultBuilder().value(Value(std::move(ds))).finish());
 }
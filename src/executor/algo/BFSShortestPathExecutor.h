@@ -8,6 +8,7 @@
 #define EXECUTOR_ALGO_BFSSHORTESTPATHEXECUTOR_H_
 
 #include "executor/Executor.h"
+#include "util/VidInterner.h"
 
 namespace nebula {
 namespace graph {
@@ -19,7 +20,8 @@ public:
     folly::Future<Status> execute() override;
 
 private:
-    std::unordered_set<Value>               visited_;
+    VidInterner                             interner_;
+    VidBitmap                               visited_;
 };
 }  // namespace graph
 }  // namespace nebula
@@ -19,6 +19,10 @@ folly::Future<Status> ConjunctPathExecutor::execute() {
             return allPaths();
         case ConjunctPath::PathKind::kFloyd:
             return floydShortestPath();
+        case ConjunctPath::PathKind::kBiLabelCorrecting:
+            return weightedShortestPath();
+        case ConjunctPath::PathKind::kMultiSourceBFS:
+            return multiSourceShortestPath();
         default:
             LOG(FATAL) << "Not implement.";
     }
@@ -26,149 +30,334 @@ folly::Future<Status> ConjunctPathExecutor::execute() {
 
 folly::Future<Status> ConjunctPathExecutor::bfsShortestPath() {
     auto* conjunct = asNode<ConjunctPath>(node());
-    auto lIter = ectx_->getResult(conjunct->leftInputVar()).iter();
-    const auto& rHist = ectx_->getHistory(conjunct->rightInputVar());
     VLOG(1) << "current: " << node()->outputVar();
     VLOG(1) << "left input: " << conjunct->leftInputVar()
             << " right input: " << conjunct->rightInputVar();
-    DCHECK(!!lIter);
+    auto& direction = ectx_->getValue(conjunct->directionVar());
+    DCHECK(direction.isBool());
+    bool isForward = direction.isBool() && direction.getBool();
+
+    auto& expanded = isForward ? forward_ : backward_;
+    auto& other = isForward ? backward_ : forward_;
+    const auto& expandedVar = isForward ? conjunct->leftInputVar() : conjunct->rightInputVar();
+    const auto& otherVar = isForward ? conjunct->rightInputVar() : conjunct->leftInputVar();
+    if (other.empty()) {
+        // The other side hasn't expanded yet, its latest step is the starts
+        other.emplace_back(buildBfsStep(otherVar));
+    }
+    expanded.emplace_back(buildBfsStep(expandedVar));
+    VLOG(1) << "forward, size: " << forward_.size();
+    VLOG(1) << "backward, size: " << backward_.size();
 
     DataSet ds;
     ds.colNames = conjunct->colNames();
+    // The shorter paths would have met in the former steps, so only the latest steps of both
+    // sides could meet.
+    auto meets = findBfsMeets(expanded.back(), other.back());
+    for (auto& meet : meets) {
+        VLOG(1) << "Meet at: " << meet;
+        auto forwardPaths = buildBfsInterimPaths(meet, forward_);
+        auto backwardPaths = buildBfsInterimPaths(meet, backward_);
+        for (auto& forwardPath : forwardPaths) {
+            forwardPath.reverse();
+            VLOG(1) << "Forward path: " << forwardPath;
+            for (auto& backwardPath : backwardPaths) {
+                VLOG(1) << "Backward path: " << backwardPath;
+                Path result = forwardPath;
+                result.append(backwardPath);
+                Row row;
+                row.emplace_back(std::move(result));
+                ds.rows.emplace_back(std::move(row));
+            }
+        }
+    }
+    return finish(ResultBuilder().value(Value(std::move(ds))).finish());
+}
 
-    VLOG(1) << "forward, size: " << forward_.size();
-    VLOG(1) << "backward, size: " << backward_.size();
-    forward_.emplace_back();
-    for (; lIter->valid(); lIter->next()) {
-        auto& dst = lIter->getColumn(kVid);
-        auto& edge = lIter->getColumn("edge");
+ConjunctPathExecutor::BfsStep ConjunctPathExecutor::buildBfsStep(const std::string& var) {
+    BfsStep step;
+    auto iter = ectx_->getResult(var).iter();
+    for (; iter->valid(); iter->next()) {
+        auto& dst = iter->getColumn(kVid);
+        auto& edge = iter->getColumn("edge");
         VLOG(1) << "dst: " << dst << " edge: " << edge;
-        if (!edge.isEdge()) {
-            forward_.back().emplace(Value(dst), nullptr);
-        } else {
-            forward_.back().emplace(Value(dst), &edge.getEdge());
+        step.emplace(dst, edge);
+    }
+    return step;
+}
+
+// static
+std::unordered_set<Value> ConjunctPathExecutor::findBfsMeets(const BfsStep& left,
+                                                             const BfsStep& right) {
+    // Scan the smaller step and probe the other one
+    const auto* smaller = &left;
+    const auto* larger = &right;
+    if (smaller->size() > larger->size()) {
+        std::swap(smaller, larger);
+    }
+    std::unordered_set<Value> meets;
+    for (auto& vidEdge : *smaller) {
+        if (larger->find(vidEdge.first) != larger->end()) {
+            meets.emplace(vidEdge.first);
         }
     }
+    return meets;
+}
 
-    bool isLatest = false;
-    if (rHist.size() >= 2) {
-        auto previous = rHist[rHist.size() - 2].iter();
-        VLOG(1) << "Find odd length path.";
-        auto rows = findBfsShortestPath(previous.get(), isLatest, forward_.back());
-        if (!rows.empty()) {
-            VLOG(1) << "Meet odd length path.";
-            ds.rows = std::move(rows);
-            return finish(ResultBuilder().value(Value(std::move(ds))).finish());
+// static
+std::vector<Path> ConjunctPathExecutor::buildBfsInterimPaths(const Value& vid,
+                                                             const std::vector<BfsStep>& steps) {
+    Path start;
+    start.src = Vertex(vid, {});
+    std::vector<Path> interimPaths = {std::move(start)};
+    for (auto step = steps.rbegin(); step != steps.rend(); ++step) {
+        std::vector<Path> paths;
+        for (auto& interimPath : interimPaths) {
+            const auto& id = interimPath.steps.empty() ? interimPath.src.vid
+                                                       : interimPath.steps.back().dst.vid;
+            auto edges = step->equal_range(id);
+            for (auto i = edges.first; i != edges.second; ++i) {
+                Path p = interimPath;
+                // The starts have no edge
+                if (i->second.isEdge()) {
+                    auto& edge = i->second.getEdge();
+                    VLOG(1) << "Edge: " << edge;
+                    p.steps.emplace_back(
+                        Step(Vertex(edge.src, {}), -edge.type, edge.name, edge.ranking, {}));
+                }
+                paths.emplace_back(std::move(p));
+            }
         }
+        interimPaths = std::move(paths);
     }
+    return interimPaths;
+}
 
-    auto latest = rHist.back().iter();
-    isLatest = true;
-    backward_.emplace_back();
-    VLOG(1) << "Find even length path.";
-    auto rows = findBfsShortestPath(latest.get(), isLatest, forward_.back());
-    if (!rows.empty()) {
-        VLOG(1) << "Meet even length path.";
-        ds.rows = std::move(rows);
+folly::Future<Status> ConjunctPathExecutor::multiSourceShortestPath() {
+    auto* conjunct = asNode<ConjunctPath>(node());
+    auto lIter = ectx_->getResult(conjunct->leftInputVar()).iter();
+    auto rIter = ectx_->getResult(conjunct->rightInputVar()).iter();
+    VLOG(1) << "current: " << node()->outputVar();
+    VLOG(1) << "left input: " << conjunct->leftInputVar()
+            << " right input: " << conjunct->rightInputVar();
+    DCHECK(!!lIter);
+    DCHECK(!!rIter);
+    count_++;
+
+    DataSet ds;
+    ds.colNames = conjunct->colNames();
+    auto forward = buildMultiSourceStep(lIter.get(), forwardSources_);
+    auto backward = buildMultiSourceStep(rIter.get(), backwardSources_);
+
+    VLOG(1) << "Find odd length path.";
+    forwardSources_.steps.emplace_back(std::move(forward));
+    conjunctMultiSource(ds);
+
+    bool backwardExpanded = count_ * 2 <= conjunct->steps();
+    if (backwardExpanded) {
+        VLOG(1) << "Find even length path.";
+        backwardSources_.steps.emplace_back(std::move(backward));
+        conjunctMultiSource(ds);
+    }
+
+    auto terminated = !pruneMultiSourceFrontiers(backwardExpanded);
+    if (!conjunct->terminationVar().empty()) {
+        ectx_->setValue(conjunct->terminationVar(), terminated);
     }
     return finish(ResultBuilder().value(Value(std::move(ds))).finish());
 }
 
-std::vector<Row> ConjunctPathExecutor::findBfsShortestPath(
+bool ConjunctPathExecutor::pruneMultiSourceFrontiers(bool backwardExpanded) {
+    auto* conjunct = asNode<ConjunctPath>(node());
+    // The starts and the ends of the pairs not found yet
+    SourceBits liveStarts;
+    SourceBits liveEnds;
+    const auto& starts = forwardSources_.starts;
+    const auto& ends = backwardSources_.starts;
+    for (size_t start = 0; start < starts.size(); ++start) {
+        if (starts[start].type() == Value::Type::__EMPTY__) {
+            continue;
+        }
+        auto resolved = resolved_.find(start);
+        for (size_t end = 0; end < ends.size(); ++end) {
+            if (ends[end].type() == Value::Type::__EMPTY__ || starts[start] == ends[end] ||
+                (resolved != resolved_.end() && resolved->second.test(end))) {
+                continue;
+            }
+            liveStarts.set(start);
+            liveEnds.set(end);
+        }
+    }
+    if (!liveStarts.any()) {
+        VLOG(1) << "The paths of all the pairs are found.";
+        return false;
+    }
+
+    // Only the latest steps of both sides could meet, so nothing is found once either of them
+    // is empty
+    auto numForward = pruneMultiSourceFrontier(
+        forwardSources_.steps.back(), liveStarts, conjunct->leftFrontierVar());
+    if (numForward == 0) {
+        return false;
+    }
+    if (!backwardExpanded) {
+        return true;
+    }
+    return pruneMultiSourceFrontier(
+               backwardSources_.steps.back(), liveEnds, conjunct->rightFrontierVar()) > 0;
+}
+
+size_t ConjunctPathExecutor::pruneMultiSourceFrontier(const MultiSourceStep& step,
+                                                      const SourceBits& live,
+                                                      const std::string& frontierVar) {
+    DataSet ds({kVid});
+    for (auto& vertex : step) {
+        if (vertex.second.sources.intersects(live)) {
+            ds.rows.emplace_back(Row({vertex.first}));
+        }
+    }
+    auto size = ds.rows.size();
+    if (!frontierVar.empty() && size < step.size()) {
+        VLOG(1) << "Prune the frontier " << frontierVar << " from " << step.size() << " to "
+                << size;
+        ectx_->setResult(frontierVar, ResultBuilder().value(Value(std::move(ds))).finish());
+    }
+    return size;
+}
+
+// static
+ConjunctPathExecutor::MultiSourceStep ConjunctPathExecutor::buildMultiSourceStep(
     Iterator* iter,
-    bool isLatest,
-    std::multimap<Value, const Edge*>& table) {
-    std::unordered_set<Value> meets;
+    MultiSourceSide& side) {
+    MultiSourceStep step;
     for (; iter->valid(); iter->next()) {
-        auto& dst = iter->getColumn(kVid);
-        if (isLatest) {
-            auto& edge = iter->getColumn("edge");
-            VLOG(1) << "dst: " << dst << " edge: " << edge;
-            if (!edge.isEdge()) {
-                backward_.back().emplace(dst, nullptr);
-            } else {
-                backward_.back().emplace(dst, &edge.getEdge());
+        auto& dst = iter->getColumn(kDst);
+        auto& edge = iter->getColumn("edge");
+        auto& sources = iter->getColumn("sources");
+        if (!edge.isEdge() || !sources.isStr()) {
+            continue;
+        }
+        auto bits = SourceBits::decode(sources.getStr());
+        if (side.steps.empty()) {
+            // Each edge of the first step carries the only bit of its src
+            for (auto index : bits.indexes()) {
+                if (index >= side.starts.size()) {
+                    side.starts.resize(index + 1);
+                }
+                side.starts[index] = edge.getEdge().src;
             }
         }
-        if (table.find(dst) != table.end()) {
-            meets.emplace(dst);
+        auto& vertex = step[dst];
+        vertex.sources |= bits;
+        vertex.edges.emplace_back(edge, std::move(bits));
+    }
+    if (side.steps.empty()) {
+        MultiSourceStep starts;
+        for (size_t i = 0; i < side.starts.size(); ++i) {
+            if (side.starts[i].type() != Value::Type::__EMPTY__) {
+                starts[side.starts[i]].sources.set(i);
+            }
         }
+        side.steps.emplace_back(std::move(starts));
     }
+    return step;
+}
 
-    std::vector<Row> rows;
-    if (!meets.empty()) {
-        VLOG(1) << "Build forward, size: " << forward_.size();
-        auto forwardPath = buildBfsInterimPath(meets, forward_);
-        VLOG(1) << "Build backward, size: " << backward_.size();
-        auto backwardPath = buildBfsInterimPath(meets, backward_);
-        for (auto& p : forwardPath) {
-            auto range = backwardPath.equal_range(p.first);
-            for (auto& i = range.first; i != range.second; ++i) {
-                Path result = p.second;
-                result.reverse();
-                VLOG(1) << "Forward path: " << result;
-                VLOG(1) << "Backward path: " << i->second;
-                result.append(i->second);
-                Row row;
-                row.emplace_back(std::move(result));
-                rows.emplace_back(std::move(row));
+void ConjunctPathExecutor::conjunctMultiSource(DataSet& ds) {
+    // The shorter paths of a pair would have met in the former steps, so only the latest steps
+    // of both sides could meet.
+    auto forwardStep = forwardSources_.steps.size() - 1;
+    auto backwardStep = backwardSources_.steps.size() - 1;
+    const auto& forward = forwardSources_.steps.back();
+    const auto& backward = backwardSources_.steps.back();
+
+    // <forward start, backward start> : the vids met at
+    std::map<std::pair<size_t, size_t>, std::vector<Value>> pairMeets;
+    // Scan the smaller step and probe the other one
+    bool scanForward = forward.size() <= backward.size();
+    const auto& smaller = scanForward ? forward : backward;
+    const auto& larger = scanForward ? backward : forward;
+    for (auto& vertex : smaller) {
+        auto found = larger.find(vertex.first);
+        if (found == larger.end()) {
+            continue;
+        }
+        const auto& forwardBits = scanForward ? vertex.second.sources : found->second.sources;
+        const auto& backwardBits = scanForward ? found->second.sources : vertex.second.sources;
+        for (auto start : forwardBits.indexes()) {
+            auto resolved = resolved_.find(start);
+            auto ends = resolved == resolved_.end() ? backwardBits
+                                                    : backwardBits.minus(resolved->second);
+            for (auto end : ends.indexes()) {
+                pairMeets[std::make_pair(start, end)].emplace_back(vertex.first);
             }
         }
     }
-    return rows;
-}
 
-std::multimap<Value, Path> ConjunctPathExecutor::buildBfsInterimPath(
-    std::unordered_set<Value>& meets,
-    std::vector<std::multimap<Value, const Edge*>>& hists) {
-    std::multimap<Value, Path> results;
-    for (auto& v : meets) {
-        VLOG(1) << "Meet at: " << v;
-        Path start;
-        start.src = Vertex(v, {});
-        if (hists.empty()) {
-            // Happens at one step path situation when meet at starts
-            VLOG(1) << "Start: " << start;
-            results.emplace(v, std::move(start));
+    Value cost(static_cast<int64_t>(forwardStep + backwardStep));
+    for (auto& pairMeet : pairMeets) {
+        auto start = pairMeet.first.first;
+        auto end = pairMeet.first.second;
+        resolved_[start].set(end);
+        const auto& startVid = forwardSources_.starts[start];
+        const auto& endVid = backwardSources_.starts[end];
+        if (startVid == endVid) {
             continue;
         }
-        std::vector<Path> interimPaths = {std::move(start)};
-        for (auto hist = hists.rbegin(); hist < hists.rend(); ++hist) {
-            std::vector<Path> tmp;
-            for (auto& interimPath : interimPaths) {
-                Value id;
-                if (interimPath.steps.empty()) {
-                    id = interimPath.src.vid;
-                } else {
-                    id = interimPath.steps.back().dst.vid;
+        for (auto& meet : pairMeet.second) {
+            VLOG(1) << "Meet at: " << meet;
+            auto forwardPaths = buildMultiSourcePaths(forwardSources_, forwardStep, meet, start);
+            auto backwardPaths = buildMultiSourcePaths(backwardSources_, backwardStep, meet, end);
+            for (auto& forwardPath : forwardPaths) {
+                forwardPath.reverse();
+                for (auto& backwardPath : backwardPaths) {
+                    Path path = forwardPath;
+                    path.append(backwardPath);
+                    VLOG(1) << "Found path: " << path;
+                    Row row;
+                    row.values.emplace_back(std::move(path));
+                    row.values.emplace_back(cost);
+                    ds.rows.emplace_back(std::move(row));
                 }
-                auto edges = hist->equal_range(id);
-                for (auto i = edges.first; i != edges.second; ++i) {
-                    Path p = interimPath;
-                    if (i->second != nullptr) {
-                        auto& edge = *(i->second);
-                        VLOG(1) << "Edge: " << edge;
-                        VLOG(1) << "Interim path: " << interimPath;
-                        p.steps.emplace_back(
-                            Step(Vertex(edge.src, {}), -edge.type, edge.name, edge.ranking, {}));
-                        VLOG(1) << "New semi path: " << p;
-                    }
-                    if (hist == (hists.rend() - 1)) {
-                        VLOG(1) << "emplace result: " << p.src.vid;
-                        results.emplace(p.src.vid, std::move(p));
-                    } else {
-                        tmp.emplace_back(std::move(p));
-                    }
-                }   // `edge'
-            }       // `interimPath'
-            if (hist != (hists.rend() - 1)) {
-                interimPaths = std::move(tmp);
             }
-        }   // `hist'
-    }       // `v'
-    return results;
+        }
+    }
 }
 
+// static
+std::vector<Path> ConjunctPathExecutor::buildMultiSourcePaths(const MultiSourceSide& side,
+                                                              size_t step,
+                                                              const Value& vid,
+                                                              size_t start) {
+    Path path;
+    path.src = Vertex(vid, {});
+    std::vector<Path> paths = {std::move(path)};
+    for (auto i = step; i > 0; --i) {
+        const auto& vertices = side.steps[i];
+        std::vector<Path> interimPaths;
+        for (auto& interimPath : paths) {
+            const auto& id = interimPath.steps.empty() ? interimPath.src.vid
+                                                       : interimPath.steps.back().dst.vid;
+            auto found = vertices.find(id);
+            if (found == vertices.end()) {
+                continue;
+            }
+            // Only the edges carrying the start are on its shortest paths
+            for (auto& edgeBits : found->second.edges) {
+                if (!edgeBits.second.test(start)) {
+                    continue;
+                }
+                auto& edge = edgeBits.first.getEdge();
+                Path p = interimPath;
+                p.steps.emplace_back(
+                    Step(Vertex(edge.src, {}), -edge.type, edge.name, edge.ranking, {}));
+                interimPaths.emplace_back(std::move(p));
+            }
+        }
+        paths = std::move(interimPaths);
+    }
+    return paths;
+}
 
 folly::Future<Status> ConjunctPathExecutor::floydShortestPath() {
     auto* conjunct = asNode<ConjunctPath>(node());
@@ -214,6 +403,177 @@ folly::Future<Status> ConjunctPathExecutor::floydShortestPath() {
     return finish(ResultBuilder().value(Value(std::move(ds))).finish());
 }
 
+folly::Future<Status> ConjunctPathExecutor::weightedShortestPath() {
+    auto* conjunct = asNode<ConjunctPath>(node());
+    conditionalVar_ = conjunct->conditionalVar();
+    VLOG(1) << "current: " << node()->outputVar();
+    VLOG(1) << "left input: " << conjunct->leftInputVar()
+            << " right input: " << conjunct->rightInputVar();
+
+    DataSet ds;
+    ds.colNames = conjunct->colNames();
+
+    auto forward =
+        collectWeightedPaths(ectx_->getHistory(conjunct->leftInputVar()), numForwardVersions_);
+    auto backward =
+        collectWeightedPaths(ectx_->getHistory(conjunct->rightInputVar()), numBackwardVersions_);
+    for (auto& vidPaths : backward) {
+        for (auto& endPaths : vidPaths.second) {
+            for (auto& hopsPaths : endPaths.second) {
+                mergeWeightedPaths(vidPaths.first,
+                                   endPaths.first,
+                                   hopsPaths.first,
+                                   hopsPaths.second,
+                                   backwardTable_);
+            }
+        }
+    }
+    conjunctWeightedPaths(forward, backwardTable_, conjunct->steps(), ds);
+    conjunctWeightedPaths(forwardTable_, backward, conjunct->steps(), ds);
+    for (auto& vidPaths : forward) {
+        for (auto& startPaths : vidPaths.second) {
+            for (auto& hopsPaths : startPaths.second) {
+                mergeWeightedPaths(vidPaths.first,
+                                   startPaths.first,
+                                   hopsPaths.first,
+                                   hopsPaths.second,
+                                   forwardTable_);
+            }
+        }
+    }
+    return finish(ResultBuilder().value(Value(std::move(ds))).finish());
+}
+
+// static
+ConjunctPathExecutor::WeightedPathsMap ConjunctPathExecutor::collectWeightedPaths(
+    const std::vector<Result>& hist,
+    size_t& numVersions) {
+    WeightedPathsMap table;
+    for (; numVersions < hist.size(); ++numVersions) {
+        auto iter = hist[numVersions].iter();
+        for (; iter->valid(); iter->next()) {
+            auto& pathList = iter->getColumn("paths");
+            if (!pathList.isList() || pathList.getList().empty() ||
+                !pathList.getList().values.front().isPath()) {
+                continue;
+            }
+            // The paths of a row take the same hops
+            auto hops = pathList.getList().values.front().getPath().steps.size();
+            WeightedPaths paths;
+            paths.cost = iter->getColumn("cost");
+            paths.paths.emplace_back(&pathList.getList());
+            mergeWeightedPaths(iter->getColumn(kDst), iter->getColumn(kSrc), hops, paths, table);
+        }
+    }
+    return table;
+}
+
+// static
+void ConjunctPathExecutor::mergeWeightedPaths(const Value& vid,
+                                              const Value& end,
+                                              size_t hops,
+                                              const WeightedPaths& paths,
+                                              WeightedPathsMap& table) {
+    auto& hopsPaths = table[vid][end];
+    auto found = hopsPaths.find(hops);
+    if (found == hopsPaths.end()) {
+        hopsPaths.emplace(hops, paths);
+    } else if (paths.cost < found->second.cost) {
+        found->second = paths;
+    } else if (paths.cost == found->second.cost) {
+        auto& merged = found->second.paths;
+        merged.insert(merged.end(), paths.paths.begin(), paths.paths.end());
+    }
+}
+
+void ConjunctPathExecutor::conjunctWeightedPaths(const WeightedPathsMap& forward,
+                                                 const WeightedPathsMap& backward,
+                                                 size_t maxSteps,
+                                                 DataSet& ds) {
+    for (auto& vidPaths : forward) {
+        auto backwardPaths = backward.find(vidPaths.first);
+        if (backwardPaths == backward.end()) {
+            continue;
+        }
+        for (auto& startPaths : vidPaths.second) {
+            auto& startVid = startPaths.first;
+            for (auto& endPaths : backwardPaths->second) {
+                auto& endVid = endPaths.first;
+                if (startVid == endVid) {
+                    delPathFromConditionalVar(startVid, endVid);
+                    continue;
+                }
+                bool found = false;
+                for (auto& forwardHops : startPaths.second) {
+                    for (auto& backwardHops : endPaths.second) {
+                        if (forwardHops.first + backwardHops.first > maxSteps) {
+                            // Ordered by the hops
+                            break;
+                        }
+                        found = addWeightedPaths(startVid,
+                                                 endVid,
+                                                 forwardHops.second,
+                                                 backwardHops.second,
+                                                 ds) ||
+                                found;
+                    }
+                }
+                if (found) {
+                    delPathFromConditionalVar(startVid, endVid);
+                }
+            }
+        }
+    }
+}
+
+bool ConjunctPathExecutor::addWeightedPaths(const Value& startVid,
+                                            const Value& endVid,
+                                            const WeightedPaths& forwardPaths,
+                                            const WeightedPaths& backwardPaths,
+                                            DataSet& ds) {
+    auto totalCost = forwardPaths.cost + backwardPaths.cost;
+    auto& hist = historyCostMap_[startVid];
+    auto histCost = hist.find(endVid);
+    auto& pathsFound = weightedPathsFound_[startVid][endVid];
+    if (histCost != hist.end()) {
+        if (histCost->second < totalCost) {
+            return false;
+        }
+        if (totalCost < histCost->second) {
+            pathsFound.clear();
+        }
+    }
+    bool added = false;
+    for (auto* forwardList : forwardPaths.paths) {
+        for (auto& forwardPath : forwardList->values) {
+            for (auto* backwardList : backwardPaths.paths) {
+                for (auto& backwardPath : backwardList->values) {
+                    if (!forwardPath.isPath() || !backwardPath.isPath()) {
+                        continue;
+                    }
+                    auto path = forwardPath.getPath();
+                    auto reversed = backwardPath.getPath();
+                    reversed.reverse();
+                    path.append(std::move(reversed));
+                    if (!pathsFound.emplace(path).second) {
+                        continue;
+                    }
+                    VLOG(1) << "Found path: " << path;
+                    Row row;
+                    row.values.emplace_back(std::move(path));
+                    row.values.emplace_back(totalCost);
+                    ds.rows.emplace_back(std::move(row));
+                    added = true;
+                }
+            }
+        }
+    }
+    if (added) {
+        hist[endVid] = totalCost;
+    }
+    return added;
+}
+
 Status ConjunctPathExecutor::conjunctPath(const List& forwardPaths,
                                           const List& backwardPaths,
                                           Value& cost,
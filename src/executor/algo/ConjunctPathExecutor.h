@@ -8,6 +8,7 @@
 #define EXECUTOR_ALGO_CONJUNCTPATHEXECUTOR_H_
 
 #include "executor/Executor.h"
+#include "util/SourceBits.h"
 
 namespace nebula {
 namespace graph {
@@ -27,22 +28,103 @@ public:
 private:
     using CostPathsValMap = std::unordered_map<Value, std::unordered_map<Value, CostPaths>>;
 
+    // The cheapest paths of the same hops between a start (or end) vid and a vertex
+    struct WeightedPaths {
+        Value cost;
+        std::vector<const List*> paths;
+    };
+    // vid : {start or end vid : {hops : paths}}, the cheaper paths of more hops are kept with
+    // the ones of fewer hops, which may fit the steps when conjuncted with the other side
+    using WeightedPathsMap = std::unordered_map<
+        Value,
+        std::unordered_map<Value, std::map<size_t, WeightedPaths>>>;
+
+    // vid : the edges reaching it in one step of the BFS, empty for the starts
+    using BfsStep = std::unordered_multimap<Value, Value>;
+
+    // Only one side expands in each iteration, which is told by the direction variable
     folly::Future<Status> bfsShortestPath();
 
     folly::Future<Status> allPaths();
 
-    std::vector<Row> findBfsShortestPath(Iterator* iter,
-                                         bool isLatest,
-                                         std::multimap<Value, const Edge*>& table);
+    BfsStep buildBfsStep(const std::string& var);
+
+    static std::unordered_set<Value> findBfsMeets(const BfsStep& left, const BfsStep& right);
+
+    // The paths from `vid' of the latest step back to the starts
+    static std::vector<Path> buildBfsInterimPaths(const Value& vid,
+                                                  const std::vector<BfsStep>& steps);
+
+    // A vertex reached by one step of the multi-source BFS
+    struct MultiSourceVertex {
+        // The starts reaching it first by the step
+        SourceBits sources;
+        // The edges reaching it with the starts they carry
+        std::vector<std::pair<Value, SourceBits>> edges;
+    };
+    using MultiSourceStep = std::unordered_map<Value, MultiSourceVertex>;
+    struct MultiSourceSide {
+        // The vids of the starts by their indexes in the SourceBits
+        std::vector<Value> starts;
+        // The step 0 is the starts
+        std::vector<MultiSourceStep> steps;
+    };
+
+    // Both sides expand in each iteration, the paths are built only for the pairs of the starts
+    // met by the latest steps.
+    folly::Future<Status> multiSourceShortestPath();
 
-    std::multimap<Value, Path> buildBfsInterimPath(
-        std::unordered_set<Value>& meets,
-        std::vector<std::multimap<Value, const Edge*>>& hist);
+    static MultiSourceStep buildMultiSourceStep(Iterator* iter, MultiSourceSide& side);
+
+    void conjunctMultiSource(DataSet& ds);
+
+    // Drop the vertices reached only by the starts whose pairs are all found from the frontiers
+    // of the next iteration, false if no more paths could be found.
+    bool pruneMultiSourceFrontiers(bool backwardExpanded);
+
+    // The number of the vertices of the step carrying the live sources, the frontier variable
+    // is reset to them if any is dropped
+    size_t pruneMultiSourceFrontier(const MultiSourceStep& step,
+                                    const SourceBits& live,
+                                    const std::string& frontierVar);
+
+    // The paths from `vid' reached by the `step' back to the start of index `start'
+    static std::vector<Path> buildMultiSourcePaths(const MultiSourceSide& side,
+                                                   size_t step,
+                                                   const Value& vid,
+                                                   size_t start);
 
     folly::Future<Status> floydShortestPath();
 
     bool findPath(Iterator* backwardPathIter, CostPathsValMap& forwardPathtable, DataSet& ds);
 
+    // The costs don't grow with the steps, so the paths found by each step of one side are
+    // conjuncted with all the paths found by the other side so far.
+    folly::Future<Status> weightedShortestPath();
+
+    // Collect the paths of the versions not conjuncted yet
+    static WeightedPathsMap collectWeightedPaths(const std::vector<Result>& hist,
+                                                 size_t& numVersions);
+
+    static void mergeWeightedPaths(const Value& vid,
+                                   const Value& end,
+                                   size_t hops,
+                                   const WeightedPaths& paths,
+                                   WeightedPathsMap& table);
+
+    void conjunctWeightedPaths(const WeightedPathsMap& forward,
+                               const WeightedPathsMap& backward,
+                               size_t maxSteps,
+                               DataSet& ds);
+
+    // Add the paths from start to end through the vertex met unless cheaper ones are found,
+    // true if any is added
+    bool addWeightedPaths(const Value& startVid,
+                          const Value& endVid,
+                          const WeightedPaths& forwardPaths,
+                          const WeightedPaths& backwardPaths,
+                          DataSet& ds);
+
     Status conjunctPath(const List& forwardPaths,
                         const List& backwardPaths,
                         Value& cost,
@@ -54,13 +136,26 @@ private:
     void delPathFromConditionalVar(const Value& start, const Value& end);
 
 private:
-    std::vector<std::multimap<Value, const Edge*>> forward_;
-    std::vector<std::multimap<Value, const Edge*>> backward_;
+    std::vector<BfsStep> forward_;
+    std::vector<BfsStep> backward_;
     size_t count_{0};
     // startVid : {endVid, cost}
     std::unordered_map<Value, std::unordered_map<Value, Value>> historyCostMap_;
     std::string conditionalVar_;
     bool noLoop_;
+    // The weighted paths of both sides found so far
+    WeightedPathsMap forwardTable_;
+    WeightedPathsMap backwardTable_;
+    size_t numForwardVersions_{0};
+    size_t numBackwardVersions_{0};
+    // start : {end : the cheapest weighted paths found}, one path could be conjuncted at
+    // several vertices met
+    std::unordered_map<Value, std::unordered_map<Value, std::unordered_set<Value>>>
+        weightedPathsFound_;
+    MultiSourceSide forwardSources_;
+    MultiSourceSide backwardSources_;
+    // forward start : the backward starts whose shortest paths are found
+    std::unordered_map<size_t, SourceBits> resolved_;
 };
 }  // namespace graph
 }  // namespace nebula
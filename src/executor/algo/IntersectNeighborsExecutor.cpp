@@ -0,0 +1,158 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "executor/algo/IntersectNeighborsExecutor.h"
+
+#include "context/QueryExpressionContext.h"
+#include "planner/Algo.h"
+
+namespace nebula {
+namespace graph {
+
+folly::Future<Status> IntersectNeighborsExecutor::execute() {
+    SCOPED_TIMER(&execTime_);
+    auto* intersect = asNode<IntersectNeighbors>(node());
+    auto iter = ectx_->getResult(intersect->edgesVar()).iter();
+    if (!iter->isGetNeighborsIter()) {
+        std::stringstream ss;
+        ss << "IntersectNeighborsExecutor does not support " << iter->kind();
+        return Status::Error(ss.str());
+    }
+    auto neighbors = collectNeighbors(iter.get());
+
+    std::vector<Neighbors> boundNeighbors;
+    boundNeighbors.reserve(intersect->neighborsVars().size());
+    for (auto& var : intersect->neighborsVars()) {
+        auto boundIter = ectx_->getResult(var).iter();
+        if (!boundIter->isGetNeighborsIter()) {
+            std::stringstream ss;
+            ss << "IntersectNeighborsExecutor does not support " << boundIter->kind();
+            return Status::Error(ss.str());
+        }
+        boundNeighbors.emplace_back(collectNeighbors(boundIter.get()));
+    }
+
+    // The other ends kept of the edges from each source
+    std::unordered_map<Value, std::unordered_set<Value>> kept;
+    // The sources and the vertices bound to them intersected already
+    std::unordered_set<List> visited;
+    std::vector<const std::vector<Value>*> lists(boundNeighbors.size() + 1);
+    QueryExpressionContext ctx(ectx_);
+    auto bindings = ectx_->getResult(intersect->bindingsVar()).iter();
+    for (; bindings->valid(); bindings->next()) {
+        List key;
+        key.values.reserve(lists.size());
+        key.values.emplace_back(intersect->srcVid()->eval(ctx(bindings.get())));
+        for (auto* boundVid : intersect->boundVids()) {
+            key.values.emplace_back(boundVid->eval(ctx(bindings.get())));
+        }
+        if (!visited.emplace(key).second) {
+            continue;
+        }
+
+        bool found = true;
+        for (size_t i = 0; found && i < lists.size(); ++i) {
+            const auto& vertices = i == 0 ? neighbors : boundNeighbors[i - 1];
+            auto vertex = vertices.find(key.values[i]);
+            found = vertex != vertices.end();
+            if (found) {
+                lists[i] = &vertex->second;
+            }
+        }
+        if (!found) {
+            continue;
+        }
+        auto& ends = kept[key.values[0]];
+        for (auto& end : leapfrog(lists)) {
+            ends.emplace(std::move(end));
+        }
+    }
+    VLOG(1) << node()->outputVar() << " keeps the edges of " << kept.size() << " vertices";
+
+    iter->reset();
+    while (iter->valid()) {
+        bool keep = false;
+        auto found = kept.find(iter->getColumn(kVid));
+        if (found != kept.end()) {
+            auto edge = iter->getEdge();
+            keep = edge.isEdge() && found->second.count(edge.getEdge().dst) > 0;
+        }
+        if (keep) {
+            iter->next();
+        } else {
+            iter->unstableErase();
+        }
+    }
+    iter->reset();
+    return finish(ResultBuilder().value(iter->valuePtr()).iter(std::move(iter)).finish());
+}
+
+// static
+std::vector<Value> IntersectNeighborsExecutor::leapfrog(
+    const std::vector<const std::vector<Value>*>& lists) {
+    std::vector<Value> values;
+    if (lists.empty()) {
+        return values;
+    }
+    std::vector<size_t> positions(lists.size(), 0);
+    const Value* max = nullptr;
+    for (const auto* list : lists) {
+        if (list->empty()) {
+            return values;
+        }
+        if (max == nullptr || *max < list->front()) {
+            max = &list->front();
+        }
+    }
+
+    // The count of the lists positioned at the max in turn
+    size_t matched = 0;
+    for (size_t i = 0;; i = (i + 1) % lists.size()) {
+        const auto& list = *lists[i];
+        auto pos = std::lower_bound(list.begin() + positions[i], list.end(), *max);
+        if (pos == list.end()) {
+            break;
+        }
+        positions[i] = pos - list.begin();
+        if (*pos != *max) {
+            max = &*pos;
+            matched = 1;
+            continue;
+        }
+        if (++matched < lists.size()) {
+            continue;
+        }
+        values.emplace_back(*max);
+        if (++positions[i] == list.size()) {
+            break;
+        }
+        max = &list[positions[i]];
+        matched = 1;
+    }
+    return values;
+}
+
+// static
+IntersectNeighborsExecutor::Neighbors IntersectNeighborsExecutor::collectNeighbors(
+    Iterator* iter) {
+    Neighbors neighbors;
+    for (; iter->valid(); iter->next()) {
+        auto edge = iter->getEdge();
+        if (!edge.isEdge()) {
+            continue;
+        }
+        neighbors[iter->getColumn(kVid)].emplace_back(edge.getEdge().dst);
+    }
+    for (auto& vertex : neighbors) {
+        auto& ends = vertex.second;
+        std::sort(ends.begin(), ends.end());
+        ends.erase(std::unique(ends.begin(), ends.end()), ends.end());
+    }
+    return neighbors;
+}
+
+}   // namespace graph
+}   // namespace nebula
@@ -0,0 +1,34 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef EXECUTOR_ALGO_INTERSECTNEIGHBORSEXECUTOR_H_
+#define EXECUTOR_ALGO_INTERSECTNEIGHBORSEXECUTOR_H_
+
+#include "executor/Executor.h"
+
+namespace nebula {
+namespace graph {
+class IntersectNeighborsExecutor final : public Executor {
+public:
+    IntersectNeighborsExecutor(const PlanNode* node, QueryContext* qctx)
+        : Executor("IntersectNeighborsExecutor", node, qctx) {}
+
+    folly::Future<Status> execute() override;
+
+    // The values in all the sorted lists, by leapfrogging the lists to the largest value
+    // seen so far
+    static std::vector<Value> leapfrog(const std::vector<const std::vector<Value>*>& lists);
+
+private:
+    // The sorted distinct neighbors of each vertex
+    using Neighbors = std::unordered_map<Value, std::vector<Value>>;
+
+    static Neighbors collectNeighbors(Iterator* iter);
+};
+
+}   // namespace graph
+}   // namespace nebula
+#endif  // EXECUTOR_ALGO_INTERSECTNEIGHBORSEXECUTOR_H_
@@ -5,10 +5,33 @@
  */
 #include "executor/algo/ProduceAllPathsExecutor.h"
 
+#include <folly/hash/Hash.h>
+
 #include "planner/Algo.h"
 
 namespace nebula {
 namespace graph {
+
+namespace {
+
+uint64_t sigOf(size_t hash) {
+    return uint64_t{1} << (hash & 63);
+}
+
+uint64_t vertexSigOf(uint32_t vid) {
+    return sigOf(folly::hash::twang_mix64(vid));
+}
+
+// The edge traversed reversely is counted as the same edge
+uint64_t edgeSigOf(uint32_t src, uint32_t dst, EdgeType type, EdgeRanking ranking) {
+    if (type < 0) {
+        return edgeSigOf(dst, src, -type, ranking);
+    }
+    return sigOf(folly::hash::hash_combine(src, dst, type, ranking));
+}
+
+}   // namespace
+
 folly::Future<Status> ProduceAllPathsExecutor::execute() {
     SCOPED_TIMER(&execTime_);
     auto* allPaths = asNode<ProduceAllPaths>(node());
@@ -24,68 +47,132 @@ folly::Future<Status> ProduceAllPathsExecutor::execute() {
         return Status::Error("Only accept GetNeighbotsIter.");
     }
     VLOG(1) << "Edge size: " << iter->size();
+    // The edges of a vertex are adjacent, so its vid is interned once for all of them
+    const Value* srcVid = nullptr;
+    uint32_t src = VidInterner::kNotFound;
     for (; iter->valid(); iter->next()) {
         auto edgeVal = iter->getEdge();
         if (!edgeVal.isEdge()) {
             continue;
         }
         auto& edge = edgeVal.getEdge();
-        auto histPaths = historyPaths_.find(edge.src);
-        if (histPaths == historyPaths_.end()) {
-            createPaths(edge, interims);
-        } else {
-            buildPaths(histPaths->second, edge, interims);
+        const auto& vid = iter->getColumn(kVid);
+        if (&vid != srcVid) {
+            srcVid = &vid;
+            src = interner_.intern(vid);
+        }
+        auto dst = interner_.intern(edge.dst);
+        if (!reached_.contains(src)) {
+            auto node = extend(rootOf(src), src, dst, edge);
+            if (node != PathNode::kNoPrev) {
+                interims[dst].emplace_back(node);
+            }
+            continue;
+        }
+        auto histPaths = latestPaths_.find(src);
+        if (histPaths == latestPaths_.end()) {
+            continue;
+        }
+        for (auto prev : histPaths->second) {
+            auto node = extend(prev, src, dst, edge);
+            if (node != PathNode::kNoPrev) {
+                interims[dst].emplace_back(node);
+            }
         }
     }
 
+    // Only the paths found by this step are materialized
     for (auto& interim : interims) {
         Row row;
-        auto& dst = interim.first;
-        auto& paths = interim.second;
-        row.values.emplace_back(std::move(dst));
-        row.values.emplace_back(List(std::move(paths)));
-        ds.rows.emplace_back(std::move(row));
-
-        const auto& dstInDs = ds.rows.back().values.front();
-        for (auto& path : ds.rows.back().values.back().getList().values) {
-            historyPaths_[dstInDs].emplace_back(&path.getPath());
+        auto dst = interim.first;
+        List paths;
+        paths.values.reserve(interim.second.size());
+        for (auto node : interim.second) {
+            paths.values.emplace_back(toPath(node));
         }
+        reached_.insert(dst);
+        row.values.emplace_back(interner_.vid(dst));
+        row.values.emplace_back(std::move(paths));
+        ds.rows.emplace_back(std::move(row));
     }
+    latestPaths_ = std::move(interims);
     count_++;
     return finish(ResultBuilder().value(Value(std::move(ds))).finish());
 }
 
-void ProduceAllPathsExecutor::createPaths(const Edge& edge, Interims& interims) {
-    Path path;
-    path.src = Vertex(edge.src, {});
-    path.steps.emplace_back(Step(Vertex(edge.dst, {}), edge.type, edge.name, edge.ranking, {}));
-    if (noLoop_ && path.hasDuplicateVertices()) {
-        return;
+size_t ProduceAllPathsExecutor::rootOf(uint32_t vid) {
+    if (vid >= roots_.size()) {
+        roots_.resize(vid + 1, PathNode::kNoPrev);
     }
-    VLOG(1) << "Create path: " << path;
-    interims[edge.dst].emplace_back(std::move(path));
+    if (roots_[vid] != PathNode::kNoPrev) {
+        return roots_[vid];
+    }
+    PathNode root;
+    root.vid = vid;
+    root.vertexSig = vertexSigOf(vid);
+    arena_.emplace_back(std::move(root));
+    roots_[vid] = arena_.size() - 1;
+    return arena_.size() - 1;
 }
 
-void ProduceAllPathsExecutor::buildPaths(const std::vector<const Path*>& history,
-                                         const Edge& edge,
-                                         Interims& interims) {
-    for (auto* histPath : history) {
-        if (histPath->steps.size() < count_) {
-            continue;
-        } else {
-            Path path = *histPath;
-            path.steps.emplace_back(
-                Step(Vertex(edge.dst, {}), edge.type, edge.name, edge.ranking, {}));
-            if (path.hasDuplicateEdges()) {
-                continue;
-            }
-            if (noLoop_ && path.hasDuplicateVertices()) {
-                continue;
-            }
-            VLOG(1) << "Build path: " << path;
-            interims[edge.dst].emplace_back(std::move(path));
+size_t ProduceAllPathsExecutor::extend(size_t prev,
+                                       uint32_t src,
+                                       uint32_t dst,
+                                       const Edge& edge) {
+    auto vertexSig = vertexSigOf(dst);
+    auto edgeSig = edgeSigOf(src, dst, edge.type, edge.ranking);
+    const auto& last = arena_[prev];
+    if ((last.edgeSig & edgeSig) != 0 && hasEdge(prev, edge)) {
+        return PathNode::kNoPrev;
+    }
+    if (noLoop_ && (last.vertexSig & vertexSig) != 0 && hasVertex(prev, dst)) {
+        return PathNode::kNoPrev;
+    }
+
+    PathNode node;
+    node.prev = prev;
+    node.vid = dst;
+    node.type = edge.type;
+    node.name = edge.name;
+    node.ranking = edge.ranking;
+    node.vertexSig = last.vertexSig | vertexSig;
+    node.edgeSig = last.edgeSig | edgeSig;
+    arena_.emplace_back(std::move(node));
+    return arena_.size() - 1;
+}
+
+bool ProduceAllPathsExecutor::hasVertex(size_t node, uint32_t vid) const {
+    for (; node != PathNode::kNoPrev; node = arena_[node].prev) {
+        if (arena_[node].vid == vid) {
+            return true;
         }
     }
+    return false;
+}
+
+bool ProduceAllPathsExecutor::hasEdge(size_t node, const Edge& edge) const {
+    // Check by the path as the signatures may collide
+    auto path = toPath(node);
+    path.steps.emplace_back(Step(Vertex(edge.dst, {}), edge.type, edge.name, edge.ranking, {}));
+    return path.hasDuplicateEdges();
+}
+
+Path ProduceAllPathsExecutor::toPath(size_t node) const {
+    std::vector<size_t> nodes;
+    for (; node != PathNode::kNoPrev; node = arena_[node].prev) {
+        nodes.emplace_back(node);
+    }
+    DCHECK(!nodes.empty());
+    Path path;
+    path.src = Vertex(interner_.vid(arena_[nodes.back()].vid), {});
+    path.steps.reserve(nodes.size() - 1);
+    for (auto it = nodes.rbegin() + 1; it != nodes.rend(); ++it) {
+        const auto& step = arena_[*it];
+        path.steps.emplace_back(
+            Step(Vertex(interner_.vid(step.vid), {}), step.type, step.name, step.ranking, {}));
+    }
+    VLOG(1) << "Build path: " << path;
+    return path;
 }
 
 }  // namespace graph
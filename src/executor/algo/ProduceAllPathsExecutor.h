@@ -8,6 +8,7 @@
 #define EXECUTOR_ALGO_PRODUCEALLPATHSEXECUTOR_H_
 
 #include "executor/Executor.h"
+#include "util/VidInterner.h"
 
 namespace nebula {
 namespace graph {
@@ -19,19 +20,48 @@ public:
     folly::Future<Status> execute() override;
 
 private:
-    // k: dst, v: paths to dst
-    using HistoryPaths = std::unordered_map<Value, std::vector<const Path*>>;
+    // A path is stored as its last step and the index of the path before the step, so the
+    // paths sharing a prefix share its nodes in the arena. The first node of a path is the src
+    // without the edge. The signatures are the bits of the vertices and the edges on the path,
+    // which rule out most of the loop checks without walking the path. The vertices are kept by
+    // their ids in the interner.
+    struct PathNode {
+        static constexpr size_t kNoPrev = std::numeric_limits<size_t>::max();
 
-    // k: dst, v: paths to dst
-    using Interims = std::unordered_map<Value, std::vector<Value>>;
+        size_t          prev{kNoPrev};
+        uint32_t        vid{0};
+        EdgeType        type{0};
+        std::string     name;
+        EdgeRanking     ranking{0};
+        uint64_t        vertexSig{0};
+        uint64_t        edgeSig{0};
+    };
 
-    void createPaths(const Edge& edge, Interims& interims);
+    // k: the id of dst, v: paths to dst
+    using Interims = std::unordered_map<uint32_t, std::vector<size_t>>;
 
-    void buildPaths(const std::vector<const Path*>& history, const Edge& edge, Interims& interims);
+    size_t rootOf(uint32_t vid);
+
+    // Append the edge to the path, returns PathNode::kNoPrev if the edge is on the path already,
+    // or the dst is on the path when no loop is allowed.
+    size_t extend(size_t prev, uint32_t src, uint32_t dst, const Edge& edge);
+
+    bool hasVertex(size_t node, uint32_t vid) const;
+
+    bool hasEdge(size_t node, const Edge& edge) const;
+
+    Path toPath(size_t node) const;
 
     size_t count_{0};
-    HistoryPaths historyPaths_;
     bool noLoop_{false};
+    VidInterner interner_;
+    std::vector<PathNode> arena_;
+    // The first node of the paths from each src by its id, PathNode::kNoPrev if not a src
+    std::vector<size_t> roots_;
+    // The paths found by the latest step
+    Interims latestPaths_;
+    // The dsts of all the paths found
+    VidBitmap reached_;
 };
 }  // namespace graph
 }  // namespace nebula
@@ -25,10 +25,10 @@ std::vector<Path> ProduceSemiShortestPathExecutor::createPaths(
 }
 
 void ProduceSemiShortestPathExecutor::dstInCurrent(const Edge& edge,
+                                                   double weight,
                                                    CostPathMapType& currentCostPathMap) {
     auto& src = edge.src;
     auto& dst = edge.dst;
-    auto weight = 1;   // weight = weight_->getWeight();
     auto& srcPaths = historyCostPathMap_[src];
 
     for (auto& srcPath : srcPaths) {
@@ -75,10 +75,10 @@ void ProduceSemiShortestPathExecutor::dstInCurrent(const Edge& edge,
 }
 
 void ProduceSemiShortestPathExecutor::dstNotInHistory(const Edge& edge,
+                                                      double weight,
                                                       CostPathMapType& currentCostPathMap) {
     auto& src = edge.src;
     auto& dst = edge.dst;
-    auto weight = 1;   // weight = weight_->getWeight();
     auto& srcPaths = historyCostPathMap_[src];
     if (currentCostPathMap.find(dst) == currentCostPathMap.end()) {
         //  dst not in history and not in current
@@ -86,13 +86,12 @@ void ProduceSemiShortestPathExecutor::dstNotInHistory(const Edge& edge,
             auto cost = srcPath.second.cost_ + weight;
 
             std::vector<Path> newPaths = createPaths(srcPath.second.paths_, edge);
-            std::unordered_map<Value, CostPaths> temp = {
-                {srcPath.first, CostPaths(cost, newPaths)}};
-            currentCostPathMap.emplace(dst, std::move(temp));
+            // the other starts may have reached dst in this loop
+            currentCostPathMap[dst].emplace(srcPath.first, CostPaths(cost, newPaths));
         }
     } else {
         // dst in current
-        dstInCurrent(edge, currentCostPathMap);
+        dstInCurrent(edge, weight, currentCostPathMap);
     }
 }
 
@@ -111,10 +110,10 @@ void ProduceSemiShortestPathExecutor::removeSamePath(std::vector<Path>& paths,
 }
 
 void ProduceSemiShortestPathExecutor::dstInHistory(const Edge& edge,
+                                                   double weight,
                                                    CostPathMapType& currentCostPathMap) {
     auto& src = edge.src;
     auto& dst = edge.dst;
-    auto weight = 1;   // weight = weight_->getWeight();
     auto& srcPaths = historyCostPathMap_[src];
 
     if (currentCostPathMap.find(dst) == currentCostPathMap.end()) {
@@ -124,9 +123,7 @@ void ProduceSemiShortestPathExecutor::dstInHistory(const Edge& edge,
                 //  (dst, startVid)'s path not in history
                 auto newCost = srcPath.second.cost_ + weight;
                 std::vector<Path> newPaths = createPaths(srcPath.second.paths_, edge);
-                std::unordered_map<Value, CostPaths> temp = {
-                    {srcPath.first, CostPaths(newCost, newPaths)}};
-                currentCostPathMap.emplace(dst, std::move(temp));
+                currentCostPathMap[dst].emplace(srcPath.first, CostPaths(newCost, newPaths));
             } else {
                 //  (dst, startVid)'s path in history, compare cost
                 auto newCost = srcPath.second.cost_ + weight;
@@ -136,9 +133,7 @@ void ProduceSemiShortestPathExecutor::dstInHistory(const Edge& edge,
                 } else if (newCost < historyCost) {
                     // update (dst, startVid)'s path
                     std::vector<Path> newPaths = createPaths(srcPath.second.paths_, edge);
-                    std::unordered_map<Value, CostPaths> temp = {
-                        {srcPath.first, CostPaths(newCost, newPaths)}};
-                    currentCostPathMap.emplace(dst, std::move(temp));
+                    currentCostPathMap[dst].emplace(srcPath.first, CostPaths(newCost, newPaths));
                 } else {
                     std::vector<Path> newPaths = createPaths(srcPath.second.paths_, edge);
                     // if same path in history, remove it
@@ -146,15 +141,13 @@ void ProduceSemiShortestPathExecutor::dstInHistory(const Edge& edge,
                     if (newPaths.empty()) {
                         continue;
                     }
-                    std::unordered_map<Value, CostPaths> temp = {
-                        {srcPath.first, CostPaths(newCost, newPaths)}};
-                    currentCostPathMap.emplace(dst, std::move(temp));
+                    currentCostPathMap[dst].emplace(srcPath.first, CostPaths(newCost, newPaths));
                 }
             }
         }
     } else {
         // dst in current
-        dstInCurrent(edge, currentCostPathMap);
+        dstInCurrent(edge, weight, currentCostPathMap);
     }
 }
 
@@ -201,6 +194,9 @@ folly::Future<Status> ProduceSemiShortestPathExecutor::execute() {
     VLOG(1) << "current: " << node()->outputVar();
     VLOG(1) << "input: " << pssp->inputVar();
     DCHECK(!!iter);
+    if (pssp->trackSources()) {
+        return propagateSources(iter.get());
+    }
 
     CostPathMapType currentCostPathMap;
 
@@ -212,7 +208,19 @@ folly::Future<Status> ProduceSemiShortestPathExecutor::execute() {
         auto& edge = edgeVal.getEdge();
         auto& src = edge.src;
         auto& dst = edge.dst;
-        auto weight = 1;
+        double weight = 1;
+        if (!pssp->weightProp().empty()) {
+            auto found = edge.props.find(pssp->weightProp());
+            if (found == edge.props.end() || !(found->second.isInt() || found->second.isFloat())) {
+                return Status::Error("The weight `%s' of edge `%s' should be numeric",
+                                     pssp->weightProp().c_str(), edge.name.c_str());
+            }
+            weight = found->second.isInt() ? found->second.getInt() : found->second.getFloat();
+            if (weight < 0) {
+                return Status::Error("The weight `%s' of edge `%s' can't be negative",
+                                     pssp->weightProp().c_str(), edge.name.c_str());
+            }
+        }
 
         if (historyCostPathMap_.find(src) == historyCostPathMap_.end()) {
             // src not in history, now src must be startVid
@@ -229,6 +237,7 @@ folly::Future<Status> ProduceSemiShortestPathExecutor::execute() {
                     if (weight == currentCost) {
                         currentCostPathMap[dst][src].paths_.emplace_back(std::move(path));
                     } else if (weight < currentCost) {
+                        currentCostPathMap[dst][src].cost_ = weight;
                         std::vector<Path> tempPaths ={std::move(path)};
                         currentCostPathMap[dst][src].paths_.swap(tempPaths);
                     } else {
@@ -242,9 +251,9 @@ folly::Future<Status> ProduceSemiShortestPathExecutor::execute() {
             }
         } else {
             if (historyCostPathMap_.find(dst) == historyCostPathMap_.end()) {
-                dstNotInHistory(edge, currentCostPathMap);
+                dstNotInHistory(edge, weight, currentCostPathMap);
             } else {
-                dstInHistory(edge, currentCostPathMap);
+                dstInHistory(edge, weight, currentCostPathMap);
             }
         }
     }
@@ -276,6 +285,54 @@ folly::Future<Status> ProduceSemiShortestPathExecutor::execute() {
     return finish(ResultBuilder().value(Value(std::move(ds))).finish());
 }
 
+folly::Future<Status> ProduceSemiShortestPathExecutor::propagateSources(Iterator* iter) {
+    if (visited_.empty()) {
+        // The srcs of the first step are the starts, each of which takes a bit
+        size_t index = 0;
+        for (; iter->valid(); iter->next()) {
+            auto& src = iter->getColumn(kVid);
+            if (frontier_.find(src) == frontier_.end()) {
+                frontier_[src].set(index++);
+            }
+        }
+        visited_ = frontier_;
+        iter->reset();
+    }
+
+    DataSet ds;
+    ds.colNames = node()->colNames();
+    std::unordered_map<Value, SourceBits> next;
+    for (; iter->valid(); iter->next()) {
+        auto edgeVal = iter->getEdge();
+        if (!edgeVal.isEdge()) {
+            continue;
+        }
+        auto& edge = edgeVal.getEdge();
+        auto srcBits = frontier_.find(edge.src);
+        if (srcBits == frontier_.end()) {
+            continue;
+        }
+        // The starts reaching dst first by this step, the ones reached dst in the former steps
+        // are not on the shortest paths
+        auto visited = visited_.find(edge.dst);
+        auto bits = visited == visited_.end() ? srcBits->second
+                                              : srcBits->second.minus(visited->second);
+        if (!bits.any()) {
+            continue;
+        }
+        next[edge.dst] |= bits;
+        Row row;
+        row.values.emplace_back(edge.dst);
+        row.values.emplace_back(std::move(edgeVal));
+        row.values.emplace_back(bits.encode());
+        ds.rows.emplace_back(std::move(row));
+    }
+    for (auto& vidBits : next) {
+        visited_[vidBits.first] |= vidBits.second;
+    }
+    frontier_ = std::move(next);
+    return finish(ResultBuilder().value(Value(std::move(ds))).finish());
+}
 
 }   // namespace graph
 }   // namespace nebula
@@ -8,6 +8,7 @@
 #define EXECUTOR_ALGO_PRODUCESEMISHORTESTPATHEXECUTOR_H_
 
 #include "executor/Executor.h"
+#include "util/SourceBits.h"
 
 namespace nebula {
 namespace graph {
@@ -43,11 +44,15 @@ public:
     using CostPathMapPtr = std::unordered_map<Value, std::unordered_map<Value, CostPathsPtr>>;
 
 private:
-    void dstNotInHistory(const Edge& edge, CostPathMapType&);
+    // Propagate the starts reaching the vertices by one step, see
+    // ProduceSemiShortestPath::trackSources
+    folly::Future<Status> propagateSources(Iterator* iter);
 
-    void dstInHistory(const Edge& edge, CostPathMapType&);
+    void dstNotInHistory(const Edge& edge, double weight, CostPathMapType&);
 
-    void dstInCurrent(const Edge& edge, CostPathMapType&);
+    void dstInHistory(const Edge& edge, double weight, CostPathMapType&);
+
+    void dstInCurrent(const Edge& edge, double weight, CostPathMapType&);
 
     void updateHistory(const Value& dst, const Value& src, double cost, Value& paths);
 
@@ -59,7 +64,10 @@ private:
     // dst : {src : <cost, {Path*}>}
     CostPathMapPtr historyCostPathMap_;
 
-    // std::unique_ptr<IWeight> weight_;
+    // vid : the starts reached it, for tracking the sources only
+    std::unordered_map<Value, SourceBits> visited_;
+    // vid : the starts reached it in the latest step
+    std::unordered_map<Value, SourceBits> frontier_;
 };
 
 }   // namespace graph
@@ -35,13 +35,13 @@ folly::Future<Status> SubgraphExecutor::execute() {
     if (currentStep == 1) {
         for (; iter->valid(); iter->next()) {
             const auto& src = iter->getColumn(nebula::kVid);
-            historyVids_.emplace(src);
+            historyVids_.insert(interner_.intern(src));
         }
         iter->reset();
     }
     for (; iter->valid(); iter->next()) {
         const auto& dst = iter->getEdgeProp("*", nebula::kDst);
-        if (historyVids_.emplace(dst).second) {
+        if (historyVids_.insert(interner_.intern(dst))) {
             Row row;
             row.values.emplace_back(std::move(dst));
             ds.rows.emplace_back(std::move(row));
@@ -63,7 +63,8 @@ void SubgraphExecutor::oneMoreStep() {
     builder.value(iter->valuePtr());
     while (iter->valid()) {
         const auto& dst = iter->getEdgeProp("*", nebula::kDst);
-        if (historyVids_.find(dst) == historyVids_.end()) {
+        auto id = interner_.find(dst);
+        if (id == VidInterner::kNotFound || !historyVids_.contains(id)) {
             iter->unstableErase();
         } else {
             iter->next();
@@ -8,6 +8,7 @@
 #define EXECUTOR_ALGO_SUBGRAPHEXECUTOR_H_
 
 #include "executor/Executor.h"
+#include "util/VidInterner.h"
 
 namespace nebula {
 namespace graph {
@@ -22,7 +23,8 @@ private:
     void oneMoreStep();
 
 private:
-    std::unordered_set<Value>   historyVids_;
+    VidInterner                 interner_;
+    VidBitmap                   historyVids_;
 };
 
 }   // namespace graph
@@ -6,12 +6,16 @@
 
 #include "executor/query/AggregateExecutor.h"
 
+#include <folly/String.h>
+#include <folly/hash/Hash.h>
+
 #include "common/datatypes/List.h"
 #include "common/expression/AggregateExpression.h"
 #include "context/QueryExpressionContext.h"
 #include "context/Result.h"
 #include "planner/PlanNode.h"
 #include "planner/Query.h"
+#include "util/ExpressionUtils.h"
 #include "util/ScopedTimer.h"
 
 namespace nebula {
@@ -24,6 +28,9 @@ folly::Future<Status> AggregateExecutor::execute() {
     auto groupItems = agg->groupItems();
     auto iter = ectx_->getResult(agg->inputVar()).iter();
     DCHECK(!!iter);
+    if (shouldRunMorsels(iter->size()) && isConcurrentEvaluable()) {
+        return aggregateMorsels(std::move(iter));
+    }
     QueryExpressionContext ctx(ectx_);
 
     std::unordered_map<List, std::vector<std::unique_ptr<AggData>>, std::hash<nebula::List>> result;
@@ -68,5 +75,155 @@ folly::Future<Status> AggregateExecutor::execute() {
     return finish(ResultBuilder().value(Value(std::move(ds))).finish());
 }
 
+bool AggregateExecutor::isConcurrentEvaluable() const {
+    auto* agg = asNode<Aggregate>(node());
+    auto evaluable = [](const Expression* expr) {
+        return ExpressionUtils::isConcurrentEvaluable(expr);
+    };
+    return std::all_of(agg->groupKeys().begin(), agg->groupKeys().end(), evaluable) &&
+           std::all_of(agg->groupItems().begin(), agg->groupItems().end(), evaluable);
+}
+
+folly::Future<Status> AggregateExecutor::aggregateMorsels(std::unique_ptr<Iterator> iter) {
+    auto numPartitions = (iter->size() + morselSize() - 1) / morselSize();
+    auto scatter = [this, numPartitions](Iterator* morsel) {
+        return this->scatter(morsel, numPartitions);
+    };
+    auto gather = [this, numPartitions](std::vector<Partitions> morselParts) {
+        auto parts = std::make_shared<std::vector<Partitions>>(std::move(morselParts));
+        std::vector<folly::Future<std::vector<Row>>> futures;
+        futures.reserve(numPartitions);
+        for (size_t i = 0; i < numPartitions; ++i) {
+            futures.emplace_back(folly::via(runner(), [this, i, parts]() {
+                return aggregatePartition(i, parts.get());
+            }));
+        }
+        return folly::collect(futures).via(runner()).then(
+            [this](std::vector<std::vector<Row>> partRows) {
+                SCOPED_TIMER(&execTime_);
+                DataSet ds;
+                ds.colNames = asNode<Aggregate>(node())->colNames();
+                for (auto& rows : partRows) {
+                    ds.rows.insert(ds.rows.end(),
+                                   std::make_move_iterator(rows.begin()),
+                                   std::make_move_iterator(rows.end()));
+                }
+                return finish(ResultBuilder().value(Value(std::move(ds))).finish());
+            });
+    };
+    return runMorsels(iter.get(), std::move(scatter), std::move(gather));
+}
+
+AggregateExecutor::Partitions AggregateExecutor::scatter(Iterator* morsel,
+                                                         size_t numPartitions) const {
+    auto* agg = asNode<Aggregate>(node());
+    // The expression caches its evaluated result, so each morsel evaluates on the clones.
+    // Only the arguments of aggregate functions are evaluated here, the constant argument
+    // such as `*' of COUNT(*) is left to the aggregate function.
+    std::vector<std::unique_ptr<Expression>> keys;
+    for (auto* key : agg->groupKeys()) {
+        keys.emplace_back(key->clone());
+    }
+    std::vector<std::unique_ptr<Expression>> items;
+    for (auto* item : agg->groupItems()) {
+        if (item->kind() == Expression::Kind::kAggregate) {
+            auto* arg = static_cast<AggregateExpression*>(item)->arg();
+            items.emplace_back(ExpressionUtils::isConstExpr(arg) ? nullptr : arg->clone());
+        } else {
+            items.emplace_back(item->clone());
+        }
+    }
+
+    Partitions parts(numPartitions);
+    QueryExpressionContext ctx(ectx_);
+    for (; morsel->valid(); morsel->next()) {
+        GroupRow row;
+        row.key.values.reserve(keys.size());
+        for (auto& key : keys) {
+            row.key.values.emplace_back(key->eval(ctx(morsel)));
+        }
+        row.values.reserve(items.size());
+        for (auto& item : items) {
+            row.values.emplace_back(item == nullptr ? Value::kEmpty : item->eval(ctx(morsel)));
+        }
+        auto hash = std::hash<List>()(row.key);
+        auto part = folly::hash::twang_mix64(hash) % numPartitions;
+        parts[part].emplace_back(std::move(row));
+    }
+    return parts;
+}
+
+std::vector<Row> AggregateExecutor::aggregatePartition(size_t part,
+                                                       std::vector<Partitions>* morsels) const {
+    auto* agg = asNode<Aggregate>(node());
+    auto& groupItems = agg->groupItems();
+
+    // Collect the rows of partition `part' in the order of input, only this task touches them
+    std::vector<List> keys;
+    DataSet args;
+    for (size_t i = 0; i < groupItems.size(); ++i) {
+        args.colNames.emplace_back(folly::stringPrintf("__agg_arg_%lu", i));
+    }
+    for (auto& morselParts : *morsels) {
+        for (auto& groupRow : morselParts[part]) {
+            keys.emplace_back(std::move(groupRow.key));
+            Row row;
+            row.values = std::move(groupRow.values);
+            args.rows.emplace_back(std::move(row));
+        }
+    }
+
+    // Aggregate functions over the evaluated arguments
+    std::vector<std::unique_ptr<Expression>> aggItems;
+    for (size_t i = 0; i < groupItems.size(); ++i) {
+        auto* item = groupItems[i];
+        if (item->kind() != Expression::Kind::kAggregate) {
+            aggItems.emplace_back(nullptr);
+            continue;
+        }
+        auto aggItem = item->clone();
+        auto* aggExpr = static_cast<AggregateExpression*>(aggItem.get());
+        if (!ExpressionUtils::isConstExpr(aggExpr->arg())) {
+            aggExpr->setArg(ExpressionUtils::inputPropExpr(args.colNames[i]).release());
+        }
+        aggItems.emplace_back(std::move(aggItem));
+    }
+
+    std::unordered_map<List, std::vector<std::unique_ptr<AggData>>, std::hash<nebula::List>>
+        result;
+    SequentialIter iter(std::make_shared<Value>(std::move(args)));
+    QueryExpressionContext ctx(ectx_);
+    for (size_t i = 0; iter.valid(); iter.next(), ++i) {
+        auto it = result.find(keys[i]);
+        if (it == result.end()) {
+            std::vector<std::unique_ptr<AggData>> cols;
+            for (size_t j = 0; j < groupItems.size(); ++j) {
+                cols.emplace_back(new AggData());
+            }
+            it = result.emplace(std::move(keys[i]), std::move(cols)).first;
+        }
+        auto& cols = it->second;
+        for (size_t j = 0; j < aggItems.size(); ++j) {
+            if (aggItems[j] != nullptr) {
+                static_cast<AggregateExpression*>(aggItems[j].get())->setAggData(cols[j].get());
+                aggItems[j]->eval(ctx(&iter));
+            } else {
+                cols[j]->setResult(iter.getColumn(static_cast<int32_t>(j)));
+            }
+        }
+    }
+
+    std::vector<Row> rows;
+    rows.reserve(result.size());
+    for (auto& kv : result) {
+        Row row;
+        for (auto& v : kv.second) {
+            row.values.emplace_back(v->result());
+        }
+        rows.emplace_back(std::move(row));
+    }
+    return rows;
+}
+
 }   // namespace graph
 }   // namespace nebula
@@ -18,6 +18,27 @@ public:
         : Executor("AggregateExecutor", node, qctx) {}
 
     folly::Future<Status> execute() override;
+
+private:
+    // The evaluated group key and group items of a row. For the aggregate item, it's the
+    // evaluated argument of the aggregate function.
+    struct GroupRow {
+        List                  key;
+        std::vector<Value>    values;
+    };
+
+    // partition id -> rows
+    using Partitions = std::vector<std::vector<GroupRow>>;
+
+    bool isConcurrentEvaluable() const;
+
+    // Scatter the rows into partitions by the group key in morsels, then aggregate each
+    // partition in parallel. The groups never span partitions, so there is nothing to merge.
+    folly::Future<Status> aggregateMorsels(std::unique_ptr<Iterator> iter);
+
+    Partitions scatter(Iterator* morsel, size_t numPartitions) const;
+
+    std::vector<Row> aggregatePartition(size_t part, std::vector<Partitions>* morsels) const;
 };
 
 }   // namespace graph
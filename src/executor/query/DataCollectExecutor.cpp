@@ -7,10 +7,56 @@
 #include "executor/query/DataCollectExecutor.h"
 
 #include "planner/Query.h"
+#include "service/GraphFlags.h"
 #include "util/ScopedTimer.h"
 
 namespace nebula {
 namespace graph {
+
+namespace {
+
+using EdgeKey = std::tuple<Value, EdgeType, EdgeRanking, Value>;
+
+EdgeKey edgeKey(const Edge& edge) {
+    return std::make_tuple(edge.src, edge.type, edge.ranking, edge.dst);
+}
+
+constexpr size_t kNumShards = 64;
+
+// The first step where each key appears, sharded by the hash of the key to be inserted
+// concurrently. The lookups are not locked, so they must be after all the insertions.
+template <typename Key>
+class FirstStepMap final {
+public:
+    explicit FirstStepMap(size_t numShards) : shards_(numShards) {}
+
+    void insert(Key key, size_t step) {
+        auto& shard = shards_[std::hash<Key>()(key) % shards_.size()];
+        std::lock_guard<std::mutex> guard(shard.lock);
+        auto ret = shard.steps.emplace(std::move(key), step);
+        if (!ret.second && step < ret.first->second) {
+            ret.first->second = step;
+        }
+    }
+
+    size_t firstStep(const Key& key) const {
+        const auto& steps = shards_[std::hash<Key>()(key) % shards_.size()].steps;
+        auto found = steps.find(key);
+        DCHECK(found != steps.end());
+        return found->second;
+    }
+
+private:
+    struct Shard {
+        std::mutex                          lock;
+        std::unordered_map<Key, size_t>     steps;
+    };
+
+    std::vector<Shard>  shards_;
+};
+
+}   // namespace
+
 folly::Future<Status> DataCollectExecutor::execute() {
     return doCollect().ensure([this] () {
         result_ = Value::kEmpty;
@@ -26,7 +72,11 @@ folly::Future<Status> DataCollectExecutor::doCollect() {
     auto vars = dc->vars();
     switch (dc->collectKind()) {
         case DataCollect::CollectKind::kSubgraph: {
-            NG_RETURN_IF_ERROR(collectSubgraph(vars));
+            auto steps = subgraphSteps(vars);
+            if (shouldCollectSubgraphInParallel(steps)) {
+                return collectSubgraphInParallel(std::move(steps));
+            }
+            NG_RETURN_IF_ERROR(collectSubgraph(steps));
             break;
         }
         case DataCollect::CollectKind::kRowBasedMove: {
@@ -37,6 +87,10 @@ folly::Future<Status> DataCollectExecutor::doCollect() {
             NG_RETURN_IF_ERROR(collectMToN(vars, dc->mToN(), dc->distinct()));
             break;
         }
+        case DataCollect::CollectKind::kMToNCount: {
+            NG_RETURN_IF_ERROR(countMToN(vars, dc->mToN()));
+            break;
+        }
         case DataCollect::CollectKind::kBFSShortest: {
             NG_RETURN_IF_ERROR(collectBFSShortest(vars));
             break;
@@ -57,52 +111,162 @@ folly::Future<Status> DataCollectExecutor::doCollect() {
     return finish(builder.finish());
 }
 
-Status DataCollectExecutor::collectSubgraph(const std::vector<std::string>& vars) {
-    DataSet ds;
-    ds.colNames = std::move(colNames_);
-    // the subgraph not need duplicate vertices or edges, so dedup here directly
-    std::unordered_set<Value> uniqueVids;
-    std::unordered_set<std::tuple<Value, EdgeType, EdgeRanking, Value>> uniqueEdges;
+std::vector<const Result*> DataCollectExecutor::subgraphSteps(
+    const std::vector<std::string>& vars) const {
+    std::vector<const Result*> steps;
     for (auto i = vars.begin(); i != vars.end(); ++i) {
         const auto& hist = ectx_->getHistory(*i);
         for (auto j = hist.begin(); j != hist.end(); ++j) {
             if (i == vars.begin() && j == hist.end() - 1) {
                 continue;
             }
-            auto iter = (*j).iter();
+            steps.emplace_back(&*j);
+        }
+    }
+    return steps;
+}
+
+bool DataCollectExecutor::shouldCollectSubgraphInParallel(
+    const std::vector<const Result*>& steps) const {
+    if (FLAGS_min_parallel_subgraph_rows <= 0 || steps.size() < 2) {
+        return false;
+    }
+    size_t numRows = 0;
+    for (auto* step : steps) {
+        numRows += step->size();
+    }
+    return numRows >= static_cast<size_t>(FLAGS_min_parallel_subgraph_rows);
+}
+
+Status DataCollectExecutor::collectSubgraph(const std::vector<const Result*>& steps) {
+    DataSet ds;
+    ds.colNames = std::move(colNames_);
+    // the subgraph not need duplicate vertices or edges, so dedup here directly
+    std::unordered_set<Value> uniqueVids;
+    std::unordered_set<EdgeKey> uniqueEdges;
+    for (auto* step : steps) {
+        auto iter = step->iter();
+        if (!iter->isGetNeighborsIter()) {
+            std::stringstream msg;
+            msg << "Iterator should be kind of GetNeighborIter, but was: " << iter->kind();
+            return Status::Error(msg.str());
+        }
+        List vertices;
+        List edges;
+        auto* gnIter = static_cast<GetNeighborsIter*>(iter.get());
+        auto originVertices = gnIter->getVertices();
+        for (auto& v : originVertices.values) {
+            if (!v.isVertex()) {
+                continue;
+            }
+            if (uniqueVids.emplace(v.getVertex().vid).second) {
+                vertices.emplace_back(std::move(v));
+            }
+        }
+        auto originEdges = gnIter->getEdges();
+        for (auto& edge : originEdges.values) {
+            if (!edge.isEdge()) {
+                continue;
+            }
+            if (uniqueEdges.emplace(edgeKey(edge.getEdge())).second) {
+                edges.emplace_back(std::move(edge));
+            }
+        }
+        ds.rows.emplace_back(Row({std::move(vertices), std::move(edges)}));
+    }
+    result_.setDataSet(std::move(ds));
+    return Status::OK();
+}
+
+folly::Future<Status> DataCollectExecutor::collectSubgraphInParallel(
+    std::vector<const Result*> steps) {
+    struct Collected {
+        std::vector<List> vertices;
+        std::vector<List> edges;
+        FirstStepMap<Value> firstVids{kNumShards};
+        FirstStepMap<EdgeKey> firstEdges{kNumShards};
+    };
+    auto numSteps = steps.size();
+    auto collected = std::make_shared<Collected>();
+    collected->vertices.resize(numSteps);
+    collected->edges.resize(numSteps);
+
+    // Dedup the vertices and edges of each step, and record the first step of them
+    std::vector<folly::Future<Status>> futures;
+    futures.reserve(numSteps);
+    for (size_t i = 0; i < numSteps; ++i) {
+        futures.emplace_back(folly::via(runner(), [i, step = steps[i], collected]() {
+            auto iter = step->iter();
             if (!iter->isGetNeighborsIter()) {
                 std::stringstream msg;
                 msg << "Iterator should be kind of GetNeighborIter, but was: " << iter->kind();
                 return Status::Error(msg.str());
             }
-            List vertices;
-            List edges;
             auto* gnIter = static_cast<GetNeighborsIter*>(iter.get());
-            auto originVertices = gnIter->getVertices();
-            for (auto& v : originVertices.values) {
+            std::unordered_set<Value> uniqueVids;
+            auto& vertices = collected->vertices[i];
+            for (auto& v : gnIter->getVertices().values) {
                 if (!v.isVertex()) {
                     continue;
                 }
-                if (uniqueVids.emplace(v.getVertex().vid).second) {
-                    vertices.emplace_back(std::move(v));
+                const auto& vid = v.getVertex().vid;
+                if (uniqueVids.emplace(vid).second) {
+                    collected->firstVids.insert(vid, i);
+                    vertices.values.emplace_back(std::move(v));
                 }
             }
-            auto originEdges = gnIter->getEdges();
-            for (auto& edge : originEdges.values) {
+            std::unordered_set<EdgeKey> uniqueEdges;
+            auto& edges = collected->edges[i];
+            for (auto& edge : gnIter->getEdges().values) {
                 if (!edge.isEdge()) {
                     continue;
                 }
-                const auto& e = edge.getEdge();
-                auto edgeKey = std::make_tuple(e.src, e.type, e.ranking, e.dst);
-                if (uniqueEdges.emplace(std::move(edgeKey)).second) {
-                    edges.emplace_back(std::move(edge));
+                auto key = edgeKey(edge.getEdge());
+                if (uniqueEdges.emplace(key).second) {
+                    collected->firstEdges.insert(std::move(key), i);
+                    edges.values.emplace_back(std::move(edge));
                 }
             }
-            ds.rows.emplace_back(Row({std::move(vertices), std::move(edges)}));
-        }
+            return Status::OK();
+        }));
     }
-    result_.setDataSet(std::move(ds));
-    return Status::OK();
+
+    return folly::collect(futures).via(runner()).thenValue(
+        [this, numSteps, collected](std::vector<Status>&& statuses) -> folly::Future<Status> {
+            for (auto& status : statuses) {
+                NG_RETURN_IF_ERROR(status);
+            }
+            std::vector<folly::Future<Row>> rows;
+            rows.reserve(numSteps);
+            for (size_t i = 0; i < numSteps; ++i) {
+                rows.emplace_back(folly::via(runner(), [i, collected]() {
+                    auto& vertices = collected->vertices[i].values;
+                    auto seenBefore = [i, &collected](const Value& v) {
+                        return collected->firstVids.firstStep(v.getVertex().vid) < i;
+                    };
+                    vertices.erase(std::remove_if(vertices.begin(), vertices.end(), seenBefore),
+                                   vertices.end());
+                    auto& edges = collected->edges[i].values;
+                    auto edgeSeenBefore = [i, &collected](const Value& e) {
+                        return collected->firstEdges.firstStep(edgeKey(e.getEdge())) < i;
+                    };
+                    edges.erase(std::remove_if(edges.begin(), edges.end(), edgeSeenBefore),
+                                edges.end());
+                    return Row({std::move(collected->vertices[i]), std::move(collected->edges[i])});
+                }));
+            }
+            return folly::collect(rows).via(runner()).thenValue(
+                [this](std::vector<Row>&& collectedRows) {
+                    SCOPED_TIMER(&execTime_);
+                    DataSet ds;
+                    ds.colNames = asNode<DataCollect>(node())->colNames();
+                    ds.rows = std::move(collectedRows);
+                    return finish(ResultBuilder()
+                                      .value(Value(std::move(ds)))
+                                      .iter(Iterator::Kind::kSequential)
+                                      .finish());
+                });
+        });
 }
 
 Status DataCollectExecutor::rowBasedMove(const std::vector<std::string>& vars) {
@@ -170,6 +334,36 @@ Status DataCollectExecutor::collectMToN(const std::vector<std::string>& vars,
     return Status::OK();
 }
 
+Status DataCollectExecutor::countMToN(const std::vector<std::string>& vars,
+                                      StepClause::MToN* mToN) {
+    // Only the sizes of the steps are read, no row is moved
+    int64_t count = 0;
+    for (auto& var : vars) {
+        auto& hist = ectx_->getHistory(var);
+        DCHECK_GE(mToN->mSteps, 1);
+        for (auto i = mToN->mSteps - 1; i < mToN->nSteps; ++i) {
+            const auto& value = hist[i].value();
+            if (!value.isDataSet()) {
+                std::stringstream msg;
+                msg << "Value should be kind of DataSet, but was: " << value.type();
+                return Status::Error(msg.str());
+            }
+            count += value.getDataSet().rows.size();
+        }
+    }
+
+    DataSet ds;
+    ds.colNames = std::move(colNames_);
+    // The same as COUNT(*) of no group key, which yields no row for the empty input
+    if (count > 0) {
+        Row row;
+        row.values.resize(ds.colNames.size(), count);
+        ds.rows.emplace_back(std::move(row));
+    }
+    result_.setDataSet(std::move(ds));
+    return Status::OK();
+}
+
 Status DataCollectExecutor::collectBFSShortest(const std::vector<std::string>& vars) {
     // Will rewrite this method once we implement returning the props for the path.
     return rowBasedMove(vars);
@@ -237,6 +431,7 @@ Status DataCollectExecutor::collectMultiplePairShortestPath(const std::vector<st
                 } else {
                     auto oldCost = shortestPath[src][dst].first;
                     if (cost < oldCost) {
+                        shortestPath[src][dst].first = cost;
                         std::vector<Path> tempPaths = {std::move(path)};
                         shortestPath[src][dst].second.swap(tempPaths);
                     } else if (cost == oldCost) {
@@ -21,12 +21,23 @@ public:
 private:
     folly::Future<Status> doCollect();
 
-    Status collectSubgraph(const std::vector<std::string>& vars);
+    // The results of the steps of the subgraph in order
+    std::vector<const Result*> subgraphSteps(const std::vector<std::string>& vars) const;
+
+    bool shouldCollectSubgraphInParallel(const std::vector<const Result*>& steps) const;
+
+    Status collectSubgraph(const std::vector<const Result*>& steps);
+
+    // Collect the steps concurrently, then keep each vertex or edge in the first step where
+    // it appears, which is the same as the serial collection
+    folly::Future<Status> collectSubgraphInParallel(std::vector<const Result*> steps);
 
     Status rowBasedMove(const std::vector<std::string>& vars);
 
     Status collectMToN(const std::vector<std::string>& vars, StepClause::MToN* mToN, bool distinct);
 
+    Status countMToN(const std::vector<std::string>& vars, StepClause::MToN* mToN);
+
     Status collectBFSShortest(const std::vector<std::string>& vars);
 
     Status collectAllPaths(const std::vector<std::string>& vars);
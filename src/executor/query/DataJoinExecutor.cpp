@@ -6,72 +6,193 @@
 
 #include "executor/query/DataJoinExecutor.h"
 
+#include <folly/hash/Hash.h>
+
 #include "planner/Query.h"
 #include "context/QueryExpressionContext.h"
 #include "context/Iterator.h"
+#include "service/GraphFlags.h"
+#include "util/ExpressionUtils.h"
 #include "util/ScopedTimer.h"
 
 namespace nebula {
 namespace graph {
 folly::Future<Status> DataJoinExecutor::execute() {
-    return doInnerJoin();
+    switch (asNode<DataJoin>(node())->joinKind()) {
+        case DataJoin::JoinKind::kInner:
+            return doInnerJoin();
+        case DataJoin::JoinKind::kLeft:
+            return doLeftJoin();
+        case DataJoin::JoinKind::kSemi:
+            return doSemiJoin(false);
+        case DataJoin::JoinKind::kAnti:
+            return doSemiJoin(true);
+    }
+    return error(Status::Error("Unknown join kind"));
 }
 
 Status DataJoinExecutor::close() {
     exchange_ = false;
+    numPartitions_ = 0;
+    hashTable_.reset();
+    morsels_.clear();
     return Executor::close();
 }
 
+Status DataJoinExecutor::joinIters(const DataJoin* dataJoin,
+                                   std::unique_ptr<Iterator>* lhsIter,
+                                   std::unique_ptr<Iterator>* rhsIter) const {
+    VLOG(1) << "DataJoin ColNames : " << folly::join(",", dataJoin->colNames());
+    VLOG(1) << "lhs hist: " << ectx_->getHistory(dataJoin->leftVar().first).size();
+    VLOG(1) << "rhs hist: " << ectx_->getHistory(dataJoin->rightVar().first).size();
+    *lhsIter = ectx_
+                   ->getVersionedResult(dataJoin->leftVar().first, dataJoin->leftVar().second)
+                   .iter();
+    DCHECK(!!*lhsIter);
+    VLOG(1) << "lhs: " << dataJoin->leftVar().first << " " << (*lhsIter)->size();
+    *rhsIter = ectx_
+                   ->getVersionedResult(dataJoin->rightVar().first, dataJoin->rightVar().second)
+                   .iter();
+    DCHECK(!!*rhsIter);
+    VLOG(1) << "rhs: " << dataJoin->rightVar().first << " " << (*rhsIter)->size();
+    for (const auto* iter : {lhsIter->get(), rhsIter->get()}) {
+        if (iter->isGetNeighborsIter() || iter->isDefaultIter()) {
+            std::stringstream ss;
+            ss << "Join executor does not support " << iter->kind();
+            return Status::Error(ss.str());
+        }
+    }
+    return Status::OK();
+}
+
 folly::Future<Status> DataJoinExecutor::doInnerJoin() {
     SCOPED_TIMER(&execTime_);
 
     auto* dataJoin = asNode<DataJoin>(node());
-    auto colNames = dataJoin->colNames();
-    VLOG(1) << "DataJoin ColNames : " << folly::join(",", colNames);
-    VLOG(1) << "lhs hist: " << ectx_->getHistory(dataJoin->leftVar().first).size();
-    VLOG(1) << "rhs hist: " << ectx_->getHistory(dataJoin->rightVar().first).size();
-    auto lhsIter = ectx_
-                       ->getVersionedResult(dataJoin->leftVar().first,
-                                            dataJoin->leftVar().second)
-                       .iter();
-    DCHECK(!!lhsIter);
-    VLOG(1) << "lhs: " << dataJoin->leftVar().first << " " << lhsIter->size();
-    if (lhsIter->isGetNeighborsIter() || lhsIter->isDefaultIter()) {
-        std::stringstream ss;
-        ss << "Join executor does not support " << lhsIter->kind();
-        return error(Status::Error(ss.str()));
-    }
-    auto rhsIter = ectx_
-                       ->getVersionedResult(dataJoin->rightVar().first,
-                                            dataJoin->rightVar().second)
-                       .iter();
-    DCHECK(!!rhsIter);
-    VLOG(1) << "rhs: " << dataJoin->rightVar().first << " " << rhsIter->size();
-    if (lhsIter->isGetNeighborsIter() || lhsIter->isDefaultIter()) {
-        std::stringstream ss;
-        ss << "Join executor does not support " << lhsIter->kind();
-        return error(Status::Error(ss.str()));
-    }
-
-    auto resultIter = std::make_unique<JoinIter>(std::move(colNames));
+    std::unique_ptr<Iterator> lhsIter;
+    std::unique_ptr<Iterator> rhsIter;
+    auto status = joinIters(dataJoin, &lhsIter, &rhsIter);
+    if (!status.ok()) {
+        return error(std::move(status));
+    }
+
+    auto resultIter = std::make_unique<JoinIter>(dataJoin->colNames());
     resultIter->joinIndex(lhsIter.get(), rhsIter.get());
-    auto bucketSize =
-        lhsIter->size() > rhsIter->size() ? rhsIter->size() : lhsIter->size();
-    hashTable_ = std::make_unique<HashTable>(bucketSize);
-
-    if (!(lhsIter->empty() || rhsIter->empty())) {
-        if (lhsIter->size() < rhsIter->size()) {
-            buildHashTable(dataJoin->hashKeys(), lhsIter.get());
-            probe(dataJoin->probeKeys(), rhsIter.get(), resultIter.get());
-        } else {
-            exchange_ = true;
-            buildHashTable(dataJoin->probeKeys(), rhsIter.get());
-            probe(dataJoin->hashKeys(), lhsIter.get(), resultIter.get());
+    if (lhsIter->empty() || rhsIter->empty()) {
+        return finish(ResultBuilder().iter(std::move(resultIter)).finish());
+    }
+
+    // Build the hash table on the smaller side
+    exchange_ = lhsIter->size() >= rhsIter->size();
+    const auto& hashKeys = exchange_ ? dataJoin->probeKeys() : dataJoin->hashKeys();
+    const auto& probeKeys = exchange_ ? dataJoin->hashKeys() : dataJoin->probeKeys();
+    auto hashIter = exchange_ ? std::move(rhsIter) : std::move(lhsIter);
+    auto probeIter = exchange_ ? std::move(lhsIter) : std::move(rhsIter);
+
+    if (FLAGS_min_parallel_join_rows > 0 && FLAGS_num_join_partitions > 1 &&
+        hashIter->size() >= static_cast<size_t>(FLAGS_min_parallel_join_rows) &&
+        isConcurrentEvaluable(hashKeys) && isConcurrentEvaluable(probeKeys)) {
+        return doParallelInnerJoin(hashKeys,
+                                   std::move(hashIter),
+                                   probeKeys,
+                                   std::move(probeIter),
+                                   std::move(resultIter));
+    }
+
+    hashTable_ = std::make_unique<HashTable>(hashIter->size());
+    buildHashTable(hashKeys, hashIter.get());
+    probe(probeKeys, probeIter.get(), resultIter.get());
+    return finish(ResultBuilder().iter(std::move(resultIter)).finish());
+}
+
+folly::Future<Status> DataJoinExecutor::doLeftJoin() {
+    SCOPED_TIMER(&execTime_);
+
+    auto* dataJoin = asNode<DataJoin>(node());
+    std::unique_ptr<Iterator> lhsIter;
+    std::unique_ptr<Iterator> rhsIter;
+    auto status = joinIters(dataJoin, &lhsIter, &rhsIter);
+    if (!status.ok()) {
+        return error(std::move(status));
+    }
+
+    auto resultIter = std::make_unique<JoinIter>(dataJoin->colNames());
+    resultIter->joinIndex(lhsIter.get(), rhsIter.get());
+    if (lhsIter->empty()) {
+        return finish(ResultBuilder().iter(std::move(resultIter)).finish());
+    }
+
+    // The rows of the left are all kept, so always build the hash table on the right
+    exchange_ = true;
+    hashTable_ = std::make_unique<HashTable>(std::max<size_t>(rhsIter->size(), 1));
+    buildHashTable(dataJoin->probeKeys(), rhsIter.get());
+
+    // The segments of the right are all padded by the same row of NULLs, which lives as
+    // long as the executor of this execution since the result rows refer to it.
+    const auto& colIdxIndices = resultIter->getColIdxIndices();
+    size_t numSegments = 0;
+    for (auto& index : colIdxIndices) {
+        numSegments = std::max(numSegments, index.second.first + 1);
+    }
+    auto lhsSize = lhsIter->row()->size();
+    DCHECK_GE(dataJoin->colNames().size(), lhsSize);
+    auto rhsSize = dataJoin->colNames().size() - lhsSize;
+    auto lhsSegments = lhsIter->row()->segments().size();
+    nullRow_.values.resize(rhsSize, Value::kNullValue);
+    std::vector<const Row*> padding(std::max(numSegments, lhsSegments) - lhsSegments, &nullRow_);
+
+    QueryExpressionContext ctx(ectx_);
+    List key;
+    key.values.reserve(dataJoin->hashKeys().size());
+    for (; lhsIter->valid(); lhsIter->next()) {
+        evalKey(dataJoin->hashKeys(), ctx, lhsIter.get(), key);
+        auto range = hashTable_->get(key);
+        if (range.first == range.second) {
+            resultIter->addRow(padRow(lhsIter->row(), padding, rhsSize, resultIter.get()));
+            continue;
+        }
+        for (auto i = range.first; i != range.second; ++i) {
+            resultIter->addRow(joinRow(i->second, lhsIter->row(), resultIter.get()));
         }
     }
     return finish(ResultBuilder().iter(std::move(resultIter)).finish());
 }
 
+folly::Future<Status> DataJoinExecutor::doSemiJoin(bool anti) {
+    SCOPED_TIMER(&execTime_);
+
+    auto* dataJoin = asNode<DataJoin>(node());
+    std::unique_ptr<Iterator> lhsIter;
+    std::unique_ptr<Iterator> rhsIter;
+    auto status = joinIters(dataJoin, &lhsIter, &rhsIter);
+    if (!status.ok()) {
+        return error(std::move(status));
+    }
+
+    // Only the keys of the right are looked up, the rows of the left are filtered in place
+    exchange_ = true;
+    hashTable_ = std::make_unique<HashTable>(std::max<size_t>(rhsIter->size(), 1));
+    buildHashTable(dataJoin->probeKeys(), rhsIter.get());
+
+    QueryExpressionContext ctx(ectx_);
+    List key;
+    key.values.reserve(dataJoin->hashKeys().size());
+    while (lhsIter->valid()) {
+        evalKey(dataJoin->hashKeys(), ctx, lhsIter.get(), key);
+        auto range = hashTable_->get(key);
+        if ((range.first != range.second) == anti) {
+            lhsIter->unstableErase();
+        } else {
+            lhsIter->next();
+        }
+    }
+    lhsIter->reset();
+
+    auto& lhsResult =
+        ectx_->getVersionedResult(dataJoin->leftVar().first, dataJoin->leftVar().second);
+    return finish(ResultBuilder().value(lhsResult.valuePtr()).iter(std::move(lhsIter)).finish());
+}
+
 void DataJoinExecutor::buildHashTable(const std::vector<Expression*>& hashKeys,
                                       Iterator* iter) {
     QueryExpressionContext ctx(ectx_);
@@ -91,35 +212,178 @@ void DataJoinExecutor::buildHashTable(const std::vector<Expression*>& hashKeys,
 void DataJoinExecutor::probe(const std::vector<Expression*>& probeKeys,
                              Iterator* probeIter, JoinIter* resultIter) {
     QueryExpressionContext ctx(ectx_);
+    // Reuse the key buffer since the probe key is not kept
+    List list;
+    list.values.reserve(probeKeys.size());
     for (; probeIter->valid(); probeIter->next()) {
+        evalKey(probeKeys, ctx, probeIter, list);
+        auto range = hashTable_->get(list);
+        for (auto i = range.first; i != range.second; ++i) {
+            auto newRow = joinRow(i->second, probeIter->row(), resultIter);
+            VLOG(1) << node()->outputVar() << " : " << newRow;
+            resultIter->addRow(std::move(newRow));
+        }
+    }
+}
+
+JoinIter::JoinLogicalRow DataJoinExecutor::joinRow(const LogicalRow* hashRow,
+                                                   const LogicalRow* probeRow,
+                                                   const JoinIter* resultIter) const {
+    std::vector<const Row*> values;
+    auto& lSegs = hashRow->segments();
+    auto& rSegs = probeRow->segments();
+    values.reserve(lSegs.size() + rSegs.size());
+    if (exchange_) {
+        values.insert(values.end(), rSegs.begin(), rSegs.end());
+        values.insert(values.end(), lSegs.begin(), lSegs.end());
+    } else {
+        values.insert(values.end(), lSegs.begin(), lSegs.end());
+        values.insert(values.end(), rSegs.begin(), rSegs.end());
+    }
+    size_t size = hashRow->size() + probeRow->size();
+    return JoinIter::JoinLogicalRow(
+        std::move(values), size, &resultIter->getColIdxIndices());
+}
+
+void DataJoinExecutor::evalKey(const std::vector<Expression*>& keys,
+                               QueryExpressionContext& ctx,
+                               Iterator* iter,
+                               List& key) const {
+    key.values.clear();
+    for (auto& col : keys) {
+        Value val = col->eval(ctx(iter));
+        key.values.emplace_back(std::move(val));
+    }
+    VLOG(1) << "probe: " << key;
+}
+
+JoinIter::JoinLogicalRow DataJoinExecutor::padRow(const LogicalRow* lhsRow,
+                                                  const std::vector<const Row*>& padding,
+                                                  size_t rhsSize,
+                                                  const JoinIter* resultIter) const {
+    std::vector<const Row*> values = lhsRow->segments();
+    values.insert(values.end(), padding.begin(), padding.end());
+    return JoinIter::JoinLogicalRow(
+        std::move(values), lhsRow->size() + rhsSize, &resultIter->getColIdxIndices());
+}
+
+bool DataJoinExecutor::isConcurrentEvaluable(const std::vector<Expression*>& keys) const {
+    return std::all_of(keys.begin(), keys.end(), [](const Expression* key) {
+        return ExpressionUtils::isConcurrentEvaluable(key);
+    });
+}
+
+folly::Future<Status> DataJoinExecutor::doParallelInnerJoin(
+    const std::vector<Expression*>& hashKeys,
+    std::unique_ptr<Iterator> hashIter,
+    const std::vector<Expression*>& probeKeys,
+    std::unique_ptr<Iterator> probeIter,
+    std::unique_ptr<JoinIter> resultIter) {
+    numPartitions_ = FLAGS_num_join_partitions;
+    VLOG(1) << node()->outputVar() << " parallel join by " << numPartitions_ << " partitions";
+
+    // Each side is split into as many morsels as partitions, the morsel scatters its rows into
+    // the partitions independently, so no synchronization is needed.
+    std::vector<folly::Future<Partitions>> futures;
+    auto split = [this, &futures](const std::vector<Expression*>& keys, const Iterator* iter) {
+        auto size = iter->size();
+        auto morselSize = (size + numPartitions_ - 1) / numPartitions_;
+        for (size_t begin = 0; begin < size; begin += morselSize) {
+            morsels_.emplace_back(iter->copyRange(begin, begin + morselSize));
+            auto* morsel = morsels_.back().get();
+            futures.emplace_back(folly::via(runner(), [this, &keys, morsel]() {
+                return scatter(keys, morsel);
+            }));
+        }
+    };
+    split(hashKeys, hashIter.get());
+    auto numHashMorsels = futures.size();
+    split(probeKeys, probeIter.get());
+
+    const auto* result = resultIter.get();
+    return folly::collect(futures)
+        .via(runner())
+        .then([this, numHashMorsels, result](std::vector<Partitions> morselParts) {
+            auto parts = std::make_shared<std::vector<Partitions>>(std::move(morselParts));
+            std::vector<folly::Future<std::vector<JoinIter::JoinLogicalRow>>> joined;
+            joined.reserve(numPartitions_);
+            for (size_t i = 0; i < numPartitions_; ++i) {
+                auto join = [this, i, numHashMorsels, parts, result]() {
+                    return joinPartition(i, parts.get(), numHashMorsels, result);
+                };
+                joined.emplace_back(folly::via(runner(), std::move(join)));
+            }
+            return folly::collect(joined);
+        })
+        .then([this, resultIter = std::move(resultIter)](
+                  std::vector<std::vector<JoinIter::JoinLogicalRow>> joined) mutable {
+            SCOPED_TIMER(&execTime_);
+            for (auto& rows : joined) {
+                for (auto& row : rows) {
+                    resultIter->addRow(std::move(row));
+                }
+            }
+            morsels_.clear();
+            return finish(ResultBuilder().iter(std::move(resultIter)).finish());
+        });
+}
+
+DataJoinExecutor::Partitions DataJoinExecutor::scatter(const std::vector<Expression*>& keys,
+                                                       Iterator* iter) const {
+    // The expression caches its evaluated result, so each morsel evaluates on the clones
+    std::vector<std::unique_ptr<Expression>> exprs;
+    exprs.reserve(keys.size());
+    for (auto* key : keys) {
+        exprs.emplace_back(key->clone());
+    }
+
+    Partitions parts(numPartitions_);
+    QueryExpressionContext ctx(ectx_);
+    for (; iter->valid(); iter->next()) {
         List list;
-        list.values.reserve(probeKeys.size());
-        for (auto& col : probeKeys) {
-            Value val = col->eval(ctx(probeIter));
+        list.values.reserve(exprs.size());
+        for (auto& expr : exprs) {
+            Value val = expr->eval(ctx(iter));
             list.values.emplace_back(std::move(val));
         }
+        auto hash = std::hash<List>()(list);
+        // Mix the hash since the hash table of partition chooses bucket by the low bits too
+        auto part = folly::hash::twang_mix64(hash) % numPartitions_;
+        parts[part].emplace_back(KeyedRow{hash, std::move(list), iter->row()});
+    }
+    return parts;
+}
 
-        VLOG(1) << "probe: " << list;
-        auto range = hashTable_->get(list);
-        for (auto i = range.first; i != range.second; ++i) {
-            auto row = i->second;
-            std::vector<const Row*> values;
-            auto& lSegs = row->segments();
-            auto& rSegs = probeIter->row()->segments();
-            if (exchange_) {
-                values.insert(values.end(), rSegs.begin(), rSegs.end());
-                values.insert(values.end(), lSegs.begin(), lSegs.end());
-            } else {
-                values.insert(values.end(), lSegs.begin(), lSegs.end());
-                values.insert(values.end(), rSegs.begin(), rSegs.end());
+std::vector<JoinIter::JoinLogicalRow> DataJoinExecutor::joinPartition(
+    size_t part,
+    std::vector<Partitions>* morsels,
+    size_t numHashMorsels,
+    const JoinIter* resultIter) const {
+    std::vector<JoinIter::JoinLogicalRow> rows;
+    size_t hashSize = 0;
+    for (size_t i = 0; i < numHashMorsels; ++i) {
+        hashSize += (*morsels)[i][part].size();
+    }
+    if (hashSize == 0) {
+        return rows;
+    }
+
+    // Only this task touches the rows of partition `part', so the keys could be moved
+    HashTable hashTable(hashSize);
+    for (size_t i = 0; i < numHashMorsels; ++i) {
+        for (auto& keyedRow : (*morsels)[i][part]) {
+            hashTable.add(keyedRow.hash, std::move(keyedRow.key), keyedRow.row);
+        }
+    }
+    for (size_t i = numHashMorsels; i < morsels->size(); ++i) {
+        for (auto& keyedRow : (*morsels)[i][part]) {
+            auto range = hashTable.get(keyedRow.hash, keyedRow.key);
+            for (auto it = range.first; it != range.second; ++it) {
+                rows.emplace_back(joinRow(it->second, keyedRow.row, resultIter));
             }
-            size_t size = row->size() + probeIter->row()->size();
-            JoinIter::JoinLogicalRow newRow(std::move(values), size,
-                                        &resultIter->getColIdxIndices());
-            VLOG(1) << node()->outputVar() << " : " << newRow;
-            resultIter->addRow(std::move(newRow));
         }
     }
+    return rows;
 }
 }  // namespace graph
 }  // namespace nebula
@@ -12,6 +12,9 @@
 namespace nebula {
 namespace graph {
 
+class DataJoin;
+class QueryExpressionContext;
+
 class DataJoinExecutor final : public Executor {
 public:
     class HashTable final {
@@ -25,12 +28,21 @@ public:
 
         void add(List key, const LogicalRow* row) {
             auto hash = std::hash<List>()(key);
+            add(hash, std::move(key), row);
+        }
+
+        // Add the key with the hash value computed by caller
+        void add(size_t hash, List key, const LogicalRow* row) {
             auto bucket = hash % bucketSize_;
             table_[bucket].emplace(std::move(key), row);
         }
 
-        auto get(List& key) const {
+        auto get(const List& key) const {
             auto hash = std::hash<List>()(key);
+            return get(hash, key);
+        }
+
+        auto get(size_t hash, const List& key) const {
             auto bucket = hash % bucketSize_;
             return table_[bucket].equal_range(key);
         }
@@ -53,16 +65,76 @@ public:
     Status close() override;
 
 private:
+    // The evaluated key of a row, rows are scattered into partitions by the hash of key
+    struct KeyedRow {
+        size_t              hash;
+        List                key;
+        const LogicalRow*   row;
+    };
+
+    // partition id -> rows
+    using Partitions = std::vector<std::vector<KeyedRow>>;
+
+    // Get the iterators of both inputs, which must be the iterators of data set
+    Status joinIters(const DataJoin* dataJoin,
+                     std::unique_ptr<Iterator>* lhsIter,
+                     std::unique_ptr<Iterator>* rhsIter) const;
+
     folly::Future<Status> doInnerJoin();
 
+    // Keep all the rows of the left, the rows without any match are padded with NULLs.
+    folly::Future<Status> doLeftJoin();
+
+    // Keep the rows of the left which are matched by the right, or not matched if `anti'.
+    folly::Future<Status> doSemiJoin(bool anti);
+
     void buildHashTable(const std::vector<Expression*>& hashKeys, Iterator* iter);
 
     void probe(const std::vector<Expression*>& probeKeys, Iterator* probeiter,
                JoinIter* resultIter);
 
+    void evalKey(const std::vector<Expression*>& keys,
+                 QueryExpressionContext& ctx,
+                 Iterator* iter,
+                 List& key) const;
+
+    // Split both inputs into morsels and scatter the rows into partitions by the key hash,
+    // then build and probe each partition in parallel.
+    folly::Future<Status> doParallelInnerJoin(const std::vector<Expression*>& hashKeys,
+                                              std::unique_ptr<Iterator> hashIter,
+                                              const std::vector<Expression*>& probeKeys,
+                                              std::unique_ptr<Iterator> probeIter,
+                                              std::unique_ptr<JoinIter> resultIter);
+
+    Partitions scatter(const std::vector<Expression*>& keys, Iterator* iter) const;
+
+    // Build and probe the partition `part' of all morsels, the first `numHashMorsels'
+    // morsels come from the hash side and the others come from the probe side.
+    std::vector<JoinIter::JoinLogicalRow> joinPartition(size_t part,
+                                                        std::vector<Partitions>* morsels,
+                                                        size_t numHashMorsels,
+                                                        const JoinIter* resultIter) const;
+
+    JoinIter::JoinLogicalRow joinRow(const LogicalRow* hashRow,
+                                     const LogicalRow* probeRow,
+                                     const JoinIter* resultIter) const;
+
+    // The row of the left joined with the NULLs of all the segments of the right
+    JoinIter::JoinLogicalRow padRow(const LogicalRow* lhsRow,
+                                    const std::vector<const Row*>& padding,
+                                    size_t rhsSize,
+                                    const JoinIter* resultIter) const;
+
+    bool isConcurrentEvaluable(const std::vector<Expression*>& keys) const;
+
 private:
-    bool                         exchange_{false};
-    std::unique_ptr<HashTable>   hashTable_;
+    bool                                     exchange_{false};
+    size_t                                   numPartitions_{0};
+    std::unique_ptr<HashTable>               hashTable_;
+    // Morsels of inputs, keep them alive until all partitions are probed
+    std::vector<std::unique_ptr<Iterator>>   morsels_;
+    // The rhs of the unmatched rows of the left join, the results refer to it after closed
+    Row                                      nullRow_;
 };
 }  // namespace graph
 }  // namespace nebula
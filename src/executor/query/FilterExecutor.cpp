@@ -6,10 +6,15 @@
 
 #include "executor/query/FilterExecutor.h"
 
+#include <numeric>
+
 #include "planner/Query.h"
 
 #include "context/QueryExpressionContext.h"
+#include "service/GraphFlags.h"
+#include "util/ExpressionUtils.h"
 #include "util/ScopedTimer.h"
+#include "util/VectorizedEval.h"
 
 namespace nebula {
 namespace graph {
@@ -27,17 +32,32 @@ folly::Future<Status> FilterExecutor::execute() {
             << ", iterator type: " << static_cast<int16_t>(iter->kind())
             << ", input data size: " << iter->size();
 
+    if (shouldRunMorsels(iter->size()) &&
+        ExpressionUtils::isConcurrentEvaluable(filter->condition())) {
+        return filterMorsels(std::move(iter));
+    }
+
     ResultBuilder builder;
     builder.value(iter->valuePtr());
-    QueryExpressionContext ctx(ectx_);
     auto condition = filter->condition();
+    if (FLAGS_enable_vectorized_eval && VectorizedEval::shouldEval(condition)) {
+        auto accepted = acceptRows(condition, iter.get());
+        if (!accepted.ok()) {
+            return accepted.status();
+        }
+        eraseRejected(accepted.value(), iter.get());
+        builder.iter(std::move(iter));
+        return finish(builder.finish());
+    }
+
+    QueryExpressionContext ctx(ectx_);
     while (iter->valid()) {
         auto val = condition->eval(ctx(iter.get()));
-        if (!val.empty() && !val.isBool() && !val.isNull()) {
-            return Status::Error("Internal Error: Wrong type result, "
-                                 "the type should be NULL,EMPTY or BOOL");
+        auto accepted = accept(val);
+        if (!accepted.ok()) {
+            return accepted.status();
         }
-        if (val.empty() || val.isNull() || !val.getBool()) {
+        if (!accepted.value()) {
             iter->unstableErase();
         } else {
             iter->next();
@@ -49,5 +69,95 @@ folly::Future<Status> FilterExecutor::execute() {
     return finish(builder.finish());
 }
 
+StatusOr<bool> FilterExecutor::accept(const Value& val) const {
+    if (!val.empty() && !val.isBool() && !val.isNull()) {
+        return Status::Error("Internal Error: Wrong type result, "
+                             "the type should be NULL,EMPTY or BOOL");
+    }
+    return !(val.empty() || val.isNull() || !val.getBool());
+}
+
+StatusOr<std::vector<bool>> FilterExecutor::acceptRows(Expression* condition,
+                                                      Iterator* iter) const {
+    std::shared_ptr<const Column> column;
+    if (FLAGS_enable_vectorized_eval && VectorizedEval::shouldEval(condition)) {
+        ColumnBatch batch(iter);
+        column = VectorizedEval::eval(condition, &batch);
+    }
+    if (column != nullptr && column->type() != Column::Type::kBool) {
+        // Leave the wrong type to be reported by the row by row evaluation
+        column = nullptr;
+    }
+
+    QueryExpressionContext ctx(ectx_);
+    std::vector<bool> accepted;
+    accepted.reserve(iter->size());
+    for (size_t i = 0; iter->valid(); iter->next(), ++i) {
+        if (column != nullptr && column->isValid(i)) {
+            accepted.emplace_back(column->bools()[i] != 0);
+            continue;
+        }
+        auto val = condition->eval(ctx(iter));
+        auto ret = accept(val);
+        if (!ret.ok()) {
+            return ret.status();
+        }
+        accepted.emplace_back(ret.value());
+    }
+    return accepted;
+}
+
+void FilterExecutor::eraseRejected(const std::vector<bool>& accepted, Iterator* iter) const {
+    DCHECK_EQ(accepted.size(), iter->size());
+    // The unstable erasing moves the last row to the current position, so track the origin
+    // position of each row.
+    std::vector<size_t> positions(accepted.size());
+    std::iota(positions.begin(), positions.end(), 0);
+    size_t pos = 0;
+    iter->reset();
+    while (iter->valid()) {
+        if (accepted[positions[pos]]) {
+            iter->next();
+            ++pos;
+        } else {
+            iter->unstableErase();
+            positions[pos] = positions.back();
+            positions.pop_back();
+        }
+    }
+    iter->reset();
+}
+
+folly::Future<Status> FilterExecutor::filterMorsels(std::unique_ptr<Iterator> iter) {
+    auto* filter = asNode<Filter>(node());
+    auto scatter = [this, filter](Iterator* morsel) {
+        // The expression caches its evaluated result, so each morsel filters by a clone
+        auto condition = filter->condition()->clone();
+        return acceptRows(condition.get(), morsel);
+    };
+
+    auto* input = iter.get();
+    auto gather = [this, iter = std::move(iter)](
+                      std::vector<StatusOr<std::vector<bool>>> morsels) mutable -> Status {
+        SCOPED_TIMER(&execTime_);
+        std::vector<bool> accepted;
+        accepted.reserve(iter->size());
+        for (auto& morsel : morsels) {
+            if (!morsel.ok()) {
+                return morsel.status();
+            }
+            auto flags = std::move(morsel).value();
+            accepted.insert(accepted.end(), flags.begin(), flags.end());
+        }
+        eraseRejected(accepted, iter.get());
+
+        ResultBuilder builder;
+        builder.value(iter->valuePtr());
+        builder.iter(std::move(iter));
+        return finish(builder.finish());
+    };
+    return runMorsels(input, std::move(scatter), std::move(gather));
+}
+
 }   // namespace graph
 }   // namespace nebula
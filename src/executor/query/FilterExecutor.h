@@ -18,6 +18,19 @@ public:
         : Executor("FilterExecutor", node, qctx) {}
 
     folly::Future<Status> execute() override;
+
+private:
+    // Whether the row with the evaluated condition `val' is accepted
+    StatusOr<bool> accept(const Value& val) const;
+
+    // Whether each row of the iterator is accepted, the condition is evaluated by the vectorized
+    // kernels if possible
+    StatusOr<std::vector<bool>> acceptRows(Expression* condition, Iterator* iter) const;
+
+    // Erase the rows in the same order as the row by row filtering
+    void eraseRejected(const std::vector<bool>& accepted, Iterator* iter) const;
+
+    folly::Future<Status> filterMorsels(std::unique_ptr<Iterator> iter);
 };
 
 }   // namespace graph
@@ -6,6 +6,9 @@
 
 #include "executor/query/GetNeighborsExecutor.h"
 
+#include <folly/Random.h>
+
+#include <numeric>
 #include <sstream>
 
 #include "common/clients/storage/GraphStorageClient.h"
@@ -29,12 +32,34 @@ folly::Future<Status> GetNeighborsExecutor::execute() {
     if (!status.ok()) {
         return error(std::move(status));
     }
+    const auto& limits = gn_->vertexLimits();
+    if (!limits.empty()) {
+        // The limits are of the steps of the loop if any, and the last one is used beyond
+        auto idx = limits.size() - 1;
+        if (!gn_->stepVar().empty()) {
+            const auto& step = ectx_->getValue(gn_->stepVar());
+            if (step.isInt() && step.getInt() > 0) {
+                idx = std::min(static_cast<size_t>(step.getInt() - 1), idx);
+            }
+        }
+        vertexLimit_ = limits[idx];
+    }
     return getNeighbors();
 }
 
 Status GetNeighborsExecutor::close() {
     // clear the members
     reqDs_.rows.clear();
+    nextVid_ = 0;
+    numNeighbors_ = 0;
+    numBatches_ = 0;
+    batchRpcTimeInUs_ = 0;
+    state_ = Result::State::kSuccess;
+    neighbors_.values.clear();
+    requests_.clear();
+    nextRequest_ = 0;
+    failed_ = false;
+    vertexLimit_ = -1;
     return Executor::close();
 }
 
@@ -78,23 +103,16 @@ folly::Future<Status> GetNeighborsExecutor::getNeighbors() {
                           .finish());
     }
 
+    if (shouldFetchInBatches()) {
+        return getNeighborsInBatches();
+    }
+
+    if (shouldSplitFrontier()) {
+        return getNeighborsByPartitions();
+    }
+
     time::Duration getNbrTime;
-    GraphStorageClient* storageClient = qctx_->getStorageClient();
-    return storageClient
-        ->getNeighbors(gn_->space(),
-                       std::move(reqDs_.colNames),
-                       std::move(reqDs_.rows),
-                       gn_->edgeTypes(),
-                       gn_->edgeDirection(),
-                       gn_->statProps(),
-                       gn_->vertexProps(),
-                       gn_->edgeProps(),
-                       gn_->exprs(),
-                       gn_->dedup(),
-                       gn_->random(),
-                       gn_->orderBy(),
-                       gn_->limit(),
-                       gn_->filter())
+    return fetch(std::move(reqDs_.rows), gn_->limit())
         .via(runner())
         .ensure([this, getNbrTime]() {
             if (otherStats_ != nullptr) {
@@ -112,12 +130,222 @@ folly::Future<Status> GetNeighborsExecutor::getNeighbors() {
         });
 }
 
+bool GetNeighborsExecutor::shouldFetchInBatches() const {
+    // Only the limit could stop the fetching early, and the random or ordered neighbors
+    // must be chosen from all the vids.
+    auto limit = gn_->limit();
+    return FLAGS_get_neighbors_batch_size > 0 &&
+           reqDs_.rows.size() > FLAGS_get_neighbors_batch_size &&
+           limit >= 0 && limit < std::numeric_limits<int64_t>::max() &&
+           !gn_->random() && gn_->orderBy().empty();
+}
+
+folly::Future<Status> GetNeighborsExecutor::getNeighborsInBatches() {
+    auto& vids = reqDs_.rows;
+    if (nextVid_ >= vids.size() || numNeighbors_ >= gn_->limit()) {
+        if (otherStats_ != nullptr) {
+            otherStats_->emplace("total_rpc_time",
+                                 folly::stringPrintf("%lu(us)", batchRpcTimeInUs_));
+            otherStats_->emplace("num_batches", folly::to<std::string>(numBatches_));
+            otherStats_->emplace("fetched_vids",
+                                 folly::stringPrintf("%lu/%lu", nextVid_, vids.size()));
+        }
+        VLOG(1) << "Fetched " << numNeighbors_ << " neighbors of " << nextVid_ << " vids in "
+                << numBatches_ << " batches, time: " << batchRpcTimeInUs_ << "us";
+        return finish(ResultBuilder().state(state_).iter(makeIter(std::move(neighbors_))).finish());
+    }
+
+    auto last = std::min(nextVid_ + FLAGS_get_neighbors_batch_size, vids.size());
+    std::vector<Row> batch(std::make_move_iterator(vids.begin() + nextVid_),
+                           std::make_move_iterator(vids.begin() + last));
+    nextVid_ = last;
+    time::Duration getNbrTime;
+    return fetch(std::move(batch), gn_->limit() - numNeighbors_)
+        .via(runner())
+        .then([this, getNbrTime](StorageRpcResponse<GetNeighborsResponse>&& resp) {
+            auto status = handleBatchResponse(resp, getNbrTime.elapsedInUSec());
+            if (!status.ok()) {
+                return error(std::move(status));
+            }
+            return getNeighborsInBatches();
+        });
+}
+
+bool GetNeighborsExecutor::shouldSplitFrontier() const {
+    // The limited neighbors are fetched in batches, and the random or ordered neighbors
+    // must be chosen from all the vids.
+    auto limit = gn_->limit();
+    bool limited = limit >= 0 && limit < std::numeric_limits<int64_t>::max();
+    return FLAGS_get_neighbors_max_vids_per_request > 0 &&
+           reqDs_.rows.size() > FLAGS_get_neighbors_max_vids_per_request &&
+           !limited && !gn_->random() && gn_->orderBy().empty();
+}
+
+std::vector<std::vector<Row>> GetNeighborsExecutor::splitByPartitions() {
+    auto& vids = reqDs_.rows;
+    std::map<PartitionID, std::vector<Row>> parts;
+    auto* metaClient = qctx()->getMetaClient();
+    auto numParts = metaClient == nullptr ? StatusOr<int32_t>(Status::Error("No meta client"))
+                                          : metaClient->partsNum(gn_->space());
+    for (auto& row : vids) {
+        PartitionID part = 0;
+        if (numParts.ok()) {
+            const auto& vid = row.values.front();
+            // The integer vids are hashed by their bytes as the storage client does
+            auto partId = vid.isInt()
+                ? metaClient->partId(numParts.value(),
+                                     std::string(reinterpret_cast<const char*>(&vid.getInt()),
+                                                 sizeof(int64_t)))
+                : metaClient->partId(numParts.value(), vid.getStr());
+            if (partId.ok()) {
+                part = partId.value();
+            }
+        }
+        parts[part].emplace_back(std::move(row));
+    }
+    vids.clear();
+
+    std::vector<std::vector<Row>> requests(1);
+    for (auto& part : parts) {
+        for (auto& row : part.second) {
+            if (requests.back().size() >= FLAGS_get_neighbors_max_vids_per_request) {
+                requests.emplace_back();
+            }
+            requests.back().emplace_back(std::move(row));
+        }
+    }
+    return requests;
+}
+
+folly::Future<Status> GetNeighborsExecutor::getNeighborsByPartitions() {
+    requests_ = splitByPartitions();
+    auto numInflight = std::min<size_t>(
+        std::max(FLAGS_get_neighbors_max_inflight_requests, 1u), requests_.size());
+    std::vector<folly::Future<Status>> futures;
+    futures.reserve(numInflight);
+    time::Duration getNbrTime;
+    for (size_t i = 0; i < numInflight; ++i) {
+        futures.emplace_back(fetchNextRequest());
+    }
+    return folly::collect(futures).via(runner()).thenValue(
+        [this, getNbrTime](std::vector<Status>&& statuses) {
+            for (auto& status : statuses) {
+                NG_RETURN_IF_ERROR(status);
+            }
+            if (otherStats_ != nullptr) {
+                otherStats_->emplace("total_rpc_time",
+                                     folly::stringPrintf("%lu(us)", getNbrTime.elapsedInUSec()));
+                otherStats_->emplace("num_requests", folly::to<std::string>(requests_.size()));
+            }
+            VLOG(1) << "Get neighbors of " << requests_.size()
+                    << " requests time: " << getNbrTime.elapsedInUSec() << "us";
+            return finish(
+                ResultBuilder().state(state_).iter(makeIter(std::move(neighbors_))).finish());
+        });
+}
+
+folly::Future<Status> GetNeighborsExecutor::fetchNextRequest() {
+    auto next = nextRequest_.fetch_add(1);
+    if (next >= requests_.size() || failed_.load()) {
+        return folly::makeFuture(Status::OK());
+    }
+    return fetch(std::move(requests_[next]), gn_->limit())
+        .via(runner())
+        .then([this](StorageRpcResponse<GetNeighborsResponse>&& resp) {
+            auto status = appendResponse(resp);
+            if (!status.ok()) {
+                failed_ = true;
+                return folly::makeFuture(std::move(status));
+            }
+            return fetchNextRequest();
+        });
+}
+
+Status GetNeighborsExecutor::appendResponse(RpcResponse& resps) {
+    auto result = handleCompleteness(resps, FLAGS_accept_partial_success);
+    NG_RETURN_IF_ERROR(result);
+    auto list = collectDataSets(resps);
+
+    std::lock_guard<std::mutex> guard(lock_);
+    SCOPED_TIMER(&execTime_);
+    if (otherStats_ != nullptr) {
+        addStats(resps, *otherStats_);
+    }
+    if (result.value() == Result::State::kPartialSuccess) {
+        state_ = Result::State::kPartialSuccess;
+    }
+    for (auto& ds : list.values) {
+        neighbors_.values.emplace_back(std::move(ds));
+    }
+    return Status::OK();
+}
+
+folly::Future<GetNeighborsExecutor::RpcResponse> GetNeighborsExecutor::fetch(
+    std::vector<Row> vids,
+    int64_t limit) {
+    GraphStorageClient* storageClient = qctx_->getStorageClient();
+    return storageClient->getNeighbors(gn_->space(),
+                                       reqDs_.colNames,
+                                       std::move(vids),
+                                       gn_->edgeTypes(),
+                                       gn_->edgeDirection(),
+                                       gn_->statProps(),
+                                       gn_->vertexProps(),
+                                       gn_->edgeProps(),
+                                       gn_->exprs(),
+                                       gn_->dedup(),
+                                       gn_->random(),
+                                       gn_->orderBy(),
+                                       limit,
+                                       gn_->filter());
+}
+
 Status GetNeighborsExecutor::handleResponse(RpcResponse& resps) {
     auto result = handleCompleteness(resps, FLAGS_accept_partial_success);
     NG_RETURN_IF_ERROR(result);
     ResultBuilder builder;
     builder.state(result.value());
+    builder.iter(makeIter(collectDataSets(resps)));
+    return finish(builder.finish());
+}
+
+std::unique_ptr<Iterator> GetNeighborsExecutor::makeIter(List neighbors) {
+    auto iter = std::make_unique<GetNeighborsIter>(std::make_shared<Value>(std::move(neighbors)),
+                                                   layout_);
+    if (iter->layout() != nullptr) {
+        layout_ = iter->layout();
+    }
+    return iter;
+}
+
+Status GetNeighborsExecutor::handleBatchResponse(RpcResponse& resps, uint64_t rpcTimeInUs) {
+    ++numBatches_;
+    batchRpcTimeInUs_ += rpcTimeInUs;
+    if (otherStats_ != nullptr) {
+        // The hosts of the later batches are recorded by their first latency
+        addStats(resps, *otherStats_);
+    }
+    SCOPED_TIMER(&execTime_);
+    auto result = handleCompleteness(resps, FLAGS_accept_partial_success);
+    NG_RETURN_IF_ERROR(result);
+    if (result.value() == Result::State::kPartialSuccess) {
+        state_ = Result::State::kPartialSuccess;
+    }
+
+    // Count the neighbors as the successors iterate them
+    auto batch = std::make_shared<Value>(collectDataSets(resps));
+    GetNeighborsIter iter(batch, layout_);
+    if (iter.layout() != nullptr) {
+        layout_ = iter.layout();
+    }
+    numNeighbors_ += iter.size();
+    for (auto& ds : batch->mutableList().values) {
+        neighbors_.values.emplace_back(std::move(ds));
+    }
+    return Status::OK();
+}
 
+List GetNeighborsExecutor::collectDataSets(RpcResponse& resps) const {
     auto& responses = resps.responses();
     VLOG(1) << "Resp size: " << responses.size();
     List list;
@@ -129,10 +357,78 @@ Status GetNeighborsExecutor::handleResponse(RpcResponse& resps) {
         }
 
         VLOG(1) << "Resp row size: " << dataset->rows.size() << "Resp : " << *dataset;
+        if (vertexLimit_ >= 0) {
+            truncateEdges(*dataset, vertexLimit_, gn_->sample());
+        }
         list.values.emplace_back(std::move(*dataset));
     }
-    builder.value(Value(std::move(list)));
-    return finish(builder.iter(Iterator::Kind::kGetNeighbors).finish());
+    return list;
+}
+
+// static
+void GetNeighborsExecutor::truncateEdges(DataSet& ds, int64_t limit, bool sample) {
+    std::vector<size_t> edgeCols;
+    for (size_t i = 0; i < ds.colNames.size(); ++i) {
+        if (ds.colNames[i].find("_edge") == 0) {
+            edgeCols.emplace_back(i);
+        }
+    }
+    auto maxEdges = static_cast<size_t>(limit);
+    std::vector<size_t> reservoir;
+    for (auto& row : ds.rows) {
+        size_t numEdges = 0;
+        for (auto col : edgeCols) {
+            const auto& edges = row.values[col];
+            if (edges.isList()) {
+                numEdges += edges.getList().values.size();
+            }
+        }
+        if (numEdges <= maxEdges) {
+            continue;
+        }
+
+        if (!sample) {
+            auto remain = maxEdges;
+            for (auto col : edgeCols) {
+                auto& edges = row.values[col];
+                if (!edges.isList()) {
+                    continue;
+                }
+                auto& values = edges.mutableList().values;
+                auto keep = std::min(remain, values.size());
+                values.erase(values.begin() + keep, values.end());
+                remain -= keep;
+            }
+            continue;
+        }
+
+        // Reservoir sampling over the positions of all the edges of the vertex,
+        // so each edge is kept by the same probability in one pass
+        reservoir.resize(maxEdges);
+        std::iota(reservoir.begin(), reservoir.end(), 0);
+        for (size_t i = maxEdges; i < numEdges; ++i) {
+            auto k = folly::Random::rand64(i + 1);
+            if (k < maxEdges) {
+                reservoir[k] = i;
+            }
+        }
+        std::sort(reservoir.begin(), reservoir.end());
+        size_t base = 0;
+        auto next = reservoir.begin();
+        for (auto col : edgeCols) {
+            auto& edges = row.values[col];
+            if (!edges.isList()) {
+                continue;
+            }
+            auto& values = edges.mutableList().values;
+            std::vector<Value> kept;
+            for (; next != reservoir.end() && *next < base + values.size(); ++next) {
+                kept.emplace_back(std::move(values[*next - base]));
+            }
+            base += values.size();
+            values = std::move(kept);
+        }
+    }
 }
 
 }   // namespace graph
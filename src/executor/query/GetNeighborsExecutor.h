@@ -32,17 +32,75 @@ public:
     Status close() override;
 
 private:
+    using RpcResponse = storage::StorageRpcResponse<storage::cpp2::GetNeighborsResponse>;
+
     friend class GetNeighborsTest_BuildRequestDataSet_Test;
+    friend class GetNeighborsTest_FetchInBatches_Test;
+    friend class GetNeighborsTest_MergeBatches_Test;
+    friend class GetNeighborsTest_SplitFrontier_Test;
+    friend class GetNeighborsTest_TruncateEdges_Test;
     Status buildRequestDataSet();
 
     folly::Future<Status> getNeighbors();
 
-    using RpcResponse = storage::StorageRpcResponse<storage::cpp2::GetNeighborsResponse>;
+    // Fetch the neighbors batch by batch of vids and stop once the limit is reached,
+    // so the neighbors beyond the limit are neither fetched nor materialized.
+    folly::Future<Status> getNeighborsInBatches();
+
+    bool shouldFetchInBatches() const;
+
+    // Split the large frontier by the storage partitions into the requests of at most
+    // get_neighbors_max_vids_per_request vids, and keep at most
+    // get_neighbors_max_inflight_requests of them in flight. The neighbors of each request
+    // are moved into the result as soon as it returns.
+    folly::Future<Status> getNeighborsByPartitions();
+
+    bool shouldSplitFrontier() const;
+
+    // The vids of the same partition are put into the same request as far as possible,
+    // so each request is sent to a few storage hosts only.
+    std::vector<std::vector<Row>> splitByPartitions();
+
+    // Fetch the split requests one by one until none is left
+    folly::Future<Status> fetchNextRequest();
+
+    Status appendResponse(RpcResponse& resps);
+
+    folly::Future<RpcResponse> fetch(std::vector<Row> vids, int64_t limit);
+
     Status handleResponse(RpcResponse& resps);
 
+    // Append the neighbors and the stats of a batch to the result
+    Status handleBatchResponse(RpcResponse& resps, uint64_t rpcTimeInUs);
+
+    List collectDataSets(RpcResponse& resps) const;
+
+    // Make the iterator of the neighbors by the column layout of the previous responses
+    std::unique_ptr<Iterator> makeIter(List neighbors);
+
+    // Keep at most `limit' edges of each vertex of all the edge types, the first ones or
+    // the ones sampled at random
+    static void truncateEdges(DataSet& ds, int64_t limit, bool sample);
+
 private:
     DataSet                 reqDs_;
     const GetNeighbors*     gn_;
+    // The max edges of each vertex of the current step, negative if unlimited
+    int64_t                 vertexLimit_{-1};
+    // The column layout of the responses, which is reused by the executions of the node
+    std::shared_ptr<const GetNeighborsIter::ColumnLayout>   layout_;
+    // The state of the batched fetching
+    size_t                  nextVid_{0};
+    int64_t                 numNeighbors_{0};
+    size_t                  numBatches_{0};
+    uint64_t                batchRpcTimeInUs_{0};
+    Result::State           state_{Result::State::kSuccess};
+    List                    neighbors_;
+    // The state of the split fetching
+    std::vector<std::vector<Row>>   requests_;
+    std::atomic<size_t>             nextRequest_{0};
+    std::atomic<bool>               failed_{false};
+    std::mutex                      lock_;
 };
 
 }   // namespace graph
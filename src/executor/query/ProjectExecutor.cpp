@@ -9,7 +9,10 @@
 #include "context/QueryExpressionContext.h"
 #include "parser/Clauses.h"
 #include "planner/Query.h"
+#include "service/GraphFlags.h"
+#include "util/ExpressionUtils.h"
 #include "util/ScopedTimer.h"
+#include "util/VectorizedEval.h"
 
 namespace nebula {
 namespace graph {
@@ -20,22 +23,82 @@ folly::Future<Status> ProjectExecutor::execute() {
     auto columns = project->columns()->columns();
     auto iter = ectx_->getResult(project->inputVar()).iter();
     DCHECK(!!iter);
-    QueryExpressionContext ctx(ectx_);
 
     VLOG(1) << "input: " << project->inputVar();
+    if (shouldRunMorsels(iter->size()) && isConcurrentEvaluable(columns)) {
+        return projectMorsels(std::move(iter));
+    }
+
     DataSet ds;
     ds.colNames = project->colNames();
-    ds.rows.reserve(iter->size());
-    for (; iter->valid(); iter->next()) {
+    ds.rows = projectRows(columns, iter.get());
+    VLOG(1) << node()->outputVar() << ":" << ds;
+    return finish(ResultBuilder().value(Value(std::move(ds))).finish());
+}
+
+std::vector<Row> ProjectExecutor::projectRows(const std::vector<YieldColumn*>& columns,
+                                              Iterator* iter) const {
+    // Evaluate the vectorizable columns at once, the others and the rows left by the vectorized
+    // evaluation are evaluated row by row.
+    std::vector<std::shared_ptr<const Column>> results(columns.size());
+    if (FLAGS_enable_vectorized_eval) {
+        ColumnBatch batch(iter);
+        for (size_t i = 0; i < columns.size(); ++i) {
+            if (VectorizedEval::shouldEval(columns[i]->expr())) {
+                results[i] = VectorizedEval::eval(columns[i]->expr(), &batch);
+            }
+        }
+    }
+
+    QueryExpressionContext ctx(ectx_);
+    std::vector<Row> rows;
+    rows.reserve(iter->size());
+    for (size_t r = 0; iter->valid(); iter->next(), ++r) {
         Row row;
-        for (auto& col : columns) {
-            Value val = col->expr()->eval(ctx(iter.get()));
+        row.values.reserve(columns.size());
+        for (size_t i = 0; i < columns.size(); ++i) {
+            if (results[i] != nullptr && results[i]->isValid(r)) {
+                row.values.emplace_back(results[i]->value(r));
+                continue;
+            }
+            Value val = columns[i]->expr()->eval(ctx(iter));
             row.values.emplace_back(std::move(val));
         }
-        ds.rows.emplace_back(std::move(row));
+        rows.emplace_back(std::move(row));
     }
-    VLOG(1) << node()->outputVar() << ":" << ds;
-    return finish(ResultBuilder().value(Value(std::move(ds))).finish());
+    return rows;
+}
+
+bool ProjectExecutor::isConcurrentEvaluable(const std::vector<YieldColumn*>& columns) const {
+    return std::all_of(columns.begin(), columns.end(), [](const YieldColumn* col) {
+        return ExpressionUtils::isConcurrentEvaluable(col->expr());
+    });
+}
+
+folly::Future<Status> ProjectExecutor::projectMorsels(std::unique_ptr<Iterator> iter) {
+    auto* project = asNode<Project>(node());
+    auto scatter = [this, project](Iterator* morsel) {
+        // The expression caches its evaluated result, so each morsel projects by the clones
+        auto columns = project->columns()->clone();
+        return projectRows(columns->columns(), morsel);
+    };
+    auto gather = [this, project](std::vector<std::vector<Row>> morsels) {
+        SCOPED_TIMER(&execTime_);
+        DataSet ds;
+        ds.colNames = project->colNames();
+        size_t size = 0;
+        for (auto& rows : morsels) {
+            size += rows.size();
+        }
+        ds.rows.reserve(size);
+        for (auto& rows : morsels) {
+            ds.rows.insert(ds.rows.end(),
+                           std::make_move_iterator(rows.begin()),
+                           std::make_move_iterator(rows.end()));
+        }
+        return finish(ResultBuilder().value(Value(std::move(ds))).finish());
+    };
+    return runMorsels(iter.get(), std::move(scatter), std::move(gather));
 }
 
 }   // namespace graph
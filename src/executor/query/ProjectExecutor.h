@@ -18,6 +18,13 @@ public:
         : Executor("ProjectExecutor", node, qctx) {}
 
     folly::Future<Status> execute() override;
+
+private:
+    std::vector<Row> projectRows(const std::vector<YieldColumn*>& columns, Iterator* iter) const;
+
+    bool isConcurrentEvaluable(const std::vector<YieldColumn*>& columns) const;
+
+    folly::Future<Status> projectMorsels(std::unique_ptr<Iterator> iter);
 };
 
 }   // namespace graph
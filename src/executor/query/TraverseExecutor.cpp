@@ -0,0 +1,219 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "executor/query/TraverseExecutor.h"
+
+#include "context/QueryExpressionContext.h"
+#include "service/GraphFlags.h"
+#include "util/SchemaUtil.h"
+#include "util/ScopedTimer.h"
+
+using nebula::storage::GraphStorageClient;
+
+namespace nebula {
+namespace graph {
+
+folly::Future<Status> TraverseExecutor::execute() {
+    otherStats_ = std::make_unique<std::unordered_map<std::string, std::string>>();
+    buildRequestDataSet();
+    result_.colNames = traverse_->colNames();
+    return traverse();
+}
+
+Status TraverseExecutor::close() {
+    // clear the members
+    vids_.clear();
+    step_ = 1;
+    paths_.clear();
+    edgeIds_.clear();
+    state_ = Result::State::kSuccess;
+    result_ = DataSet();
+    return Executor::close();
+}
+
+void TraverseExecutor::buildRequestDataSet() {
+    SCOPED_TIMER(&execTime_);
+    auto iter = ectx_->getResult(traverse_->inputVar()).iter();
+    QueryExpressionContext ctx(ectx_);
+    const auto& spaceInfo = qctx()->rctx()->session()->space();
+    std::unordered_set<Value> uniqueVid;
+    vids_.reserve(iter->size());
+    for (; iter->valid(); iter->next()) {
+        auto val = Expression::eval(traverse_->src(), ctx(iter.get()));
+        if (!SchemaUtil::isValidVid(val, spaceInfo.spaceDesc.vid_type)) {
+            continue;
+        }
+        if (uniqueVid.emplace(val).second) {
+            vids_.emplace_back(Row({std::move(val)}));
+        }
+    }
+}
+
+folly::Future<Status> TraverseExecutor::traverse() {
+    if (vids_.empty() || step_ > traverse_->maxSteps()) {
+        VLOG(1) << node()->outputVar() << " finds " << result_.rows.size() << " paths in "
+                << step_ - 1 << " steps";
+        return finish(ResultBuilder().state(state_).value(Value(std::move(result_))).finish());
+    }
+
+    time::Duration getNbrTime;
+    GraphStorageClient* storageClient = qctx_->getStorageClient();
+    return storageClient
+        ->getNeighbors(traverse_->space(),
+                       {kVid},
+                       std::move(vids_),
+                       traverse_->edgeTypes(),
+                       traverse_->edgeDirection(),
+                       traverse_->statProps(),
+                       traverse_->vertexProps(),
+                       traverse_->edgeProps(),
+                       traverse_->exprs(),
+                       false,
+                       false,
+                       {},
+                       traverse_->limit(),
+                       traverse_->filter())
+        .via(runner())
+        .then([this, getNbrTime](RpcResponse&& resp) {
+            if (otherStats_ != nullptr) {
+                otherStats_->emplace(folly::stringPrintf("step_%ld_rpc_time", step_),
+                                     folly::stringPrintf("%lu(us)", getNbrTime.elapsedInUSec()));
+                addStats(resp, *otherStats_);
+            }
+            {
+                SCOPED_TIMER(&execTime_);
+                auto status = handleResponse(resp);
+                if (!status.ok()) {
+                    return error(std::move(status));
+                }
+            }
+            return traverse();
+        });
+}
+
+Status TraverseExecutor::handleResponse(RpcResponse& resps) {
+    auto result = handleCompleteness(resps, FLAGS_accept_partial_success);
+    NG_RETURN_IF_ERROR(result);
+    if (result.value() == Result::State::kPartialSuccess) {
+        state_ = Result::State::kPartialSuccess;
+    }
+
+    List list;
+    for (auto& resp : resps.responses()) {
+        auto dataset = resp.get_vertices();
+        if (dataset == nullptr) {
+            continue;
+        }
+        list.values.emplace_back(std::move(*dataset));
+    }
+    GetNeighborsIter iter(std::make_shared<Value>(std::move(list)));
+    expandPaths(&iter);
+    ++step_;
+    return Status::OK();
+}
+
+void TraverseExecutor::expandPaths(Iterator* iter) {
+    QueryExpressionContext ctx(ectx_);
+    auto* vertexFilter = step_ == 1 ? traverse_->vertexFilter() : nullptr;
+    auto* edgeFilter = traverse_->edgeFilter();
+    // The edges of each vertex passed the filters
+    std::unordered_map<Value, std::vector<Edge>> neighbors;
+    // The start vertices with their tags and props, which are returned only by the first step
+    std::unordered_map<Value, Value> starts;
+    for (; iter->valid(); iter->next()) {
+        if (vertexFilter != nullptr) {
+            auto& val = vertexFilter->eval(ctx(iter));
+            if (!val.isBool() || !val.getBool()) {
+                continue;
+            }
+        }
+        if (edgeFilter != nullptr) {
+            auto& val = edgeFilter->eval(ctx(iter));
+            if (!val.isBool() || !val.getBool()) {
+                continue;
+            }
+        }
+        auto edge = iter->getEdge();
+        if (!edge.isEdge()) {
+            continue;
+        }
+        const auto& vid = iter->getColumn(kVid);
+        if (step_ == 1 && starts.find(vid) == starts.end()) {
+            starts.emplace(vid, iter->getVertex());
+        }
+        neighbors[vid].emplace_back(std::move(edge.mutableEdge()));
+    }
+
+    std::vector<PathState> paths;
+    if (step_ == 1) {
+        for (auto& vertex : neighbors) {
+            auto& start = starts[vertex.first];
+            for (auto& edge : vertex.second) {
+                PathState state;
+                state.path.src = start.isVertex() ? start.getVertex() : Vertex(vertex.first, {});
+                appendStep(edge, edgeId(edge), state);
+                paths.emplace_back(std::move(state));
+            }
+        }
+    } else {
+        for (auto& state : paths_) {
+            auto found = neighbors.find(state.path.steps.back().dst.vid);
+            if (found == neighbors.end()) {
+                continue;
+            }
+            for (auto& edge : found->second) {
+                auto id = edgeId(edge);
+                if (std::binary_search(state.edges.begin(), state.edges.end(), id)) {
+                    continue;
+                }
+                auto extended = state;
+                appendStep(edge, id, extended);
+                paths.emplace_back(std::move(extended));
+            }
+        }
+    }
+    paths_.clear();
+    vids_.clear();
+
+    bool last = step_ >= traverse_->maxSteps();
+    if (step_ >= traverse_->minSteps()) {
+        result_.rows.reserve(result_.rows.size() + paths.size());
+        for (auto& state : paths) {
+            result_.rows.emplace_back(
+                Row({last ? Value(std::move(state.path)) : Value(state.path)}));
+        }
+    }
+    if (last) {
+        return;
+    }
+
+    // The distinct ends to expand from by the next step
+    std::unordered_set<Value> ends;
+    for (auto& state : paths) {
+        const auto& end = state.path.steps.back().dst.vid;
+        if (ends.emplace(end).second) {
+            vids_.emplace_back(Row({end}));
+        }
+    }
+    paths_ = std::move(paths);
+}
+
+size_t TraverseExecutor::edgeId(const Edge& edge) {
+    auto key = edge.type < 0 ? EdgeKey{edge.dst, edge.src, -edge.type, edge.ranking}
+                             : EdgeKey{edge.src, edge.dst, edge.type, edge.ranking};
+    auto id = edgeIds_.size();
+    return edgeIds_.emplace(std::move(key), id).first->second;
+}
+
+// static
+void TraverseExecutor::appendStep(const Edge& edge, size_t id, PathState& state) {
+    state.path.steps.emplace_back(
+        Step(Vertex(edge.dst, {}), edge.type, edge.name, edge.ranking, edge.props));
+    state.edges.insert(std::upper_bound(state.edges.begin(), state.edges.end(), id), id);
+}
+
+}   // namespace graph
+}   // namespace nebula
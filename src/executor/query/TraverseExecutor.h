@@ -0,0 +1,90 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef EXECUTOR_QUERY_TRAVERSEEXECUTOR_H_
+#define EXECUTOR_QUERY_TRAVERSEEXECUTOR_H_
+
+#include "common/clients/storage/GraphStorageClient.h"
+#include "common/datatypes/Path.h"
+
+#include "executor/StorageAccessExecutor.h"
+#include "planner/Query.h"
+
+namespace nebula {
+namespace graph {
+class TraverseExecutor final : public StorageAccessExecutor {
+public:
+    TraverseExecutor(const PlanNode* node, QueryContext* qctx)
+        : StorageAccessExecutor("TraverseExecutor", node, qctx) {
+        traverse_ = asNode<Traverse>(node);
+    }
+
+    folly::Future<Status> execute() override;
+
+    Status close() override;
+
+private:
+    friend class TraverseTest;
+    using RpcResponse = storage::StorageRpcResponse<storage::cpp2::GetNeighborsResponse>;
+
+    // The path expanded so far, with the ids of its edges sorted to check the uniqueness
+    struct PathState {
+        Path                    path;
+        std::vector<size_t>     edges;
+    };
+
+    // The same edge of both directions
+    struct EdgeKey {
+        Value           src;
+        Value           dst;
+        EdgeType        type;
+        EdgeRanking     ranking;
+
+        bool operator==(const EdgeKey& rhs) const {
+            return type == rhs.type && ranking == rhs.ranking && src == rhs.src &&
+                   dst == rhs.dst;
+        }
+    };
+
+    struct EdgeKeyHash {
+        size_t operator()(const EdgeKey& key) const {
+            return folly::hash::hash_combine(std::hash<Value>()(key.src),
+                                             std::hash<Value>()(key.dst),
+                                             key.type,
+                                             key.ranking);
+        }
+    };
+
+    void buildRequestDataSet();
+
+    // Get the neighbors of the step and expand the paths by them until the max steps
+    folly::Future<Status> traverse();
+
+    Status handleResponse(RpcResponse& resps);
+
+    // Expand the paths of the last step by the edges of the neighbors, or start the paths
+    // from the vertices at the first step
+    void expandPaths(Iterator* iter);
+
+    // The unique id of the edge in the traversal
+    size_t edgeId(const Edge& edge);
+
+    static void appendStep(const Edge& edge, size_t id, PathState& state);
+
+private:
+    const Traverse*                                     traverse_;
+    std::vector<Row>                                    vids_;
+    int64_t                                             step_{1};
+    std::vector<PathState>                              paths_;
+    std::unordered_map<EdgeKey, size_t, EdgeKeyHash>    edgeIds_;
+    Result::State                                       state_{Result::State::kSuccess};
+    DataSet                                             result_;
+};
+
+}   // namespace graph
+}   // namespace nebula
+
+#endif   // EXECUTOR_QUERY_TRAVERSEEXECUTOR_H_
@@ -9,6 +9,7 @@
 #include "context/QueryContext.h"
 #include "executor/query/AggregateExecutor.h"
 #include "planner/Query.h"
+#include "service/GraphFlags.h"
 
 namespace nebula {
 namespace graph {
@@ -2189,5 +2190,50 @@ TEST_F(AggregateTest, BitXor) {
         TEST_AGG_4("BIT_XOR", "bit_xor", true)
     }
 }
+
+TEST_F(AggregateTest, Morsel) {
+    // key = col2
+    // items = col2, FUN(col3), COUNT(*)
+    auto aggregate = [](const std::string& fun, bool distinct) {
+        auto key = std::make_unique<InputPropertyExpression>(new std::string("col2"));
+        AggregateExpression item(new std::string(""), key->clone().release(), false);
+        AggregateExpression item1(new std::string(fun),
+                                  new InputPropertyExpression(new std::string("col3")),
+                                  distinct);
+        AggregateExpression item2(new std::string("COUNT"),
+                                  new ConstantExpression(std::string("*")),
+                                  false);
+        std::vector<Expression*> groupKeys = {key.get()};
+        std::vector<Expression*> groupItems = {&item, &item1, &item2};
+        auto* agg = Aggregate::make(qctx_.get(), nullptr, std::move(groupKeys),
+                                    std::move(groupItems));
+        agg->setInputVar(*input_);
+        agg->setColNames(std::vector<std::string>{"col2", fun, "count"});
+
+        auto aggExe = std::make_unique<AggregateExecutor>(agg, qctx_.get());
+        auto status = aggExe->execute().get();
+        EXPECT_TRUE(status.ok());
+        auto& result = qctx_->ectx()->getResult(agg->outputVar());
+        EXPECT_EQ(result.state(), Result::State::kSuccess);
+        DataSet sortedDs = result.value().getDataSet();
+        std::sort(sortedDs.rows.begin(), sortedDs.rows.end(), RowCmp());
+        return sortedDs;
+    };
+
+    auto minRows = FLAGS_min_morsel_parallel_rows;
+    auto morselSize = FLAGS_morsel_size;
+    for (auto& fun : {"COUNT", "SUM", "AVG", "MAX", "MIN", "STD", "COLLECT", "BIT_AND"}) {
+        for (auto distinct : {false, true}) {
+            FLAGS_min_morsel_parallel_rows = 0;
+            auto expected = aggregate(fun, distinct);
+
+            FLAGS_min_morsel_parallel_rows = 1;
+            FLAGS_morsel_size = 3;
+            EXPECT_EQ(aggregate(fun, distinct), expected) << fun << " distinct: " << distinct;
+            FLAGS_morsel_size = morselSize;
+        }
+    }
+    FLAGS_min_morsel_parallel_rows = minRows;
+}
 }  // namespace graph
 }  // namespace nebula
@@ -10,6 +10,7 @@
 #include "executor/algo/ConjunctPathExecutor.h"
 #include "planner/Algo.h"
 #include "planner/Logic.h"
+#include "util/SourceBits.h"
 
 namespace nebula {
 namespace graph {
@@ -30,6 +31,10 @@ protected:
         }
         return row1[0] < row2[0];
     }
+    static bool compareBfsPath(const Row& row1, const Row& row2) {
+        // row : path |
+        return row1.values[0] < row2.values[0];
+    }
     void multiplePairPathInit() {
         /*
          *  overall path is :
@@ -417,107 +422,58 @@ protected:
         }
     }
     void biBfsInit() {
+        // The starts of both sides
         qctx_->symTable()->newVariable("forward1");
         qctx_->symTable()->newVariable("backward1");
         qctx_->symTable()->newVariable("backward2");
         qctx_->symTable()->newVariable("backward3");
         qctx_->symTable()->newVariable("backward4");
-        {
-            // 1->2
-            // 1->3
-            DataSet ds1;
-            ds1.colNames = {kVid, "edge"};
-            {
-                Row row;
-                row.values = {"1", Value::kEmpty};
-                ds1.rows.emplace_back(std::move(row));
-            }
-            qctx_->ectx()->setResult("forward1", ResultBuilder().value(ds1).finish());
-
-            DataSet ds2;
-            ds2.colNames = {kVid, "edge"};
-            {
-                Row row;
-                row.values = {"2", Edge("1", "2", 1, "edge1", 0, {})};
-                ds2.rows.emplace_back(std::move(row));
-            }
-            {
-                Row row;
-                row.values = {"3", Edge("1", "3", 1, "edge1", 0, {})};
-                ds2.rows.emplace_back(std::move(row));
-            }
-            qctx_->ectx()->setResult("forward1", ResultBuilder().value(ds2).finish());
-        }
-        {
-            // 4
-            DataSet ds1;
-            ds1.colNames = {kVid, "edge"};
-            {
-                Row row;
-                row.values = {"4", Value::kEmpty};
-                ds1.rows.emplace_back(std::move(row));
-            }
-            qctx_->ectx()->setResult("backward1", ResultBuilder().value(ds1).finish());
+        qctx_->symTable()->newVariable("bfsDirection");
+        setBfsStep("forward1", {Row({"1", Value::kEmpty})});
+        setBfsStep("backward1", {Row({"4", Value::kEmpty})});
+        setBfsStep("backward2", {Row({"2", Value::kEmpty})});
+        setBfsStep("backward3", {Row({"4", Value::kEmpty})});
+        setBfsStep("backward4", {Row({"5", Value::kEmpty})});
+    }
 
-            DataSet ds2;
-            ds2.colNames = {kVid, "edge"};
-            qctx_->ectx()->setResult("backward1", ResultBuilder().value(ds2).finish());
-        }
-        {
-            // 2
-            DataSet ds1;
-            ds1.colNames = {kVid, "edge"};
-            {
-                Row row;
-                row.values = {"2", Value::kEmpty};
-                ds1.rows.emplace_back(std::move(row));
-            }
-            qctx_->ectx()->setResult("backward2", ResultBuilder().value(ds1).finish());
+    void setBfsStep(const std::string& var, std::vector<Row> rows) {
+        DataSet ds;
+        ds.colNames = {kVid, "edge"};
+        ds.rows = std::move(rows);
+        qctx_->ectx()->setResult(var, ResultBuilder().value(std::move(ds)).finish());
+    }
 
-            DataSet ds2;
-            ds2.colNames = {kVid, "edge"};
-            qctx_->ectx()->setResult("backward2", ResultBuilder().value(ds2).finish());
-        }
-        {
-            // 4->3
-            DataSet ds1;
-            ds1.colNames = {kVid, "edge"};
-            {
-                Row row;
-                row.values = {"4", Value::kEmpty};
-                ds1.rows.emplace_back(std::move(row));
-            }
-            qctx_->ectx()->setResult("backward3", ResultBuilder().value(ds1).finish());
+    // Expand one side by the step and conjunct
+    const DataSet& expandBfs(ConjunctPathExecutor* exe,
+                             bool isForward,
+                             const std::string& var,
+                             std::vector<Row> rows) {
+        setBfsStep(var, std::move(rows));
+        qctx_->ectx()->setResult("bfsDirection", ResultBuilder().value(isForward).finish());
+        auto status = exe->execute().get();
+        EXPECT_TRUE(status.ok());
+        auto& result = qctx_->ectx()->getResult(exe->node()->outputVar());
+        EXPECT_EQ(result.state(), Result::State::kSuccess);
+        return result.value().getDataSet();
+    }
 
-            DataSet ds2;
-            ds2.colNames = {kVid, "edge"};
-            {
-                Row row;
-                row.values = {"3", Edge("4", "3", -1, "edge1", 0, {})};
-                ds2.rows.emplace_back(std::move(row));
-            }
-            qctx_->ectx()->setResult("backward3", ResultBuilder().value(ds2).finish());
-        }
-        {
-            // 5->4
-            DataSet ds1;
-            ds1.colNames = {kVid, "edge"};
-            {
-                Row row;
-                row.values = {"5", Value::kEmpty};
-                ds1.rows.emplace_back(std::move(row));
-            }
-            qctx_->ectx()->setResult("backward4", ResultBuilder().value(ds1).finish());
+    ConjunctPathExecutor* makeBfsExecutor(const std::string& backwardVar) {
+        auto* conjunct = ConjunctPath::make(qctx_.get(),
+                                            StartNode::make(qctx_.get()),
+                                            StartNode::make(qctx_.get()),
+                                            ConjunctPath::PathKind::kBiBFS,
+                                            5);
+        conjunct->setLeftVar("forward1");
+        conjunct->setRightVar(backwardVar);
+        conjunct->setDirectionVar("bfsDirection");
+        conjunct->setColNames({"_path"});
+        return qctx_->objPool()->add(new ConjunctPathExecutor(conjunct, qctx_.get()));
+    }
 
-            DataSet ds2;
-            ds2.colNames = {kVid, "edge"};
-            {
-                Row row;
-                row.values = {"4", Edge("5", "4", -1, "edge1", 0, {})};
-                ds2.rows.emplace_back(std::move(row));
-            }
-            qctx_->ectx()->setResult("backward4", ResultBuilder().value(ds2).finish());
-        }
+    // 1->2, 1->3
+    static std::vector<Row> forwardFirstStep() {
+        return {Row({"2", Edge("1", "2", 1, "edge1", 0, {})}),
+                Row({"3", Edge("1", "3", 1, "edge1", 0, {})})};
     }
 
     void allPathInit() {
@@ -633,150 +589,69 @@ protected:
 };
 
 TEST_F(ConjunctPathTest, BiBFSNoPath) {
-    auto* conjunct = ConjunctPath::make(qctx_.get(),
-                                        StartNode::make(qctx_.get()),
-                                        StartNode::make(qctx_.get()),
-                                        ConjunctPath::PathKind::kBiBFS,
-                                        5);
-    conjunct->setLeftVar("forward1");
-    conjunct->setRightVar("backward1");
-    conjunct->setColNames({"_path"});
-
-    auto conjunctExe = std::make_unique<ConjunctPathExecutor>(conjunct, qctx_.get());
-    auto future = conjunctExe->execute();
-    auto status = std::move(future).get();
-    EXPECT_TRUE(status.ok());
-    auto& result = qctx_->ectx()->getResult(conjunct->outputVar());
+    auto* exe = makeBfsExecutor("backward1");
+    auto& result = expandBfs(exe, true, "forward1", forwardFirstStep());
 
     DataSet expected;
     expected.colNames = {"_path"};
-    EXPECT_EQ(result.value().getDataSet(), expected);
-    EXPECT_EQ(result.state(), Result::State::kSuccess);
+    EXPECT_EQ(result, expected);
 }
 
 TEST_F(ConjunctPathTest, BiBFSOneStepPath) {
-    auto* conjunct = ConjunctPath::make(qctx_.get(),
-                                        StartNode::make(qctx_.get()),
-                                        StartNode::make(qctx_.get()),
-                                        ConjunctPath::PathKind::kBiBFS,
-                                        5);
-    conjunct->setLeftVar("forward1");
-    conjunct->setRightVar("backward2");
-    conjunct->setColNames({"_path"});
-
-    auto conjunctExe = std::make_unique<ConjunctPathExecutor>(conjunct, qctx_.get());
-    auto future = conjunctExe->execute();
-    auto status = std::move(future).get();
-    EXPECT_TRUE(status.ok());
-    auto& result = qctx_->ectx()->getResult(conjunct->outputVar());
+    auto* exe = makeBfsExecutor("backward2");
+    auto& result = expandBfs(exe, true, "forward1", forwardFirstStep());
 
     DataSet expected;
     expected.colNames = {"_path"};
     Row row;
-    Path path;
-    path.src = Vertex("1", {});
-    path.steps.emplace_back(Step(Vertex("2", {}), 1, "edge1", 0, {}));
-    row.values.emplace_back(std::move(path));
+    row.values.emplace_back(createPath("1", {"2"}, 1));
     expected.rows.emplace_back(std::move(row));
-
-    EXPECT_EQ(result.value().getDataSet(), expected);
-    EXPECT_EQ(result.state(), Result::State::kSuccess);
+    EXPECT_EQ(result, expected);
 }
 
 TEST_F(ConjunctPathTest, BiBFSTwoStepsPath) {
-    auto* conjunct = ConjunctPath::make(qctx_.get(),
-                                        StartNode::make(qctx_.get()),
-                                        StartNode::make(qctx_.get()),
-                                        ConjunctPath::PathKind::kBiBFS,
-                                        5);
-    conjunct->setLeftVar("forward1");
-    conjunct->setRightVar("backward3");
-    conjunct->setColNames({"_path"});
-
-    auto conjunctExe = std::make_unique<ConjunctPathExecutor>(conjunct, qctx_.get());
-    auto future = conjunctExe->execute();
-    auto status = std::move(future).get();
-    EXPECT_TRUE(status.ok());
-    auto& result = qctx_->ectx()->getResult(conjunct->outputVar());
-
+    auto* exe = makeBfsExecutor("backward3");
     DataSet expected;
     expected.colNames = {"_path"};
-    Row row;
-    Path path;
-    path.src = Vertex("1", {});
-    path.steps.emplace_back(Step(Vertex("3", {}), 1, "edge1", 0, {}));
-    path.steps.emplace_back(Step(Vertex("4", {}), 1, "edge1", 0, {}));
-    row.values.emplace_back(std::move(path));
-    expected.rows.emplace_back(std::move(row));
-
-    EXPECT_EQ(result.value().getDataSet(), expected);
-    EXPECT_EQ(result.state(), Result::State::kSuccess);
+    {
+        auto& result = expandBfs(exe, true, "forward1", forwardFirstStep());
+        EXPECT_EQ(result, expected);
+    }
+    {
+        // 4->3
+        auto& result =
+            expandBfs(exe, false, "backward3", {Row({"3", Edge("4", "3", -1, "edge1", 0, {})})});
+        Row row;
+        row.values.emplace_back(createPath("1", {"3", "4"}, 1));
+        expected.rows.emplace_back(std::move(row));
+        EXPECT_EQ(result, expected);
+    }
 }
 
 TEST_F(ConjunctPathTest, BiBFSThreeStepsPath) {
-    auto* conjunct = ConjunctPath::make(qctx_.get(),
-                                        StartNode::make(qctx_.get()),
-                                        StartNode::make(qctx_.get()),
-                                        ConjunctPath::PathKind::kBiBFS,
-                                        5);
-    conjunct->setLeftVar("forward1");
-    conjunct->setRightVar("backward4");
-    conjunct->setColNames({"_path"});
-
-    auto conjunctExe = std::make_unique<ConjunctPathExecutor>(conjunct, qctx_.get());
-
+    auto* exe = makeBfsExecutor("backward4");
+    DataSet expected;
+    expected.colNames = {"_path"};
     {
-        auto future = conjunctExe->execute();
-        auto status = std::move(future).get();
-        EXPECT_TRUE(status.ok());
-        auto& result = qctx_->ectx()->getResult(conjunct->outputVar());
-
-        DataSet expected;
-        expected.colNames = {"_path"};
-        EXPECT_EQ(result.value().getDataSet(), expected);
-        EXPECT_EQ(result.state(), Result::State::kSuccess);
+        auto& result = expandBfs(exe, true, "forward1", forwardFirstStep());
+        EXPECT_EQ(result, expected);
     }
-
     {
-        {
-            // 2->4@0
-            // 2->4@1
-            DataSet ds1;
-            ds1.colNames = {kVid, "edge"};
-            {
-                Row row;
-                row.values = {"4", Edge("2", "4", 1, "edge1", 0, {})};
-                ds1.rows.emplace_back(std::move(row));
-            }
-            {
-                Row row;
-                row.values = {"4", Edge("2", "4", 1, "edge1", 1, {})};
-                ds1.rows.emplace_back(std::move(row));
-            }
-            qctx_->ectx()->setResult("forward1", ResultBuilder().value(ds1).finish());
-        }
-        {
-            // 4->6@0
-            DataSet ds1;
-            ds1.colNames = {kVid, "edge"};
-            {
-                Row row;
-                row.values = {"6", Edge("4", "6", -1, "edge1", 0, {})};
-                ds1.rows.emplace_back(std::move(row));
-            }
-            qctx_->ectx()->setResult("backward4", ResultBuilder().value(ds1).finish());
-        }
-        auto future = conjunctExe->execute();
-        auto status = std::move(future).get();
-        EXPECT_TRUE(status.ok());
-        auto& result = qctx_->ectx()->getResult(conjunct->outputVar());
-
-        DataSet expected;
-        expected.colNames = {"_path"};
+        // 5->4
+        auto& result =
+            expandBfs(exe, false, "backward4", {Row({"4", Edge("5", "4", -1, "edge1", 0, {})})});
+        EXPECT_EQ(result, expected);
+    }
+    {
+        // 2->4@0, 2->4@1
+        auto result = expandBfs(exe,
+                                true,
+                                "forward1",
+                                {Row({"4", Edge("2", "4", 1, "edge1", 0, {})}),
+                                 Row({"4", Edge("2", "4", 1, "edge1", 1, {})})});
         {
             Row row;
-            Path path = createPath("1", {"2", "4", "5"}, 1);
-            row.values.emplace_back(std::move(path));
+            row.values.emplace_back(createPath("1", {"2", "4", "5"}, 1));
             expected.rows.emplace_back(std::move(row));
         }
         {
@@ -789,76 +664,42 @@ TEST_F(ConjunctPathTest, BiBFSThreeStepsPath) {
             row.values.emplace_back(std::move(path));
             expected.rows.emplace_back(std::move(row));
         }
-
-        EXPECT_EQ(result.value().getDataSet(), expected);
-        EXPECT_EQ(result.state(), Result::State::kSuccess);
+        std::sort(result.rows.begin(), result.rows.end(), compareBfsPath);
+        std::sort(expected.rows.begin(), expected.rows.end(), compareBfsPath);
+        EXPECT_EQ(result, expected);
     }
 }
 
 TEST_F(ConjunctPathTest, BiBFSFourStepsPath) {
-    auto* conjunct = ConjunctPath::make(qctx_.get(),
-                                        StartNode::make(qctx_.get()),
-                                        StartNode::make(qctx_.get()),
-                                        ConjunctPath::PathKind::kBiBFS,
-                                        5);
-    conjunct->setLeftVar("forward1");
-    conjunct->setRightVar("backward4");
-    conjunct->setColNames({"_path"});
-
-    auto conjunctExe = std::make_unique<ConjunctPathExecutor>(conjunct, qctx_.get());
-
+    auto* exe = makeBfsExecutor("backward4");
+    DataSet expected;
+    expected.colNames = {"_path"};
     {
-        auto future = conjunctExe->execute();
-        auto status = std::move(future).get();
-        EXPECT_TRUE(status.ok());
-        auto& result = qctx_->ectx()->getResult(conjunct->outputVar());
-
-        DataSet expected;
-        expected.colNames = {"_path"};
-        EXPECT_EQ(result.value().getDataSet(), expected);
-        EXPECT_EQ(result.state(), Result::State::kSuccess);
+        auto& result = expandBfs(exe, true, "forward1", forwardFirstStep());
+        EXPECT_EQ(result, expected);
     }
-
     {
-        {
-            // 2->6@0
-            // 2->6@1
-            DataSet ds1;
-            ds1.colNames = {kVid, "edge"};
-            {
-                Row row;
-                row.values = {"6", Edge("2", "6", 1, "edge1", 0, {})};
-                ds1.rows.emplace_back(std::move(row));
-            }
-            {
-                Row row;
-                row.values = {"6", Edge("2", "6", 1, "edge1", 1, {})};
-                ds1.rows.emplace_back(std::move(row));
-            }
-            qctx_->ectx()->setResult("forward1", ResultBuilder().value(ds1).finish());
-        }
-        {
-            // 4->6@0
-            DataSet ds1;
-            ds1.colNames = {kVid, "edge"};
-            {
-                Row row;
-                row.values = {"6", Edge("4", "6", -1, "edge1", 0, {})};
-                ds1.rows.emplace_back(std::move(row));
-            }
-            qctx_->ectx()->setResult("backward4", ResultBuilder().value(ds1).finish());
-        }
-        auto future = conjunctExe->execute();
-        auto status = std::move(future).get();
-        EXPECT_TRUE(status.ok());
-        auto& result = qctx_->ectx()->getResult(conjunct->outputVar());
-
-        DataSet expected;
-        expected.colNames = {"_path"};
+        // 5->4
+        auto& result =
+            expandBfs(exe, false, "backward4", {Row({"4", Edge("5", "4", -1, "edge1", 0, {})})});
+        EXPECT_EQ(result, expected);
+    }
+    {
+        // 2->6@0, 2->6@1
+        auto& result = expandBfs(exe,
+                                 true,
+                                 "forward1",
+                                 {Row({"6", Edge("2", "6", 1, "edge1", 0, {})}),
+                                  Row({"6", Edge("2", "6", 1, "edge1", 1, {})})});
+        EXPECT_EQ(result, expected);
+    }
+    {
+        // 4->6
+        auto result =
+            expandBfs(exe, false, "backward4", {Row({"6", Edge("4", "6", -1, "edge1", 0, {})})});
         {
             Row row;
-            Path path = createPath("1", {"2", "6", "4", "5"}, 1);
-            row.values.emplace_back(std::move(path));
+            row.values.emplace_back(createPath("1", {"2", "6", "4", "5"}, 1));
             expected.rows.emplace_back(std::move(row));
         }
         {
@@ -872,10 +713,65 @@ TEST_F(ConjunctPathTest, BiBFSFourStepsPath) {
             row.values.emplace_back(std::move(path));
             expected.rows.emplace_back(std::move(row));
         }
+        std::sort(result.rows.begin(), result.rows.end(), compareBfsPath);
+        std::sort(expected.rows.begin(), expected.rows.end(), compareBfsPath);
+        EXPECT_EQ(result, expected);
+    }
+}
 
-        EXPECT_EQ(result.value().getDataSet(), expected);
-        EXPECT_EQ(result.state(), Result::State::kSuccess);
+TEST_F(ConjunctPathTest, BiBFSFourStepsPathTrimmed) {
+    auto* exe = makeBfsExecutor("backward4");
+    // The steps copy the edges, so only the latest versions of the inputs are kept
+    auto* symTable = qctx_->symTable();
+    symTable->analyzeHistory();
+    EXPECT_EQ(1u, symTable->getVar("forward1")->numVersionsToKeep);
+    EXPECT_EQ(1u, symTable->getVar("backward4")->numVersionsToKeep);
+    // Trim the inputs as the scheduler does after each step
+    auto expand = [this, exe, symTable](bool isForward,
+                                        const std::string& var,
+                                        std::vector<Row> rows) {
+        setBfsStep(var, std::move(rows));
+        qctx_->ectx()->truncHistory(var, symTable->getVar(var)->numVersionsToKeep);
+        EXPECT_EQ(1u, qctx_->ectx()->numVersions(var));
+        qctx_->ectx()->setResult("bfsDirection", ResultBuilder().value(isForward).finish());
+        auto status = exe->execute().get();
+        EXPECT_TRUE(status.ok());
+        return qctx_->ectx()->getResult(exe->node()->outputVar()).value().getDataSet();
+    };
+
+    DataSet expected;
+    expected.colNames = {"_path"};
+    EXPECT_EQ(expand(true, "forward1", forwardFirstStep()), expected);
+    // 5->4
+    EXPECT_EQ(expand(false, "backward4", {Row({"4", Edge("5", "4", -1, "edge1", 0, {})})}),
+              expected);
+    // 2->6@0, 2->6@1
+    EXPECT_EQ(expand(true,
+                     "forward1",
+                     {Row({"6", Edge("2", "6", 1, "edge1", 0, {})}),
+                      Row({"6", Edge("2", "6", 1, "edge1", 1, {})})}),
+              expected);
+    // 4->6
+    auto result = expand(false, "backward4", {Row({"6", Edge("4", "6", -1, "edge1", 0, {})})});
+    {
+        Row row;
+        row.values.emplace_back(createPath("1", {"2", "6", "4", "5"}, 1));
+        expected.rows.emplace_back(std::move(row));
+    }
+    {
+        Row row;
+        Path path;
+        path.src = Vertex("1", {});
+        path.steps.emplace_back(Step(Vertex("2", {}), 1, "edge1", 0, {}));
+        path.steps.emplace_back(Step(Vertex("6", {}), 1, "edge1", 1, {}));
+        path.steps.emplace_back(Step(Vertex("4", {}), 1, "edge1", 0, {}));
+        path.steps.emplace_back(Step(Vertex("5", {}), 1, "edge1", 0, {}));
+        row.values.emplace_back(std::move(path));
+        expected.rows.emplace_back(std::move(row));
     }
+    std::sort(result.rows.begin(), result.rows.end(), compareBfsPath);
+    std::sort(expected.rows.begin(), expected.rows.end(), compareBfsPath);
+    EXPECT_EQ(result, expected);
 }
 
 TEST_F(ConjunctPathTest, AllPathsNoPath) {
@@ -1268,5 +1164,257 @@ TEST_F(ConjunctPathTest, multiplePairThreeSteps) {
     EXPECT_EQ(result.state(), Result::State::kSuccess);
 }
 
+TEST_F(ConjunctPathTest, weightedPair) {
+    /*
+     *  0->1 (5), 0->2 (1), 2->1 (1), 1->3 (1)
+     *  startVids {0}
+     *  endVids {3}
+     */
+    qctx_->symTable()->newVariable("weightedForward");
+    qctx_->symTable()->newVariable("weightedBackward");
+    qctx_->symTable()->newVariable("weightedConditionalVar");
+    qctx_->ectx()->setResult("weightedConditionalVar",
+                             ResultBuilder().value(DataSet({kVid, kVid})).finish());
+    auto paths = [this] (const std::string& src, const std::vector<std::string>& steps, int type) {
+        List list;
+        list.values.emplace_back(createPath(src, steps, type));
+        return list;
+    };
+    auto setPaths = [this] (const std::string& var, std::vector<Row> rows) {
+        DataSet ds({"_dst", "_src", "cost", "paths"});
+        ds.rows = std::move(rows);
+        qctx_->ectx()->setResult(var, ResultBuilder().value(std::move(ds)).finish());
+    };
+    setPaths("weightedForward", {Row({"0", "0", 0, paths("0", {}, 1)})});
+    setPaths("weightedBackward", {Row({"3", "3", 0, paths("3", {}, -1)})});
+
+    auto* conjunct = ConjunctPath::make(qctx_.get(),
+                                        StartNode::make(qctx_.get()),
+                                        StartNode::make(qctx_.get()),
+                                        ConjunctPath::PathKind::kBiLabelCorrecting,
+                                        4);
+    conjunct->setLeftVar("weightedForward");
+    conjunct->setRightVar("weightedBackward");
+    conjunct->setColNames({"_path", "cost"});
+    conjunct->setConditionalVar("weightedConditionalVar");
+    auto conjunctExe = std::make_unique<ConjunctPathExecutor>(conjunct, qctx_.get());
+    {
+        setPaths("weightedForward",
+                 {Row({"1", "0", 5, paths("0", {"1"}, 1)}),
+                  Row({"2", "0", 1, paths("0", {"2"}, 1)})});
+        setPaths("weightedBackward", {Row({"1", "3", 1, paths("3", {"1"}, -1)})});
+        auto status = conjunctExe->execute().get();
+        EXPECT_TRUE(status.ok());
+        auto& result = qctx_->ectx()->getResult(conjunct->outputVar());
+
+        DataSet expected({"_path", "cost"});
+        expected.emplace_back(Row({createPath("0", {"1", "3"}, 1), 6}));
+        EXPECT_EQ(result.value().getDataSet(), expected);
+    }
+    {
+        // The path of more steps is cheaper
+        setPaths("weightedForward", {Row({"1", "0", 2, paths("0", {"2", "1"}, 1)})});
+        setPaths("weightedBackward", {});
+        auto status = conjunctExe->execute().get();
+        EXPECT_TRUE(status.ok());
+        auto& result = qctx_->ectx()->getResult(conjunct->outputVar());
+
+        DataSet expected({"_path", "cost"});
+        expected.emplace_back(Row({createPath("0", {"2", "1", "3"}, 1), 3}));
+        EXPECT_EQ(result.value().getDataSet(), expected);
+    }
+}
+
+TEST_F(ConjunctPathTest, weightedPairOddSteps) {
+    /*
+     *  0->1 (1), 1->2 (1), 2->5 (1), 5->9 (10), 5->7 (1), 7->8 (1), 8->9 (1)
+     *  startVids {0}
+     *  endVids {9}
+     *  UPTO 5 STEPS
+     */
+    qctx_->symTable()->newVariable("weightedForward");
+    qctx_->symTable()->newVariable("weightedBackward");
+    qctx_->symTable()->newVariable("weightedConditionalVar");
+    qctx_->ectx()->setResult("weightedConditionalVar",
+                             ResultBuilder().value(DataSet({kVid, kVid})).finish());
+    auto paths = [this] (const std::string& src, const std::vector<std::string>& steps, int type) {
+        List list;
+        list.values.emplace_back(createPath(src, steps, type));
+        return list;
+    };
+    auto setPaths = [this] (const std::string& var, std::vector<Row> rows) {
+        DataSet ds({"_dst", "_src", "cost", "paths"});
+        ds.rows = std::move(rows);
+        qctx_->ectx()->setResult(var, ResultBuilder().value(std::move(ds)).finish());
+    };
+    setPaths("weightedForward", {Row({"0", "0", 0, paths("0", {}, 1)})});
+    setPaths("weightedBackward", {Row({"9", "9", 0, paths("9", {}, -1)})});
+
+    auto* conjunct = ConjunctPath::make(qctx_.get(),
+                                        StartNode::make(qctx_.get()),
+                                        StartNode::make(qctx_.get()),
+                                        ConjunctPath::PathKind::kBiLabelCorrecting,
+                                        5);
+    conjunct->setLeftVar("weightedForward");
+    conjunct->setRightVar("weightedBackward");
+    conjunct->setColNames({"_path", "cost"});
+    conjunct->setConditionalVar("weightedConditionalVar");
+    auto conjunctExe = std::make_unique<ConjunctPathExecutor>(conjunct, qctx_.get());
+    DataSet expected({"_path", "cost"});
+    {
+        setPaths("weightedForward", {Row({"1", "0", 1, paths("0", {"1"}, 1)})});
+        setPaths("weightedBackward",
+                 {Row({"5", "9", 10, paths("9", {"5"}, -1)}),
+                  Row({"8", "9", 1, paths("9", {"8"}, -1)})});
+        auto status = conjunctExe->execute().get();
+        EXPECT_TRUE(status.ok());
+        auto& result = qctx_->ectx()->getResult(conjunct->outputVar());
+        EXPECT_EQ(result.value().getDataSet(), expected);
+    }
+    {
+        setPaths("weightedForward", {Row({"2", "0", 2, paths("0", {"1", "2"}, 1)})});
+        setPaths("weightedBackward", {Row({"7", "9", 2, paths("9", {"8", "7"}, -1)})});
+        auto status = conjunctExe->execute().get();
+        EXPECT_TRUE(status.ok());
+        auto& result = qctx_->ectx()->getResult(conjunct->outputVar());
+        EXPECT_EQ(result.value().getDataSet(), expected);
+    }
+    {
+        // The cheaper backward path of 3 steps to 5 doesn't fit the steps with the forward one,
+        // while the costlier one of 1 step does
+        setPaths("weightedForward", {Row({"5", "0", 3, paths("0", {"1", "2", "5"}, 1)})});
+        setPaths("weightedBackward", {Row({"5", "9", 3, paths("9", {"8", "7", "5"}, -1)})});
+        auto status = conjunctExe->execute().get();
+        EXPECT_TRUE(status.ok());
+        auto& result = qctx_->ectx()->getResult(conjunct->outputVar());
+
+        expected.emplace_back(Row({createPath("0", {"1", "2", "5", "9"}, 1), 13}));
+        EXPECT_EQ(result.value().getDataSet(), expected);
+    }
+}
+
+TEST_F(ConjunctPathTest, multiSourcePair) {
+    /*
+     *  0->2, 1->2, 2->3
+     *  startVids {0, 1}
+     *  endVids {3}
+     */
+    qctx_->symTable()->newVariable("multiSourceForward");
+    qctx_->symTable()->newVariable("multiSourceBackward");
+    qctx_->symTable()->newVariable("multiSourceTermination");
+    auto sources = [] (std::vector<size_t> indexes) {
+        SourceBits bits;
+        for (auto index : indexes) {
+            bits.set(index);
+        }
+        return bits.encode();
+    };
+    auto setSources = [this] (const std::string& var, std::vector<Row> rows) {
+        DataSet ds({"_dst", "edge", "sources"});
+        ds.rows = std::move(rows);
+        qctx_->ectx()->setResult(var, ResultBuilder().value(std::move(ds)).finish());
+    };
+    setSources("multiSourceForward",
+               {Row({"2", Edge("0", "2", 1, "edge1", 0, {}), sources({0})}),
+                Row({"2", Edge("1", "2", 1, "edge1", 0, {}), sources({1})})});
+    setSources("multiSourceBackward",
+               {Row({"2", Edge("3", "2", -1, "edge1", 0, {}), sources({0})})});
+
+    auto* conjunct = ConjunctPath::make(qctx_.get(),
+                                        StartNode::make(qctx_.get()),
+                                        StartNode::make(qctx_.get()),
+                                        ConjunctPath::PathKind::kMultiSourceBFS,
+                                        5);
+    conjunct->setLeftVar("multiSourceForward");
+    conjunct->setRightVar("multiSourceBackward");
+    conjunct->setColNames({"_path", "cost"});
+    conjunct->setTerminationVar("multiSourceTermination");
+    auto conjunctExe = std::make_unique<ConjunctPathExecutor>(conjunct, qctx_.get());
+    auto status = conjunctExe->execute().get();
+    EXPECT_TRUE(status.ok());
+    auto& result = qctx_->ectx()->getResult(conjunct->outputVar());
+
+    DataSet expected({"_path", "cost"});
+    expected.emplace_back(Row({createPath("0", {"2", "3"}, 1), 2}));
+    expected.emplace_back(Row({createPath("1", {"2", "3"}, 1), 2}));
+    auto resultDs = result.value().getDataSet();
+    std::sort(resultDs.rows.begin(), resultDs.rows.end(), comparePath);
+    EXPECT_EQ(resultDs, expected);
+    EXPECT_EQ(result.state(), Result::State::kSuccess);
+    // The paths of all the pairs are found
+    EXPECT_EQ(qctx_->ectx()->getValue("multiSourceTermination"), Value(true));
+}
+
+TEST_F(ConjunctPathTest, multiSourcePrune) {
+    /*
+     *  0->2, 2->3, 1->4, 4->5
+     *  startVids {0, 1}
+     *  endVids {3}
+     */
+    qctx_->symTable()->newVariable("pruneForward");
+    qctx_->symTable()->newVariable("pruneBackward");
+    qctx_->symTable()->newVariable("pruneForwardFrontier");
+    qctx_->symTable()->newVariable("pruneBackwardFrontier");
+    qctx_->symTable()->newVariable("pruneTermination");
+    auto sources = [] (size_t index) {
+        SourceBits bits;
+        bits.set(index);
+        return bits.encode();
+    };
+    auto setResult = [this] (const std::string& var, DataSet ds) {
+        qctx_->ectx()->setResult(var, ResultBuilder().value(std::move(ds)).finish());
+    };
+    DataSet forward({"_dst", "edge", "sources"});
+    forward.emplace_back(Row({"2", Edge("0", "2", 1, "edge1", 0, {}), sources(0)}));
+    forward.emplace_back(Row({"4", Edge("1", "4", 1, "edge1", 0, {}), sources(1)}));
+    setResult("pruneForward", forward);
+    DataSet backward({"_dst", "edge", "sources"});
+    backward.emplace_back(Row({"2", Edge("3", "2", -1, "edge1", 0, {}), sources(0)}));
+    setResult("pruneBackward", backward);
+    DataSet forwardFrontier({kVid});
+    forwardFrontier.emplace_back(Row({"2"}));
+    forwardFrontier.emplace_back(Row({"4"}));
+    setResult("pruneForwardFrontier", forwardFrontier);
+    DataSet backwardFrontier({kVid});
+    backwardFrontier.emplace_back(Row({"2"}));
+    setResult("pruneBackwardFrontier", backwardFrontier);
+
+    auto* conjunct = ConjunctPath::make(qctx_.get(),
+                                        StartNode::make(qctx_.get()),
+                                        StartNode::make(qctx_.get()),
+                                        ConjunctPath::PathKind::kMultiSourceBFS,
+                                        5);
+    conjunct->setLeftVar("pruneForward");
+    conjunct->setRightVar("pruneBackward");
+    conjunct->setColNames({"_path", "cost"});
+    conjunct->setTerminationVar("pruneTermination");
+    conjunct->setFrontierVars("pruneForwardFrontier", "pruneBackwardFrontier");
+    auto conjunctExe = std::make_unique<ConjunctPathExecutor>(conjunct, qctx_.get());
+    auto status = conjunctExe->execute().get();
+    EXPECT_TRUE(status.ok());
+
+    DataSet expected({"_path", "cost"});
+    expected.emplace_back(Row({createPath("0", {"2", "3"}, 1), 2}));
+    EXPECT_EQ(qctx_->ectx()->getResult(conjunct->outputVar()).value().getDataSet(), expected);
+    // The vertex 2 only carries the start 0 whose path is found
+    DataSet expectedForwardFrontier({kVid});
+    expectedForwardFrontier.emplace_back(Row({"4"}));
+    EXPECT_EQ(qctx_->ectx()->getResult("pruneForwardFrontier").value().getDataSet(),
+              expectedForwardFrontier);
+    // The end 3 still waits for the start 1
+    EXPECT_EQ(qctx_->ectx()->getResult("pruneBackwardFrontier").value().getDataSet(),
+              backwardFrontier);
+    EXPECT_EQ(qctx_->ectx()->getValue("pruneTermination"), Value(false));
+
+    // Nothing left to expand by the forward side
+    setResult("pruneForward", DataSet({"_dst", "edge", "sources"}));
+    setResult("pruneBackward", DataSet({"_dst", "edge", "sources"}));
+    status = conjunctExe->execute().get();
+    EXPECT_TRUE(status.ok());
+    auto& result = qctx_->ectx()->getResult(conjunct->outputVar());
+    EXPECT_TRUE(result.value().getDataSet().rows.empty());
+    EXPECT_EQ(qctx_->ectx()->getValue("pruneTermination"), Value(true));
+}
+
 }  // namespace graph
 }  // namespace nebula
@@ -9,6 +9,7 @@
 #include "context/QueryContext.h"
 #include "planner/Query.h"
 #include "executor/query/DataCollectExecutor.h"
+#include "service/GraphFlags.h"
 
 namespace nebula {
 namespace graph {
@@ -187,6 +188,62 @@ TEST_F(DataCollectTest, CollectSubgraph) {
     EXPECT_EQ(result.state(), Result::State::kSuccess);
 }
 
+TEST_F(DataCollectTest, CollectSubgraphInParallel) {
+    // The steps overlap in the vertices and edges, and the last one is not collected
+    auto makeStep = [](int64_t start, int64_t end) {
+        DataSet ds;
+        ds.colNames = {kVid,
+                       "_stats",
+                       "_tag:tag1:prop1",
+                       "_edge:+edge1:prop1:_dst:_type:_rank",
+                       "_expr"};
+        for (auto i = start; i < end; ++i) {
+            List edges;
+            for (auto j = 0; j < 2; ++j) {
+                edges.values.emplace_back(
+                    List({j, folly::to<std::string>(i + j + 1), 1, 0}));
+            }
+            ds.rows.emplace_back(Row({folly::to<std::string>(i),
+                                      Value(),
+                                      Value(List({i})),
+                                      Value(std::move(edges)),
+                                      Value()}));
+        }
+        List datasets;
+        datasets.values.emplace_back(std::move(ds));
+        return ResultBuilder()
+            .value(Value(std::move(datasets)))
+            .iter(Iterator::Kind::kGetNeighbors)
+            .finish();
+    };
+    qctx_->symTable()->newVariable("subgraph_steps");
+    qctx_->ectx()->setResult("subgraph_steps", makeStep(0, 4));
+    qctx_->ectx()->setResult("subgraph_steps", makeStep(2, 8));
+    qctx_->ectx()->setResult("subgraph_steps", makeStep(1, 10));
+    qctx_->ectx()->setResult("subgraph_steps", makeStep(0, 1));
+
+    auto collect = [this](int64_t minParallelRows) {
+        auto* dc = DataCollect::make(qctx_.get(), nullptr,
+                DataCollect::CollectKind::kSubgraph, {"subgraph_steps"});
+        dc->setColNames(std::vector<std::string>{"_vertices", "_edges"});
+        auto minRows = FLAGS_min_parallel_subgraph_rows;
+        FLAGS_min_parallel_subgraph_rows = minParallelRows;
+        auto dcExe = std::make_unique<DataCollectExecutor>(dc, qctx_.get());
+        auto status = dcExe->execute().get();
+        FLAGS_min_parallel_subgraph_rows = minRows;
+        EXPECT_TRUE(status.ok()) << status;
+        return qctx_->ectx()->getResult(dc->outputVar()).value().getDataSet();
+    };
+    auto serial = collect(0);
+    auto parallel = collect(1);
+    ASSERT_EQ(3, serial.rows.size());
+    // The vertices 0-3, 4-7 and 8-9 are collected by the steps
+    EXPECT_EQ(4, serial.rows[0].values[0].getList().size());
+    EXPECT_EQ(4, serial.rows[1].values[0].getList().size());
+    EXPECT_EQ(2, serial.rows[2].values[0].getList().size());
+    EXPECT_EQ(serial, parallel);
+}
+
 TEST_F(DataCollectTest, RowBasedMove) {
     auto* dc = DataCollect::make(qctx_.get(), nullptr,
             DataCollect::CollectKind::kRowBasedMove, {"input_sequential"});
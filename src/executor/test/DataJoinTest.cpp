@@ -10,6 +10,7 @@
 #include "planner/Query.h"
 #include "executor/query/DataJoinExecutor.h"
 #include "executor/test/QueryTestBase.h"
+#include "service/GraphFlags.h"
 
 namespace nebula {
 namespace graph {
@@ -78,6 +79,14 @@ protected:
 
     void testJoin(std::string left, std::string right, DataSet& expected, int64_t line);
 
+    // Join $left.leftKey with $right.rightKey by the kind, and collect the rows joined
+    DataSet join(const std::string& left,
+                 const std::string& leftKey,
+                 const std::string& right,
+                 const std::string& rightKey,
+                 DataJoin::JoinKind kind,
+                 std::vector<std::string> colNames);
+
 protected:
     std::unique_ptr<QueryContext> qctx_;
 };
@@ -122,6 +131,41 @@ void DataJoinTest::testJoin(std::string left, std::string right,
     EXPECT_EQ(result.state(), Result::State::kSuccess) << "LINE: " << line;
 }
 
+DataSet DataJoinTest::join(const std::string& left,
+                           const std::string& leftKey,
+                           const std::string& right,
+                           const std::string& rightKey,
+                           DataJoin::JoinKind kind,
+                           std::vector<std::string> colNames) {
+    VariablePropertyExpression key(new std::string(left), new std::string(leftKey));
+    std::vector<Expression*> hashKeys = {&key};
+    VariablePropertyExpression probe(new std::string(right), new std::string(rightKey));
+    std::vector<Expression*> probeKeys = {&probe};
+
+    auto* dataJoin = DataJoin::make(
+        qctx_.get(), nullptr, {left, 0}, {right, 0}, std::move(hashKeys), std::move(probeKeys));
+    dataJoin->setJoinKind(kind);
+    dataJoin->setColNames(colNames);
+
+    auto dataJoinExe = std::make_unique<DataJoinExecutor>(dataJoin, qctx_.get());
+    auto status = dataJoinExe->execute().get();
+    EXPECT_TRUE(status.ok());
+    auto& result = qctx_->ectx()->getResult(dataJoin->outputVar());
+    EXPECT_EQ(result.state(), Result::State::kSuccess);
+
+    DataSet resultDs;
+    resultDs.colNames = std::move(colNames);
+    for (auto iter = result.iter(); iter->valid(); iter->next()) {
+        const auto& cols = *iter->row();
+        Row row;
+        for (size_t i = 0; i < cols.size(); ++i) {
+            row.values.emplace_back(cols[i]);
+        }
+        resultDs.rows.emplace_back(std::move(row));
+    }
+    return resultDs;
+}
+
 TEST_F(DataJoinTest, Join) {
     DataSet expected;
     expected.colNames = {
@@ -150,6 +194,61 @@ TEST_F(DataJoinTest, Join) {
     testJoin("var2", "var1", expected, __LINE__);
 }
 
+TEST_F(DataJoinTest, ParallelJoin) {
+    auto minRows = FLAGS_min_parallel_join_rows;
+    auto numParts = FLAGS_num_join_partitions;
+    FLAGS_min_parallel_join_rows = 1;
+    FLAGS_num_join_partitions = 3;
+
+    std::string left = "var2";
+    std::string right = "var1";
+    VariablePropertyExpression key(new std::string(left), new std::string("dst"));
+    std::vector<Expression*> hashKeys = {&key};
+    VariablePropertyExpression probe(new std::string(right), new std::string("_vid"));
+    std::vector<Expression*> probeKeys = {&probe};
+
+    auto* dataJoin = DataJoin::make(
+        qctx_.get(), nullptr, {left, 0}, {right, 0}, std::move(hashKeys), std::move(probeKeys));
+    dataJoin->setColNames(
+        std::vector<std::string>{"src", "dst", kVid, "tag_prop", "edge_prop", kDst});
+
+    auto dataJoinExe = std::make_unique<DataJoinExecutor>(dataJoin, qctx_.get());
+    auto future = dataJoinExe->execute();
+    auto status = std::move(future).get();
+    EXPECT_TRUE(status.ok());
+    auto& result = qctx_->ectx()->getResult(dataJoin->outputVar());
+
+    // The rows are grouped by partitions, so compare them without order
+    std::vector<Row> rows;
+    for (auto iter = result.iter(); iter->valid(); iter->next()) {
+        const auto& cols = *iter->row();
+        Row row;
+        for (size_t i = 0; i < cols.size(); ++i) {
+            row.values.emplace_back(cols[i]);
+        }
+        rows.emplace_back(std::move(row));
+    }
+
+    std::vector<Row> expected;
+    for (auto i = 11; i < 16; ++i) {
+        auto src = folly::to<std::string>(i);
+        auto dst = folly::to<std::string>(i % 11);
+        expected.emplace_back(Row({src, dst, dst, i % 11 * 2, i % 11 * 2 + 1,
+                                   folly::to<std::string>(i - 6)}));
+        expected.emplace_back(Row({src, dst, dst, i % 11 * 2 + 1, i % 11 * 2 + 2,
+                                   folly::to<std::string>(i - 5)}));
+    }
+
+    auto cmp = [](const Row& lhs, const Row& rhs) { return lhs.values < rhs.values; };
+    std::sort(rows.begin(), rows.end(), cmp);
+    std::sort(expected.begin(), expected.end(), cmp);
+    EXPECT_EQ(rows, expected);
+    EXPECT_EQ(result.state(), Result::State::kSuccess);
+
+    FLAGS_min_parallel_join_rows = minRows;
+    FLAGS_num_join_partitions = numParts;
+}
+
 TEST_F(DataJoinTest, JoinTwice) {
     std::string join;
     {
@@ -257,5 +356,101 @@ TEST_F(DataJoinTest, JoinEmpty) {
         testJoin("empty_var2", "empty_var1", expected, __LINE__);
     }
 }
+
+TEST_F(DataJoinTest, JoinWithMemoryTracker) {
+    MemoryTracker tracker(1, "GO FROM 1 OVER e YIELD $$.tag.prop");
+    qctx_->ectx()->setMemoryTracker(&tracker);
+
+    // The joined rows refer to the rows of the inputs, so no more memory is charged
+    auto result = join("var2", "src", "var3", "col1", DataJoin::JoinKind::kInner,
+                       {"src", "dst", "col1"});
+    DataSet expected({"src", "dst", "col1"});
+    expected.emplace_back(Row({"11", "0", "11"}));
+    EXPECT_EQ(result, expected);
+    EXPECT_EQ(0, tracker.used());
+
+    qctx_->ectx()->setMemoryTracker(nullptr);
+}
+
+TEST_F(DataJoinTest, LeftJoin) {
+    {
+        // $var2 left join $var3 on $var2.src = $var3.col1
+        auto result = join("var2", "src", "var3", "col1", DataJoin::JoinKind::kLeft,
+                           {"src", "dst", "col1"});
+        DataSet expected;
+        expected.colNames = {"src", "dst", "col1"};
+        expected.rows.emplace_back(Row({"11", "0", "11"}));
+        for (auto i = 12; i < 16; ++i) {
+            expected.rows.emplace_back(Row({folly::to<std::string>(i),
+                                            folly::to<std::string>(i % 11),
+                                            Value::kNullValue}));
+        }
+        EXPECT_EQ(result, expected);
+    }
+    {
+        // All the rows of the left are padded
+        auto result = join("var2", "dst", "empty_var1", kVid, DataJoin::JoinKind::kLeft,
+                           {"src", "dst", kVid, "tag_prop", "edge_prop", kDst});
+        DataSet expected;
+        expected.colNames = {"src", "dst", kVid, "tag_prop", "edge_prop", kDst};
+        for (auto i = 11; i < 16; ++i) {
+            expected.rows.emplace_back(Row({folly::to<std::string>(i),
+                                            folly::to<std::string>(i % 11),
+                                            Value::kNullValue,
+                                            Value::kNullValue,
+                                            Value::kNullValue,
+                                            Value::kNullValue}));
+        }
+        EXPECT_EQ(result, expected);
+    }
+    {
+        auto result = join("empty_var2", "dst", "var1", kVid, DataJoin::JoinKind::kLeft,
+                           {"src", "dst", kVid, "tag_prop", "edge_prop", kDst});
+        EXPECT_TRUE(result.rows.empty());
+    }
+}
+
+TEST_F(DataJoinTest, SemiJoin) {
+    {
+        auto result = join("var2", "src", "var3", "col1", DataJoin::JoinKind::kSemi,
+                           {"src", "dst"});
+        DataSet expected;
+        expected.colNames = {"src", "dst"};
+        expected.rows.emplace_back(Row({"11", "0"}));
+        EXPECT_EQ(result, expected);
+    }
+    {
+        // Each row of the left is kept once, though it matches two rows of the right
+        auto result = join("var2", "dst", "var1", kVid, DataJoin::JoinKind::kSemi,
+                           {"src", "dst"});
+        EXPECT_EQ(result.rows.size(), 5);
+    }
+    {
+        auto result = join("var2", "dst", "empty_var1", kVid, DataJoin::JoinKind::kSemi,
+                           {"src", "dst"});
+        EXPECT_TRUE(result.rows.empty());
+    }
+}
+
+TEST_F(DataJoinTest, AntiJoin) {
+    {
+        // The rows are erased unstably, so compare them without order
+        auto result = join("var2", "src", "var3", "col1", DataJoin::JoinKind::kAnti,
+                           {"src", "dst"});
+        std::vector<Row> expected;
+        for (auto i = 12; i < 16; ++i) {
+            expected.emplace_back(
+                Row({folly::to<std::string>(i), folly::to<std::string>(i % 11)}));
+        }
+        auto cmp = [](const Row& lhs, const Row& rhs) { return lhs.values < rhs.values; };
+        std::sort(result.rows.begin(), result.rows.end(), cmp);
+        EXPECT_EQ(result.rows, expected);
+    }
+    {
+        auto result = join("var2", "dst", "empty_var1", kVid, DataJoin::JoinKind::kAnti,
+                           {"src", "dst"});
+        EXPECT_EQ(result.rows.size(), 5);
+    }
+}
 }  // namespace graph
 }  // namespace nebula
@@ -10,6 +10,7 @@
 #include "executor/query/ProjectExecutor.h"
 #include "executor/test/QueryTestBase.h"
 #include "planner/Query.h"
+#include "service/GraphFlags.h"
 #include "util/ExpressionUtils.h"
 
 namespace nebula {
@@ -88,6 +89,67 @@ TEST_F(FilterTest, TestSequential) {
                         expected);
 }
 
+TEST_F(FilterTest, TestMorsels) {
+    auto minRows = FLAGS_min_morsel_parallel_rows;
+    auto morselSize = FLAGS_morsel_size;
+    FLAGS_min_morsel_parallel_rows = 1;
+    FLAGS_morsel_size = 1;
+    {
+        DataSet expected({"name"});
+        expected.emplace_back(Row({Value("Ann")}));
+        expected.emplace_back(Row({Value("Ann")}));
+        expected.emplace_back(Row({Value("Tom")}));
+        FILTER_RESUTL_CHECK("input_neighbor",
+                            "filter_getNeighbor",
+                            "YIELD $^.person.name AS name WHERE study.start_year >= 2010",
+                            expected);
+    }
+    {
+        DataSet expected({"name"});
+        expected.emplace_back(Row({Value("Ann")}));
+        expected.emplace_back(Row({Value("Ann")}));
+        FILTER_RESUTL_CHECK("input_sequential",
+                            "filter_sequential",
+                            "YIELD $-.v_name AS name WHERE $-.e_start_year >= 2010",
+                            expected);
+    }
+    FLAGS_min_morsel_parallel_rows = minRows;
+    FLAGS_morsel_size = morselSize;
+}
+
+TEST_F(FilterTest, TestVectorized) {
+    auto vectorized = FLAGS_enable_vectorized_eval;
+    for (auto enabled : {true, false}) {
+        FLAGS_enable_vectorized_eval = enabled;
+        {
+            // The null age of Joy is evaluated row by row
+            DataSet expected({"name"});
+            expected.emplace_back(Row({Value("Ann")}));
+            expected.emplace_back(Row({Value("Ann")}));
+            expected.emplace_back(Row({Value("Kate")}));
+            FILTER_RESUTL_CHECK(
+                "input_sequential",
+                "filter_sequential",
+                "YIELD $-.v_name AS name "
+                "WHERE $-.e_end_year - $-.e_start_year > 3 AND $-.v_age < 20",
+                expected);
+        }
+        {
+            DataSet expected({"name"});
+            expected.emplace_back(Row({Value(4)}));
+            expected.emplace_back(Row({Value(3)}));
+            expected.emplace_back(Row({Value(3)}));
+            expected.emplace_back(Row({Value(4)}));
+            FILTER_RESUTL_CHECK("input_sequential",
+                                "filter_sequential",
+                                "YIELD $-.e_end_year - $-.e_start_year AS name WHERE $-.v_dst != \"School2\" "
+                                "OR $-.e_start_year == 2009 AND $-.e_end_year < 2013",
+                                expected);
+        }
+    }
+    FLAGS_enable_vectorized_eval = vectorized;
+}
+
 TEST_F(FilterTest, TestNullValue) {
     DataSet expected({"name"});
     FILTER_RESUTL_CHECK(
@@ -9,6 +9,7 @@
 #include "context/QueryContext.h"
 #include "planner/Query.h"
 #include "executor/query/GetNeighborsExecutor.h"
+#include "service/GraphFlags.h"
 
 namespace nebula {
 namespace graph {
@@ -82,5 +83,210 @@ TEST_F(GetNeighborsTest, BuildRequestDataSet) {
     auto& reqDs = gnExe->reqDs_;
     EXPECT_EQ(reqDs, expected);
 }
+
+TEST_F(GetNeighborsTest, FetchInBatches) {
+    auto* pool = qctx_->objPool();
+    auto* vids = pool->add(new InputPropertyExpression(new std::string("id")));
+    auto* gn = GetNeighbors::make(
+            qctx_.get(),
+            nullptr,
+            0,
+            vids,
+            {},
+            storage::cpp2::EdgeDirection::BOTH,
+            std::make_unique<std::vector<storage::cpp2::VertexProp>>(),
+            std::make_unique<std::vector<storage::cpp2::EdgeProp>>(),
+            std::make_unique<std::vector<storage::cpp2::StatProp>>(),
+            std::make_unique<std::vector<storage::cpp2::Expr>>());
+    gn->setInputVar("input_gn");
+
+    auto batchSize = FLAGS_get_neighbors_batch_size;
+    FLAGS_get_neighbors_batch_size = 3;
+    auto gnExe = std::make_unique<GetNeighborsExecutor>(gn, qctx_.get());
+    auto status = gnExe->buildRequestDataSet();
+    EXPECT_TRUE(status.ok());
+    // no limit
+    EXPECT_FALSE(gnExe->shouldFetchInBatches());
+
+    gn->setLimit(5);
+    EXPECT_TRUE(gnExe->shouldFetchInBatches());
+
+    gn->setRandom(true);
+    EXPECT_FALSE(gnExe->shouldFetchInBatches());
+    gn->setRandom(false);
+
+    FLAGS_get_neighbors_batch_size = 10;
+    EXPECT_FALSE(gnExe->shouldFetchInBatches());
+
+    FLAGS_get_neighbors_batch_size = 0;
+    EXPECT_FALSE(gnExe->shouldFetchInBatches());
+    FLAGS_get_neighbors_batch_size = batchSize;
+}
+
+TEST_F(GetNeighborsTest, MergeBatches) {
+    auto* pool = qctx_->objPool();
+    auto* vids = pool->add(new InputPropertyExpression(new std::string("id")));
+    auto* gn = GetNeighbors::make(
+            qctx_.get(),
+            nullptr,
+            0,
+            vids,
+            {},
+            storage::cpp2::EdgeDirection::BOTH,
+            std::make_unique<std::vector<storage::cpp2::VertexProp>>(),
+            std::make_unique<std::vector<storage::cpp2::EdgeProp>>(),
+            std::make_unique<std::vector<storage::cpp2::StatProp>>(),
+            std::make_unique<std::vector<storage::cpp2::Expr>>());
+    gn->setInputVar("input_gn");
+    gn->setLimit(5);
+
+    auto batchSize = FLAGS_get_neighbors_batch_size;
+    FLAGS_get_neighbors_batch_size = 3;
+    auto gnExe = std::make_unique<GetNeighborsExecutor>(gn, qctx_.get());
+    gnExe->otherStats_ = std::make_unique<std::unordered_map<std::string, std::string>>();
+    ASSERT_TRUE(gnExe->buildRequestDataSet().ok());
+    ASSERT_TRUE(gnExe->shouldFetchInBatches());
+
+    // The response of the vids in [first, last), each of which likes itself
+    auto response = [](size_t first, size_t last) {
+        DataSet ds({kVid, "_stats", "_edge:+like:_dst", "_expr"});
+        for (auto i = first; i < last; ++i) {
+            auto vid = folly::to<std::string>(i);
+            ds.rows.emplace_back(Row({vid, Value(), List({List({vid})}), Value()}));
+        }
+        storage::cpp2::GetNeighborsResponse resp;
+        resp.set_vertices(std::move(ds));
+        GetNeighborsExecutor::RpcResponse resps(1);
+        resps.setLatency(HostAddr("127.0.0.1", 9779), 10, 20);
+        resps.responses().emplace_back(std::move(resp));
+        return resps;
+    };
+    // The first batch is under the limit, and the second one is limited by the rest
+    auto first = response(0, 3);
+    gnExe->nextVid_ = 3;
+    ASSERT_TRUE(gnExe->handleBatchResponse(first, 100).ok());
+    auto second = response(3, 5);
+    gnExe->nextVid_ = 6;
+    ASSERT_TRUE(gnExe->handleBatchResponse(second, 200).ok());
+    ASSERT_TRUE(gnExe->getNeighborsInBatches().get().ok());
+
+    auto& result = qctx_->ectx()->getResult(gn->outputVar());
+    EXPECT_EQ(Result::State::kSuccess, result.state());
+    std::vector<Value> dsts;
+    for (auto iter = result.iter(); iter->valid(); iter->next()) {
+        dsts.emplace_back(iter->getEdgeProp("like", kDst));
+    }
+    std::vector<Value> expected = {"0", "1", "2", "3", "4"};
+    EXPECT_EQ(expected, dsts);
+
+    auto& stats = *gnExe->otherStats_;
+    EXPECT_EQ("300(us)", stats["total_rpc_time"]);
+    EXPECT_EQ("2", stats["num_batches"]);
+    EXPECT_EQ("6/10", stats["fetched_vids"]);
+    EXPECT_EQ(1, std::count_if(stats.begin(), stats.end(), [](const auto& stat) {
+        return stat.first.find("exec/total") != std::string::npos;
+    }));
+    FLAGS_get_neighbors_batch_size = batchSize;
+}
+
+TEST_F(GetNeighborsTest, SplitFrontier) {
+    auto* pool = qctx_->objPool();
+    auto* vids = pool->add(new InputPropertyExpression(new std::string("id")));
+    auto* gn = GetNeighbors::make(
+            qctx_.get(),
+            nullptr,
+            0,
+            vids,
+            {},
+            storage::cpp2::EdgeDirection::BOTH,
+            std::make_unique<std::vector<storage::cpp2::VertexProp>>(),
+            std::make_unique<std::vector<storage::cpp2::EdgeProp>>(),
+            std::make_unique<std::vector<storage::cpp2::StatProp>>(),
+            std::make_unique<std::vector<storage::cpp2::Expr>>());
+    gn->setInputVar("input_gn");
+
+    auto maxVids = FLAGS_get_neighbors_max_vids_per_request;
+    FLAGS_get_neighbors_max_vids_per_request = 4;
+    auto gnExe = std::make_unique<GetNeighborsExecutor>(gn, qctx_.get());
+    auto status = gnExe->buildRequestDataSet();
+    EXPECT_TRUE(status.ok());
+    EXPECT_TRUE(gnExe->shouldSplitFrontier());
+
+    // The limited neighbors are fetched in batches instead
+    gn->setLimit(5);
+    EXPECT_FALSE(gnExe->shouldSplitFrontier());
+    gn->setLimit(std::numeric_limits<int64_t>::max());
+
+    gn->setRandom(true);
+    EXPECT_FALSE(gnExe->shouldSplitFrontier());
+    gn->setRandom(false);
+
+    auto requests = gnExe->splitByPartitions();
+    ASSERT_EQ(3, requests.size());
+    EXPECT_EQ(4, requests[0].size());
+    EXPECT_EQ(4, requests[1].size());
+    EXPECT_EQ(2, requests[2].size());
+    std::unordered_set<Value> all;
+    for (auto& request : requests) {
+        for (auto& row : request) {
+            all.emplace(row.values.front());
+        }
+    }
+    EXPECT_EQ(10, all.size());
+
+    FLAGS_get_neighbors_max_vids_per_request = 0;
+    EXPECT_FALSE(gnExe->shouldSplitFrontier());
+    FLAGS_get_neighbors_max_vids_per_request = maxVids;
+}
+
+TEST_F(GetNeighborsTest, TruncateEdges) {
+    // The edges of the dsts
+    auto edges = [](const std::vector<std::string>& dsts) {
+        List list;
+        for (auto& dst : dsts) {
+            list.values.emplace_back(List({Value(dst)}));
+        }
+        return Value(std::move(list));
+    };
+    auto makeDataSet = [&edges]() {
+        DataSet ds;
+        ds.colNames = {kVid, "_stats", "_edge:+like:_dst", "_edge:-like:_dst", "_expr"};
+        // "a" has 3 + 2 edges, and "b" has 1 edge
+        ds.rows.emplace_back(
+            Row({"a", Value(), edges({"b", "c", "d"}), edges({"e", "f"}), Value()}));
+        ds.rows.emplace_back(Row({"b", Value(), edges({"a"}), Value(), Value()}));
+        return ds;
+    };
+    {
+        auto ds = makeDataSet();
+        GetNeighborsExecutor::truncateEdges(ds, 4, false);
+        EXPECT_EQ(edges({"b", "c", "d"}), ds.rows[0].values[2]);
+        EXPECT_EQ(edges({"e"}), ds.rows[0].values[3]);
+        EXPECT_EQ(edges({"a"}), ds.rows[1].values[2]);
+    }
+    {
+        auto ds = makeDataSet();
+        GetNeighborsExecutor::truncateEdges(ds, 0, false);
+        EXPECT_TRUE(ds.rows[0].values[2].getList().values.empty());
+        EXPECT_TRUE(ds.rows[0].values[3].getList().values.empty());
+        EXPECT_TRUE(ds.rows[1].values[2].getList().values.empty());
+    }
+    {
+        auto ds = makeDataSet();
+        GetNeighborsExecutor::truncateEdges(ds, 3, true);
+        std::unordered_set<Value> sampled;
+        for (auto col : {2, 3}) {
+            for (auto& edge : ds.rows[0].values[col].getList().values) {
+                sampled.emplace(edge);
+            }
+        }
+        EXPECT_EQ(3, sampled.size());
+        for (auto& edge : sampled) {
+            auto& dst = edge.getList().values.front().getStr();
+            EXPECT_TRUE(dst >= "b" && dst <= "f") << dst;
+        }
+        EXPECT_EQ(edges({"a"}), ds.rows[1].values[2]);
+    }
+}
 }  // namespace graph
 }  // namespace nebula
@@ -0,0 +1,154 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include <gtest/gtest.h>
+
+#include "context/QueryContext.h"
+#include "executor/algo/IntersectNeighborsExecutor.h"
+#include "planner/Algo.h"
+#include "util/ExpressionUtils.h"
+
+namespace nebula {
+namespace graph {
+class IntersectNeighborsTest : public testing::Test {
+protected:
+    static Row neighborsRow(const std::string& vid, const std::vector<std::string>& dsts) {
+        Row row;
+        row.values.emplace_back(vid);
+        // _stats = empty
+        row.values.emplace_back(Value());
+        // edges
+        List edges;
+        for (auto& dst : dsts) {
+            List edge;
+            edge.values.emplace_back(1);
+            edge.values.emplace_back(dst);
+            edge.values.emplace_back(0);
+            edges.values.emplace_back(std::move(edge));
+        }
+        row.values.emplace_back(std::move(edges));
+        // _expr = empty
+        row.values.emplace_back(Value());
+        return row;
+    }
+
+    void setNeighbors(const std::string& var, DataSet ds) {
+        qctx_->symTable()->newVariable(var);
+        List datasets;
+        datasets.values.emplace_back(std::move(ds));
+        qctx_->ectx()->setResult(var,
+                                 ResultBuilder()
+                                     .value(Value(std::move(datasets)))
+                                     .iter(Iterator::Kind::kGetNeighbors)
+                                     .finish());
+    }
+
+    void SetUp() override {
+        qctx_ = std::make_unique<QueryContext>();
+        /*
+         *  edges: 1->3, 1->4, 1->5, 2->4, 6->4
+         *  neighbors: 0->4, 0->5, 0->7
+         *  bindings: (1, 0), (1, 0), (2, 8)
+         */
+        {
+            DataSet ds;
+            ds.colNames = {kVid, "_stats", "_edge:+edge1:_type:_dst:_rank", "_expr"};
+            ds.rows.emplace_back(neighborsRow("1", {"3", "4", "5"}));
+            ds.rows.emplace_back(neighborsRow("2", {"4"}));
+            ds.rows.emplace_back(neighborsRow("6", {"4"}));
+            setNeighbors("edges", std::move(ds));
+        }
+        {
+            DataSet ds;
+            ds.colNames = {kVid, "_stats", "_edge:-edge1:_type:_dst:_rank", "_expr"};
+            ds.rows.emplace_back(neighborsRow("0", {"7", "5", "4", "5"}));
+            setNeighbors("neighbors", std::move(ds));
+        }
+        {
+            DataSet ds;
+            ds.colNames = {"src", "bound"};
+            ds.rows.emplace_back(Row({"1", "0"}));
+            ds.rows.emplace_back(Row({"1", "0"}));
+            ds.rows.emplace_back(Row({"2", "8"}));
+            qctx_->symTable()->newVariable("bindings");
+            qctx_->ectx()->setResult("bindings",
+                                     ResultBuilder().value(Value(std::move(ds))).finish());
+        }
+    }
+
+    std::vector<std::pair<Value, Value>> intersect() {
+        auto* pool = qctx_->objPool();
+        auto* node = IntersectNeighbors::make(
+            qctx_.get(),
+            nullptr,
+            "edges",
+            "bindings",
+            pool->add(ExpressionUtils::inputPropExpr("src").release()),
+            {pool->add(ExpressionUtils::inputPropExpr("bound").release())},
+            {"neighbors"});
+        auto exe = std::make_unique<IntersectNeighborsExecutor>(node, qctx_.get());
+        auto status = exe->execute().get();
+        EXPECT_TRUE(status.ok());
+
+        std::vector<std::pair<Value, Value>> edges;
+        auto iter = qctx_->ectx()->getResult(node->outputVar()).iter();
+        for (; iter->valid(); iter->next()) {
+            auto edge = iter->getEdge();
+            EXPECT_TRUE(edge.isEdge());
+            edges.emplace_back(iter->getColumn(kVid), edge.getEdge().dst);
+        }
+        std::sort(edges.begin(), edges.end());
+        return edges;
+    }
+
+protected:
+    std::unique_ptr<QueryContext> qctx_;
+};
+
+TEST_F(IntersectNeighborsTest, Leapfrog) {
+    {
+        std::vector<Value> l1 = {1, 3, 4, 7, 9};
+        std::vector<Value> l2 = {0, 3, 7, 8, 9, 10};
+        std::vector<Value> l3 = {3, 5, 7, 9};
+        auto values = IntersectNeighborsExecutor::leapfrog({&l1, &l2, &l3});
+        std::vector<Value> expected = {3, 7, 9};
+        EXPECT_EQ(expected, values);
+    }
+    {
+        std::vector<Value> l1 = {"a", "b"};
+        std::vector<Value> l2 = {"c", "d"};
+        auto values = IntersectNeighborsExecutor::leapfrog({&l1, &l2});
+        EXPECT_TRUE(values.empty());
+    }
+    {
+        std::vector<Value> l1 = {1, 2};
+        std::vector<Value> l2;
+        auto values = IntersectNeighborsExecutor::leapfrog({&l1, &l2});
+        EXPECT_TRUE(values.empty());
+    }
+    {
+        std::vector<Value> l1 = {1, 2, 3};
+        auto values = IntersectNeighborsExecutor::leapfrog({&l1});
+        EXPECT_EQ(l1, values);
+    }
+}
+
+TEST_F(IntersectNeighborsTest, KeepIntersected) {
+    // The edges of 1 are intersected with the neighbors of 0, 8 has no neighbors
+    // and 6 is not bound
+    std::vector<std::pair<Value, Value>> expected = {{"1", "4"}, {"1", "5"}};
+    EXPECT_EQ(expected, intersect());
+}
+
+TEST_F(IntersectNeighborsTest, EmptyBindings) {
+    DataSet ds;
+    ds.colNames = {"src", "bound"};
+    qctx_->ectx()->setResult("bindings", ResultBuilder().value(Value(std::move(ds))).finish());
+    EXPECT_TRUE(intersect().empty());
+}
+
+}   // namespace graph
+}   // namespace nebula
@@ -468,5 +468,68 @@ TEST_F(ProduceAllPathsTest, EmptyInput) {
     EXPECT_EQ(result.value().getDataSet(), expected);
     EXPECT_EQ(result.state(), Result::State::kSuccess);
 }
+
+TEST_F(ProduceAllPathsTest, Loop) {
+    // 0->1->0
+    auto neighbors = [](const std::string& src, const std::string& dst) {
+        DataSet ds;
+        ds.colNames = {kVid, "_stats", "_edge:+edge1:_type:_dst:_rank", "_expr"};
+        Row row;
+        row.values.emplace_back(src);
+        row.values.emplace_back(Value());
+        List edges;
+        edges.values.emplace_back(List({1, dst, 0}));
+        row.values.emplace_back(std::move(edges));
+        row.values.emplace_back(Value());
+        ds.rows.emplace_back(std::move(row));
+        return ds;
+    };
+    auto step = [&](ProduceAllPathsExecutor* exe) {
+        List datasets;
+        datasets.values.emplace_back(neighbors("0", "1"));
+        datasets.values.emplace_back(neighbors("1", "0"));
+        qctx_->ectx()->setResult(
+            "input",
+            ResultBuilder().value(std::move(datasets)).iter(Iterator::Kind::kGetNeighbors).finish());
+        auto status = exe->execute().get();
+        EXPECT_TRUE(status.ok());
+    };
+    qctx_->symTable()->newVariable("input");
+
+    for (auto noLoop : {false, true}) {
+        auto* allPathsNode = ProduceAllPaths::make(qctx_.get(), nullptr);
+        allPathsNode->setInputVar("input");
+        allPathsNode->setColNames({kDst, "_paths"});
+        allPathsNode->setNoLoop(noLoop);
+        auto allPathsExe = std::make_unique<ProduceAllPathsExecutor>(allPathsNode, qctx_.get());
+
+        step(allPathsExe.get());
+        EXPECT_EQ(2, qctx_->ectx()->getResult(allPathsNode->outputVar()).size());
+
+        step(allPathsExe.get());
+        auto resultDs = qctx_->ectx()->getResult(allPathsNode->outputVar()).value().getDataSet();
+        DataSet expected;
+        expected.colNames = {kDst, "_paths"};
+        if (!noLoop) {
+            for (auto& vid : {"0", "1"}) {
+                std::string other = vid == std::string("0") ? "1" : "0";
+                Path path;
+                path.src = Vertex(vid, {});
+                path.steps.emplace_back(Step(Vertex(other, {}), 1, "edge1", 0, {}));
+                path.steps.emplace_back(Step(Vertex(vid, {}), 1, "edge1", 0, {}));
+                Row row;
+                row.values.emplace_back(vid);
+                row.values.emplace_back(List({std::move(path)}));
+                expected.rows.emplace_back(std::move(row));
+            }
+        }
+        EXPECT_TRUE(verifyAllPaths(resultDs, expected));
+
+        // The same edges are not traversed again
+        step(allPathsExe.get());
+        resultDs = qctx_->ectx()->getResult(allPathsNode->outputVar()).value().getDataSet();
+        EXPECT_TRUE(resultDs.rows.empty());
+    }
+}
 }  // namespace graph
 }  // namespace nebula
@@ -9,6 +9,7 @@
 #include "context/QueryContext.h"
 #include "planner/Algo.h"
 #include "executor/algo/ProduceSemiShortestPathExecutor.h"
+#include "util/SourceBits.h"
 
 namespace nebula {
 namespace graph {
@@ -489,6 +490,170 @@ TEST_F(ProduceSemiShortestPathTest, ShortestPath) {
     }
 }
 
+TEST_F(ProduceSemiShortestPathTest, WeightedShortestPath) {
+    /*
+    *  0->1 (5), 0->2 (1), 2->1 (1)
+    *  startVids {0}
+    */
+    auto edge = [] (const std::string& dst, int64_t weight) {
+        List edge;
+        edge.values.emplace_back(1);
+        edge.values.emplace_back(dst);
+        edge.values.emplace_back(0);
+        edge.values.emplace_back(weight);
+        return edge;
+    };
+    auto path = [] (const std::vector<std::string>& vids) {
+        Path path;
+        path.src = Vertex(vids.front(), {});
+        for (size_t i = 1; i < vids.size(); ++i) {
+            path.steps.emplace_back(Step(Vertex(vids[i], {}), 1, "edge1", 0, {}));
+        }
+        return path;
+    };
+    auto row = [] (const std::string& dst, double cost, Path path) {
+        List paths;
+        paths.values.emplace_back(std::move(path));
+        return Row({dst, "0", cost, std::move(paths)});
+    };
+
+    qctx_->symTable()->newVariable("weighted_input");
+    auto* pssp = ProduceSemiShortestPath::make(qctx_.get(), nullptr);
+    pssp->setInputVar("weighted_input");
+    pssp->setColNames({"_dst", "_src", "cost", "paths"});
+    pssp->setWeightProp("weight");
+    auto psspExe = std::make_unique<ProduceSemiShortestPathExecutor>(pssp, qctx_.get());
+
+    // Step 1
+    {
+        DataSet ds;
+        ds.colNames = {kVid, "_stats", "_edge:+edge1:_type:_dst:_rank:weight", "_expr"};
+        List edges;
+        edges.values.emplace_back(edge("1", 5));
+        edges.values.emplace_back(edge("2", 1));
+        ds.rows.emplace_back(Row({"0", Value(), std::move(edges), Value()}));
+        List datasets;
+        datasets.values.emplace_back(std::move(ds));
+        qctx_->ectx()->setResult("weighted_input",
+                                 ResultBuilder()
+                                     .value(std::move(datasets))
+                                     .iter(Iterator::Kind::kGetNeighbors)
+                                     .finish());
+
+        auto status = psspExe->execute().get();
+        EXPECT_TRUE(status.ok());
+        auto& result = qctx_->ectx()->getResult(pssp->outputVar());
+
+        DataSet expected;
+        expected.colNames = {"_dst", "_src", "cost", "paths"};
+        expected.rows.emplace_back(row("1", 5.0, path({"0", "1"})));
+        expected.rows.emplace_back(row("2", 1.0, path({"0", "2"})));
+        std::sort(expected.rows.begin(), expected.rows.end(), compareShortestPath);
+        auto resultDs = result.value().getDataSet();
+        std::sort(resultDs.rows.begin(), resultDs.rows.end(), compareShortestPath);
+        EXPECT_EQ(resultDs, expected);
+    }
+    // Step 2, the path of more steps is cheaper
+    {
+        DataSet ds;
+        ds.colNames = {kVid, "_stats", "_edge:+edge1:_type:_dst:_rank:weight", "_expr"};
+        List edges;
+        edges.values.emplace_back(edge("1", 1));
+        ds.rows.emplace_back(Row({"2", Value(), std::move(edges), Value()}));
+        List datasets;
+        datasets.values.emplace_back(std::move(ds));
+        qctx_->ectx()->setResult("weighted_input",
+                                 ResultBuilder()
+                                     .value(std::move(datasets))
+                                     .iter(Iterator::Kind::kGetNeighbors)
+                                     .finish());
+
+        auto status = psspExe->execute().get();
+        EXPECT_TRUE(status.ok());
+        auto& result = qctx_->ectx()->getResult(pssp->outputVar());
+
+        DataSet expected;
+        expected.colNames = {"_dst", "_src", "cost", "paths"};
+        expected.rows.emplace_back(row("1", 2.0, path({"0", "2", "1"})));
+        EXPECT_EQ(result.value().getDataSet(), expected);
+    }
+    // Negative weight
+    {
+        DataSet ds;
+        ds.colNames = {kVid, "_stats", "_edge:+edge1:_type:_dst:_rank:weight", "_expr"};
+        List edges;
+        edges.values.emplace_back(edge("3", -1));
+        ds.rows.emplace_back(Row({"1", Value(), std::move(edges), Value()}));
+        List datasets;
+        datasets.values.emplace_back(std::move(ds));
+        qctx_->ectx()->setResult("weighted_input",
+                                 ResultBuilder()
+                                     .value(std::move(datasets))
+                                     .iter(Iterator::Kind::kGetNeighbors)
+                                     .finish());
+
+        auto status = psspExe->execute().get();
+        EXPECT_FALSE(status.ok());
+    }
+}
+
+TEST_F(ProduceSemiShortestPathTest, TrackSources) {
+    qctx_->symTable()->newVariable("input");
+
+    auto* pssp = ProduceSemiShortestPath::make(qctx_.get(), nullptr);
+    pssp->setInputVar("input");
+    pssp->setColNames({"_dst", "edge", "sources"});
+    pssp->setTrackSources(true);
+
+    auto psspExe = std::make_unique<ProduceSemiShortestPathExecutor>(pssp, qctx_.get());
+    // dst : the indexes of the starts carried by the edge
+    auto collect = [&] () {
+        auto& result = qctx_->ectx()->getResult(pssp->outputVar());
+        auto& ds = result.value().getDataSet();
+        EXPECT_EQ(ds.colNames, std::vector<std::string>({"_dst", "edge", "sources"}));
+        std::vector<std::pair<std::string, std::vector<size_t>>> sources;
+        for (auto& row : ds.rows) {
+            EXPECT_TRUE(row.values[1].isEdge());
+            sources.emplace_back(row.values[0].getStr(),
+                                 SourceBits::decode(row.values[2].getStr()).indexes());
+        }
+        std::sort(sources.begin(), sources.end());
+        return sources;
+    };
+    // Step 1, the starts {0, 1, 2, 3} take the bits by their orders
+    {
+        List datasets;
+        datasets.values.emplace_back(std::move(firstStepResult_));
+        qctx_->ectx()->setResult("input",
+                                 ResultBuilder()
+                                     .value(std::move(datasets))
+                                     .iter(Iterator::Kind::kGetNeighbors)
+                                     .finish());
+
+        auto status = psspExe->execute().get();
+        EXPECT_TRUE(status.ok());
+        std::vector<std::pair<std::string, std::vector<size_t>>> expected = {
+            {"1", {0}}, {"4", {3}}, {"5", {1}}, {"6", {1}}, {"6", {2}}};
+        EXPECT_EQ(collect(), expected);
+    }
+    // Step 2, the start 1 reached 5 and 6 by the step 1
+    {
+        List datasets;
+        datasets.values.emplace_back(std::move(secondStepResult_));
+        qctx_->ectx()->setResult("input",
+                                 ResultBuilder()
+                                     .value(std::move(datasets))
+                                     .iter(Iterator::Kind::kGetNeighbors)
+                                     .finish());
+
+        auto status = psspExe->execute().get();
+        EXPECT_TRUE(status.ok());
+        std::vector<std::pair<std::string, std::vector<size_t>>> expected = {
+            {"5", {0}}, {"6", {0}}, {"7", {1}}, {"7", {1, 2}}, {"7", {3}}};
+        EXPECT_EQ(collect(), expected);
+    }
+}
+
 TEST_F(ProduceSemiShortestPathTest, EmptyInput) {
     auto* pssp = ProduceSemiShortestPath::make(qctx_.get(), nullptr);
     pssp->setInputVar("empty_get_neighbors");
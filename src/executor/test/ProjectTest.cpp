@@ -11,6 +11,7 @@
 #include "executor/test/QueryTestBase.h"
 #include "planner/Logic.h"
 #include "planner/Query.h"
+#include "service/GraphFlags.h"
 
 namespace nebula {
 namespace graph {
@@ -75,6 +76,42 @@ TEST_F(ProjectTest, Project1Col) {
     EXPECT_EQ(result.state(), Result::State::kSuccess);
 }
 
+TEST_F(ProjectTest, ProjectMorsels) {
+    auto minRows = FLAGS_min_morsel_parallel_rows;
+    auto morselSize = FLAGS_morsel_size;
+    FLAGS_min_morsel_parallel_rows = 1;
+    FLAGS_morsel_size = 3;
+
+    std::string input = "input_project";
+    auto yieldColumns = getYieldColumns("YIELD $input_project.vid AS vid, "
+                                        "$input_project.col2 + 1 AS col2");
+
+    auto* project = Project::make(qctx_.get(), start_, yieldColumns);
+    project->setInputVar(input);
+    project->setColNames(std::vector<std::string>{"vid", "col2"});
+
+    auto proExe = Executor::create(project, qctx_.get());
+    auto future = proExe->execute();
+    auto status = std::move(future).get();
+    EXPECT_TRUE(status.ok());
+    auto& result = qctx_->ectx()->getResult(project->outputVar());
+
+    // The rows of morsels are stitched in the order of input
+    DataSet expected;
+    expected.colNames = {"vid", "col2"};
+    for (auto i = 0; i < 10; ++i) {
+        Row row;
+        row.values.emplace_back(i);
+        row.values.emplace_back(i + 2);
+        expected.rows.emplace_back(std::move(row));
+    }
+    EXPECT_EQ(result.value().getDataSet(), expected);
+    EXPECT_EQ(result.state(), Result::State::kSuccess);
+
+    FLAGS_min_morsel_parallel_rows = minRows;
+    FLAGS_morsel_size = morselSize;
+}
+
 TEST_F(ProjectTest, Project2Col) {
     std::string input = "input_project";
     auto yieldColumns = getYieldColumns(
@@ -0,0 +1,149 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include <gtest/gtest.h>
+
+#include "context/QueryContext.h"
+#include "executor/query/TraverseExecutor.h"
+#include "planner/Query.h"
+
+namespace nebula {
+namespace graph {
+class TraverseTest : public testing::Test {
+protected:
+    void SetUp() override {
+        qctx_ = std::make_unique<QueryContext>();
+    }
+
+    // The neighbors of each vid by the edges of edge1 to the dsts, or by the reversed
+    // edges of edge1 from the dsts
+    static std::unique_ptr<GetNeighborsIter> neighbors(
+        const std::vector<std::pair<std::string, std::vector<std::string>>>& vertices,
+        bool reversed = false) {
+        DataSet ds;
+        ds.colNames = {kVid,
+                       "_stats",
+                       reversed ? "_edge:-edge1:_type:_dst:_rank" : "_edge:+edge1:_type:_dst:_rank",
+                       "_expr"};
+        for (auto& vertex : vertices) {
+            Row row;
+            row.values.emplace_back(vertex.first);
+            // _stats = empty
+            row.values.emplace_back(Value());
+            // edges
+            List edges;
+            for (auto& dst : vertex.second) {
+                List edge;
+                edge.values.emplace_back(reversed ? -1 : 1);
+                edge.values.emplace_back(dst);
+                edge.values.emplace_back(0);
+                edges.values.emplace_back(std::move(edge));
+            }
+            row.values.emplace_back(std::move(edges));
+            // _expr = empty
+            row.values.emplace_back(Value());
+            ds.rows.emplace_back(std::move(row));
+        }
+        List datasets;
+        datasets.values.emplace_back(std::move(ds));
+        return std::make_unique<GetNeighborsIter>(std::make_shared<Value>(std::move(datasets)));
+    }
+
+    static Path path(const std::vector<std::string>& vids) {
+        Path path;
+        path.src = Vertex(vids.front(), {});
+        for (size_t i = 1; i < vids.size(); ++i) {
+            path.steps.emplace_back(Step(Vertex(vids[i], {}), 1, "edge1", 0, {}));
+        }
+        return path;
+    }
+
+    std::unique_ptr<TraverseExecutor> makeExecutor(int64_t minSteps, int64_t maxSteps) {
+        auto* traverse = Traverse::make(qctx_.get(), nullptr, 1);
+        traverse->setSteps(minSteps, maxSteps);
+        traverse->setColNames({kPathStr});
+        auto exe = std::make_unique<TraverseExecutor>(traverse, qctx_.get());
+        exe->result_.colNames = traverse->colNames();
+        return exe;
+    }
+
+    static void expand(TraverseExecutor* exe, std::unique_ptr<GetNeighborsIter> iter) {
+        exe->expandPaths(iter.get());
+        exe->step_++;
+    }
+
+    static std::vector<Value> vids(const TraverseExecutor* exe) {
+        std::vector<Value> vids;
+        for (auto& row : exe->vids_) {
+            vids.emplace_back(row.values.front());
+        }
+        std::sort(vids.begin(), vids.end());
+        return vids;
+    }
+
+    static std::vector<Value> paths(const TraverseExecutor* exe) {
+        std::vector<Value> paths;
+        for (auto& row : exe->result_.rows) {
+            paths.emplace_back(row.values.front());
+        }
+        std::sort(paths.begin(), paths.end());
+        return paths;
+    }
+
+protected:
+    std::unique_ptr<QueryContext> qctx_;
+};
+
+TEST_F(TraverseTest, ExpandPaths) {
+    /*
+     *  1->2, 2->3, 2->4, 3->1
+     *  steps [2, 3]
+     */
+    auto exe = makeExecutor(2, 3);
+    expand(exe.get(), neighbors({{"1", {"2"}}}));
+    // The paths of the first step are not output
+    EXPECT_TRUE(paths(exe.get()).empty());
+    EXPECT_EQ(std::vector<Value>({"2"}), vids(exe.get()));
+
+    expand(exe.get(), neighbors({{"2", {"3", "4"}}}));
+    std::vector<Value> expected = {path({"1", "2", "3"}), path({"1", "2", "4"})};
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(expected, paths(exe.get()));
+    EXPECT_EQ(std::vector<Value>({"3", "4"}), vids(exe.get()));
+
+    expand(exe.get(), neighbors({{"3", {"1"}}, {"4", {}}}));
+    expected.emplace_back(path({"1", "2", "3", "1"}));
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(expected, paths(exe.get()));
+    // No more steps
+    EXPECT_TRUE(vids(exe.get()).empty());
+}
+
+TEST_F(TraverseTest, UniqueEdges) {
+    /*
+     *  1-2, 2-3 of both directions
+     *  steps [1, 3]
+     */
+    auto exe = makeExecutor(1, 3);
+    expand(exe.get(), neighbors({{"1", {"2"}}}));
+    EXPECT_EQ(std::vector<Value>({path({"1", "2"})}), paths(exe.get()));
+
+    // Back to 1 by the same edge reversed
+    expand(exe.get(), neighbors({{"2", {"1"}}}, true));
+    EXPECT_EQ(std::vector<Value>({path({"1", "2"})}), paths(exe.get()));
+    EXPECT_TRUE(vids(exe.get()).empty());
+
+    auto another = makeExecutor(1, 3);
+    expand(another.get(), neighbors({{"1", {"2"}}}));
+    expand(another.get(), neighbors({{"2", {"3"}}}));
+    std::vector<Value> expected = {path({"1", "2"}), path({"1", "2", "3"})};
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(expected, paths(another.get()));
+    EXPECT_EQ(std::vector<Value>({"3"}), vids(another.get()));
+}
+
+}   // namespace graph
+}   // namespace nebula
@@ -0,0 +1,176 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "optimizer/CostModel.h"
+
+#include <cmath>
+#include <numeric>
+
+#include "context/QueryContext.h"
+#include "planner/Algo.h"
+#include "planner/PlanNode.h"
+#include "planner/Query.h"
+#include "util/StatsCache.h"
+
+using nebula::graph::Aggregate;
+using nebula::graph::GetNeighbors;
+using nebula::graph::IndexScan;
+using nebula::graph::Limit;
+using nebula::graph::PlanNode;
+using nebula::graph::QueryContext;
+using nebula::graph::StatsCache;
+using nebula::graph::TopN;
+
+namespace nebula {
+namespace opt {
+
+namespace {
+
+std::shared_ptr<const meta::cpp2::StatisItem> spaceStats(QueryContext* qctx, GraphSpaceID space) {
+    if (qctx == nullptr) {
+        return nullptr;
+    }
+    return StatsCache::instance().get(qctx->getMetaClient(), space);
+}
+
+// The rows of `count' after skipping `offset', the negative count means no limit
+double limitRows(double input, int64_t offset, int64_t count) {
+    if (count < 0 || count == std::numeric_limits<int64_t>::max()) {
+        return input;
+    }
+    return std::min(input, static_cast<double>(offset) + static_cast<double>(count));
+}
+
+}   // namespace
+
+// static
+CostModel::Estimate CostModel::estimate(QueryContext* qctx,
+                                        const PlanNode* node,
+                                        const std::vector<double>& inputRows) {
+    double input = std::accumulate(inputRows.begin(), inputRows.end(), 0.0);
+    switch (node->kind()) {
+        case PlanNode::Kind::kStart:
+            return {1.0, 0.0};
+        case PlanNode::Kind::kGetNeighbors:
+            return getNeighbors(qctx, node, input);
+        case PlanNode::Kind::kGetVertices:
+        case PlanNode::Kind::kGetEdges:
+            return {input, input * kStorageRowCost};
+        case PlanNode::Kind::kIndexScan:
+            return indexScan(qctx, node);
+        case PlanNode::Kind::kFilter:
+            return {input * kFilterSelectivity, input};
+        case PlanNode::Kind::kLimit: {
+            auto* limit = static_cast<const Limit*>(node);
+            auto rows = limitRows(input, limit->offset(), limit->count());
+            return {rows, rows};
+        }
+        case PlanNode::Kind::kTopN: {
+            auto* topN = static_cast<const TopN*>(node);
+            auto rows = limitRows(input, topN->offset(), topN->count());
+            return {rows, input * std::log2(std::max(rows, 2.0))};
+        }
+        case PlanNode::Kind::kSort:
+            return {input, input * std::log2(std::max(input, 2.0))};
+        case PlanNode::Kind::kAggregate: {
+            auto* agg = static_cast<const Aggregate*>(node);
+            auto rows = agg->groupKeys().empty() ? 1.0 : std::max(1.0, input * kGroupRatio);
+            return {rows, input};
+        }
+        case PlanNode::Kind::kDataJoin:
+            // Only one side of the join is the dependency, the other side is read from the
+            // variable, so assume they are of the same size. The executor builds the hash table
+            // on the smaller side by the real sizes.
+            return {input, input * 2};
+        case PlanNode::Kind::kCartesianProduct:
+            return {input * input, input * input};
+        case PlanNode::Kind::kIntersect:
+            if (inputRows.empty()) {
+                return {0.0, 0.0};
+            }
+            return {*std::min_element(inputRows.begin(), inputRows.end()), input};
+        case PlanNode::Kind::kMinus:
+            if (inputRows.empty()) {
+                return {0.0, 0.0};
+            }
+            return {inputRows.front(), input};
+        default:
+            // A pass over the input
+            return {input, input};
+    }
+}
+
+// static
+CostModel::Estimate CostModel::getNeighbors(QueryContext* qctx,
+                                            const PlanNode* node,
+                                            double inputRows) {
+    auto* gn = static_cast<const GetNeighbors*>(node);
+    auto stats = spaceStats(qctx, gn->space());
+    double degree = 0.0;
+    for (auto edgeType : gn->edgeTypes()) {
+        double count = -1;
+        if (stats != nullptr && stats->space_vertices > 0 && qctx->schemaMng() != nullptr) {
+            auto name = qctx->schemaMng()->toEdgeName(gn->space(), std::abs(edgeType));
+            if (name.ok()) {
+                count = StatsCache::edgeCount(stats.get(), name.value());
+            }
+        }
+        degree += count < 0 ? kDefaultDegree
+                            : count / static_cast<double>(stats->space_vertices);
+    }
+    if (gn->edgeTypes().empty()) {
+        degree = kDefaultDegree;
+    }
+    auto rows = limitRows(inputRows * degree, 0, gn->limit());
+    // The vertices without edges are returned too
+    return {rows, (inputRows + rows) * kStorageRowCost};
+}
+
+// static
+CostModel::Estimate CostModel::indexScan(QueryContext* qctx, const PlanNode* node) {
+    auto* scan = static_cast<const IndexScan*>(node);
+    double total = -1;
+    auto stats = spaceStats(qctx, scan->space());
+    if (stats != nullptr && qctx->schemaMng() != nullptr) {
+        auto* schemaMng = qctx->schemaMng();
+        auto name = scan->isEdge() ? schemaMng->toEdgeName(scan->space(), scan->schemaId())
+                                   : schemaMng->toTagName(scan->space(), scan->schemaId());
+        if (name.ok()) {
+            total = scan->isEdge() ? StatsCache::edgeCount(stats.get(), name.value())
+                                   : StatsCache::tagCount(stats.get(), name.value());
+        }
+    }
+    if (total < 0) {
+        total = kDefaultScanRows;
+    }
+
+    double rows = 0.0;
+    auto* ictxs = scan->queryContext();
+    if (ictxs == nullptr || ictxs->empty()) {
+        rows = total;
+    } else {
+        // The contexts are unioned
+        for (const auto& ictx : *ictxs) {
+            rows += indexScanRows(total, ictx.get_column_hints());
+        }
+        rows = std::min(rows, total);
+    }
+    return {rows, rows * kStorageRowCost};
+}
+
+// static
+double CostModel::indexScanRows(double total,
+                                const std::vector<storage::cpp2::IndexColumnHint>& hints) {
+    double rows = total;
+    for (const auto& hint : hints) {
+        rows *= hint.get_scan_type() == storage::cpp2::ScanType::PREFIX ? kEqualSelectivity
+                                                                        : kRangeSelectivity;
+    }
+    return std::max(rows, 1.0);
+}
+
+}   // namespace opt
+}   // namespace nebula
@@ -0,0 +1,60 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef OPTIMIZER_COSTMODEL_H_
+#define OPTIMIZER_COSTMODEL_H_
+
+#include "common/base/Base.h"
+#include "common/interface/gen-cpp2/storage_types.h"
+
+namespace nebula {
+namespace graph {
+class PlanNode;
+class QueryContext;
+}   // namespace graph
+
+namespace opt {
+
+// Estimate the output rows and the cost of a plan node by its kind, from the estimated rows of
+// its inputs. The scans and the expansions are estimated by the space statistics if cached,
+// e.g. the out degree of an edge type is its count divided by the count of the vertices,
+// and by the default numbers otherwise. The cost is measured by processing a row in the graph
+// service, and reading a row from the storage costs kStorageRowCost.
+class CostModel final {
+public:
+    struct Estimate {
+        double rows{0.0};
+        double cost{0.0};
+    };
+
+    static Estimate estimate(graph::QueryContext* qctx,
+                             const graph::PlanNode* node,
+                             const std::vector<double>& inputRows);
+
+    // The rows out of `total' rows hit by the column hints of an index scan
+    static double indexScanRows(double total,
+                                const std::vector<storage::cpp2::IndexColumnHint>& hints);
+
+    static constexpr double kStorageRowCost = 4.0;
+    static constexpr double kDefaultScanRows = 10000.0;
+    static constexpr double kDefaultDegree = 10.0;
+    static constexpr double kFilterSelectivity = 0.5;
+    static constexpr double kEqualSelectivity = 0.1;
+    static constexpr double kRangeSelectivity = 0.3;
+    static constexpr double kGroupRatio = 0.1;
+
+private:
+    static Estimate getNeighbors(graph::QueryContext* qctx,
+                                 const graph::PlanNode* node,
+                                 double inputRows);
+
+    static Estimate indexScan(graph::QueryContext* qctx, const graph::PlanNode* node);
+};
+
+}   // namespace opt
+}   // namespace nebula
+
+#endif   // OPTIMIZER_COSTMODEL_H_
@@ -9,6 +9,7 @@
 #include <limits>
 
 #include "context/QueryContext.h"
+#include "optimizer/CostModel.h"
 #include "optimizer/OptRule.h"
 #include "planner/Logic.h"
 #include "planner/PlanNode.h"
@@ -124,6 +125,11 @@ double OptGroup::getCost() const {
     return findMinCostGroupNode().first;
 }
 
+double OptGroup::getRows() const {
+    const OptGroupNode *minGroupNode = findMinCostGroupNode().second;
+    return minGroupNode == nullptr ? 0.0 : minGroupNode->getRows();
+}
+
 const PlanNode *OptGroup::getPlan() const {
     const OptGroupNode *minGroupNode = findMinCostGroupNode().second;
     DCHECK(minGroupNode != nullptr);
@@ -159,10 +165,37 @@ Status OptGroupNode::explore(const OptRule *rule) {
 }
 
 double OptGroupNode::getCost() const {
-    return node_->cost();
+    estimate();
+    return cost_;
+}
+
+double OptGroupNode::getRows() const {
+    estimate();
+    return rows_;
+}
+
+void OptGroupNode::estimate() const {
+    if (estimated_) {
+        return;
+    }
+    std::vector<double> inputRows;
+    inputRows.reserve(dependencies_.size());
+    double cost = 0.0;
+    for (auto dep : dependencies_) {
+        inputRows.emplace_back(dep->getRows());
+        cost += dep->getCost();
+    }
+    for (auto body : bodies_) {
+        cost += body->getCost();
+    }
+    auto est = CostModel::estimate(group_->qctx(), node_, inputRows);
+    rows_ = est.rows;
+    cost_ = cost + est.cost;
+    estimated_ = true;
 }
 
 const PlanNode *OptGroupNode::getPlan() const {
+    node_->setCost(getCost());
     switch (node_->dependencies().size()) {
         case 0: {
             DCHECK(dependencies_.empty());
@@ -51,9 +51,15 @@ public:
 
     Status explore(const OptRule *rule);
     Status exploreUntilMaxRound(const OptRule *rule);
+    // The cost and the rows of the cheapest group node
     double getCost() const;
+    double getRows() const;
     const graph::PlanNode *getPlan() const;
 
+    graph::QueryContext *qctx() const {
+        return qctx_;
+    }
+
 private:
     explicit OptGroup(graph::QueryContext *qctx) noexcept;
 
@@ -106,17 +112,27 @@ public:
     }
 
     Status explore(const OptRule *rule);
+    // The cost of the plan rooted at this node, i.e. the cost of the node itself plus the
+    // cost of its dependencies and bodies
     double getCost() const;
+    // The estimated output rows
+    double getRows() const;
     const graph::PlanNode *getPlan() const;
 
 private:
     OptGroupNode(graph::PlanNode *node, const OptGroup *group) noexcept;
 
+    // Estimate once after the exploration, the dependencies don't change then
+    void estimate() const;
+
     graph::PlanNode *node_{nullptr};
     const OptGroup *group_{nullptr};
     std::vector<OptGroup *> dependencies_;
     std::vector<OptGroup *> bodies_;
     std::vector<const OptRule *> exploredRules_;
+    mutable bool estimated_{false};
+    mutable double rows_{0.0};
+    mutable double cost_{0.0};
 };
 
 }   // namespace opt
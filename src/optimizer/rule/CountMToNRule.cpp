@@ -0,0 +1,99 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "optimizer/rule/CountMToNRule.h"
+
+#include "common/expression/AggregateExpression.h"
+#include "optimizer/OptGroup.h"
+#include "planner/PlanNode.h"
+#include "planner/Query.h"
+
+using nebula::graph::Aggregate;
+using nebula::graph::DataCollect;
+using nebula::graph::PlanNode;
+using nebula::graph::QueryContext;
+
+namespace nebula {
+namespace opt {
+
+namespace {
+
+// COUNT(*) counts all the rows, no matter what they are
+bool isCountStar(const Expression *expr) {
+    if (expr->kind() != Expression::Kind::kAggregate) {
+        return false;
+    }
+    auto *aggExpr = static_cast<const AggregateExpression *>(expr);
+    auto *func = aggExpr->name();
+    // COUNT(DISTINCT *) isn't the number of the rows
+    if (func == nullptr || aggExpr->distinct()) {
+        return false;
+    }
+    auto found = AggregateExpression::NAME_ID_MAP.find(func->c_str());
+    return found != AggregateExpression::NAME_ID_MAP.end() &&
+           found->second == AggregateExpression::Function::kCount &&
+           aggExpr->arg() != nullptr && aggExpr->arg()->toString() == "*";
+}
+
+}   // namespace
+
+std::unique_ptr<OptRule> CountMToNRule::kInstance =
+    std::unique_ptr<CountMToNRule>(new CountMToNRule());
+
+CountMToNRule::CountMToNRule() {
+    RuleSet::QueryRules().addRule(this);
+}
+
+const Pattern &CountMToNRule::pattern() const {
+    static Pattern pattern = Pattern::create(graph::PlanNode::Kind::kAggregate,
+                                             {Pattern::create(graph::PlanNode::Kind::kDataCollect)});
+    return pattern;
+}
+
+StatusOr<OptRule::TransformResult> CountMToNRule::transform(QueryContext *qctx,
+                                                            const MatchedResult &matched) const {
+    auto aggGroupNode = matched.node;
+    auto dcGroupNode = matched.dependencies.front().node;
+    auto agg = static_cast<const Aggregate *>(aggGroupNode->node());
+    auto dc = static_cast<const DataCollect *>(dcGroupNode->node());
+
+    if (dc->collectKind() != DataCollect::CollectKind::kMToN || dc->distinct()) {
+        return TransformResult::noTransform();
+    }
+    if (!agg->groupKeys().empty() || agg->groupItems().empty() ||
+        !std::all_of(agg->groupItems().begin(), agg->groupItems().end(), isCountStar)) {
+        return TransformResult::noTransform();
+    }
+    // The rows are still needed if anyone else reads them
+    if (agg->inputVar() != dc->outputVar()) {
+        return TransformResult::noTransform();
+    }
+    auto *dcVar = qctx->symTable()->getVar(dc->outputVar());
+    if (dcVar == nullptr || dcVar->readBy.size() != 1) {
+        return TransformResult::noTransform();
+    }
+
+    auto count = DataCollect::make(qctx, nullptr, DataCollect::CollectKind::kMToNCount, dc->vars());
+    count->setMToN(dc->mToN());
+    count->setOutputVar(agg->outputVar());
+    count->setColNames(agg->colNames());
+    auto countNode = OptGroupNode::create(qctx, count, aggGroupNode->group());
+    for (auto dep : dcGroupNode->dependencies()) {
+        countNode->dependsOn(dep);
+    }
+
+    TransformResult result;
+    result.newGroupNodes.emplace_back(countNode);
+    result.eraseAll = true;
+    return result;
+}
+
+std::string CountMToNRule::toString() const {
+    return "CountMToNRule";
+}
+
+}   // namespace opt
+}   // namespace nebula
@@ -0,0 +1,38 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef OPTIMIZER_RULE_COUNTMTONRULE_H_
+#define OPTIMIZER_RULE_COUNTMTONRULE_H_
+
+#include <memory>
+
+#include "optimizer/OptRule.h"
+
+namespace nebula {
+namespace opt {
+
+// Count the rows of GO M TO N STEPS by the sizes of the steps instead of collecting them,
+// when they are piped to COUNT(*) only, e.g.
+//   GO 1 TO 3 STEPS FROM "a" OVER like YIELD like._dst AS dst | YIELD COUNT(*)
+class CountMToNRule final : public OptRule {
+public:
+    const Pattern &pattern() const override;
+
+    StatusOr<OptRule::TransformResult> transform(graph::QueryContext *qctx,
+                                                 const MatchedResult &matched) const override;
+
+    std::string toString() const override;
+
+private:
+    CountMToNRule();
+
+    static std::unique_ptr<OptRule> kInstance;
+};
+
+}   // namespace opt
+}   // namespace nebula
+
+#endif   // OPTIMIZER_RULE_COUNTMTONRULE_H_
@@ -6,6 +6,7 @@
 
 #include "optimizer/rule/IndexScanRule.h"
 #include "common/expression/LabelAttributeExpression.h"
+#include "optimizer/CostModel.h"
 #include "optimizer/OptGroup.h"
 #include "planner/PlanNode.h"
 #include "planner/Query.h"
@@ -434,9 +435,30 @@ IndexItem IndexScanRule::findOptimalIndex(graph::QueryContext *qctx,
     // Step 3 : find optimal indexes for range condition.
     auto indexesRange = findIndexForRangeScan(indexesEq, items);
 
-    // At this stage, all the optimizations are done.
-    // Because the storage layer only needs one. So return first one of indexesRange.
-    return indexesRange[0];
+    // Step 4 : the storage layer only needs one, so choose the cheapest one.
+    return findCheapestIndex(indexesRange, items);
+}
+
+// Find the index estimated to hit the fewest rows by its column hints,
+// and the one with fewer fields reads shorter keys for the tie.
+IndexItem IndexScanRule::findCheapestIndex(const std::vector<IndexItem>& indexes,
+                                           const FilterItems& items) const {
+    IndexItem result = nullptr;
+    double minRows = 0.0;
+    for (const auto& index : indexes) {
+        IndexQueryCtx iqctx = std::make_unique<std::vector<IndexQueryContext>>();
+        if (!appendIQCtx(index, items, iqctx).ok() || iqctx->empty()) {
+            continue;
+        }
+        auto rows = CostModel::indexScanRows(CostModel::kDefaultScanRows,
+                                             iqctx->front().get_column_hints());
+        if (result == nullptr || rows < minRows ||
+            (rows == minRows && index->get_fields().size() < result->get_fields().size())) {
+            result = index;
+            minRows = rows;
+        }
+    }
+    return result == nullptr ? indexes[0] : result;
 }
 
 // Find the index with the fewest fields
@@ -162,6 +162,9 @@ private:
                                const OptGroupNode *groupNode,
                                const FilterItems& items) const;
 
+    IndexItem findCheapestIndex(const std::vector<IndexItem>& indexes,
+                                const FilterItems& items) const;
+
     IndexItem findLightestIndex(graph::QueryContext *qctx,
                                 const OptGroupNode *groupNode) const;
 
@@ -0,0 +1,83 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include <gtest/gtest.h>
+
+#include "common/expression/ConstantExpression.h"
+#include "context/QueryContext.h"
+#include "optimizer/CostModel.h"
+#include "planner/Logic.h"
+#include "planner/Query.h"
+#include "util/StatsCache.h"
+
+namespace nebula {
+namespace opt {
+
+using graph::Aggregate;
+using graph::Filter;
+using graph::Limit;
+using graph::QueryContext;
+using graph::StartNode;
+using graph::StatsCache;
+
+TEST(CostModelTest, Estimate) {
+    QueryContext qctx;
+    auto* start = StartNode::make(&qctx);
+    {
+        auto est = CostModel::estimate(&qctx, start, {});
+        EXPECT_EQ(est.rows, 1.0);
+        EXPECT_EQ(est.cost, 0.0);
+    }
+    {
+        auto* filter = Filter::make(
+            &qctx, start, qctx.objPool()->add(new ConstantExpression(true)));
+        auto est = CostModel::estimate(&qctx, filter, {100.0});
+        EXPECT_EQ(est.rows, 100.0 * CostModel::kFilterSelectivity);
+        EXPECT_EQ(est.cost, 100.0);
+    }
+    {
+        auto* limit = Limit::make(&qctx, start, 10, 20);
+        EXPECT_EQ(CostModel::estimate(&qctx, limit, {100.0}).rows, 30.0);
+        EXPECT_EQ(CostModel::estimate(&qctx, limit, {5.0}).rows, 5.0);
+    }
+    {
+        auto* agg = Aggregate::make(&qctx, start, {}, {});
+        EXPECT_EQ(CostModel::estimate(&qctx, agg, {100.0}).rows, 1.0);
+    }
+}
+
+TEST(CostModelTest, IndexScanRows) {
+    storage::cpp2::IndexColumnHint prefix;
+    prefix.set_scan_type(storage::cpp2::ScanType::PREFIX);
+    storage::cpp2::IndexColumnHint range;
+    range.set_scan_type(storage::cpp2::ScanType::RANGE);
+
+    EXPECT_EQ(CostModel::indexScanRows(1000.0, {}), 1000.0);
+    EXPECT_LT(CostModel::indexScanRows(1000.0, {prefix}),
+              CostModel::indexScanRows(1000.0, {range}));
+    EXPECT_LT(CostModel::indexScanRows(1000.0, {prefix, range}),
+              CostModel::indexScanRows(1000.0, {prefix}));
+    EXPECT_EQ(CostModel::indexScanRows(1.0, {prefix, prefix}), 1.0);
+}
+
+TEST(CostModelTest, StatsCache) {
+    meta::cpp2::StatisItem item;
+    item.set_tag_vertices({{"person", 100}});
+    item.set_edges({{"like", 1000}});
+    StatsCache::instance().set(1, std::move(item));
+
+    auto stats = StatsCache::instance().get(nullptr, 1);
+    ASSERT_NE(stats, nullptr);
+    EXPECT_EQ(StatsCache::tagCount(stats.get(), "person"), 100);
+    EXPECT_EQ(StatsCache::tagCount(stats.get(), "team"), -1);
+    EXPECT_EQ(StatsCache::edgeCount(stats.get(), "like"), 1000);
+    EXPECT_EQ(StatsCache::edgeCount(nullptr, "like"), -1);
+    EXPECT_EQ(StatsCache::instance().get(nullptr, 2), nullptr);
+    StatsCache::instance().clear();
+}
+
+}   // namespace opt
+}   // namespace nebula
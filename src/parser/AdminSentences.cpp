@@ -41,6 +41,10 @@ std::string ShowCharsetSentence::toString() const {
     return std::string("SHOW CHARSET");
 }
 
+std::string ShowQueriesSentence::toString() const {
+    return std::string("SHOW QUERIES");
+}
+
 std::string ShowCollationSentence::toString() const {
     return std::string("SHOW COLLATION");
 }
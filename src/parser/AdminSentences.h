@@ -120,6 +120,14 @@ public:
     std::string toString() const override;
 };
 
+class ShowQueriesSentence final : public Sentence {
+public:
+    ShowQueriesSentence() {
+        kind_ = Kind::kShowQueries;
+    }
+    std::string toString() const override;
+};
+
 class ShowCollationSentence final : public Sentence {
 public:
     ShowCollationSentence() {
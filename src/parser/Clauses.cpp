@@ -89,6 +89,30 @@ std::string OverEdges::toString() const {
     return buf;
 }
 
+std::string WeightClause::toString() const {
+    std::string buf;
+    buf.reserve(256);
+    buf += "WEIGHT BY ";
+    buf += *edge_;
+    buf += ".";
+    buf += *prop_;
+    return buf;
+}
+
+std::string TruncateClause::toString() const {
+    std::string buf;
+    buf.reserve(256);
+    buf += isSample_ ? "SAMPLE [" : "LIMIT [";
+    for (size_t i = 0; i < limits_->size(); ++i) {
+        if (i > 0) {
+            buf += ",";
+        }
+        buf += folly::to<std::string>((*limits_)[i]);
+    }
+    buf += "]";
+    return buf;
+}
+
 std::string OverClause::toString() const {
     std::string buf;
     buf.reserve(256);
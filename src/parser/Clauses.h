@@ -189,6 +189,52 @@ private:
     bool                                          isOverAll_{false};
 };
 
+class WeightClause final {
+public:
+    WeightClause(std::string *edge, std::string *prop) {
+        edge_.reset(edge);
+        prop_.reset(prop);
+    }
+
+    const std::string* edge() const {
+        return edge_.get();
+    }
+
+    const std::string* prop() const {
+        return prop_.get();
+    }
+
+    std::string toString() const;
+
+private:
+    std::unique_ptr<std::string>                edge_;
+    std::unique_ptr<std::string>                prop_;
+};
+
+// The per step cap on the edges expanded from each vertex, i.e. LIMIT [n1, n2, ...] keeps the
+// first n edges of a vertex and SAMPLE [n1, n2, ...] samples n edges of a vertex at random
+class TruncateClause final {
+public:
+    TruncateClause(std::vector<int32_t> *limits, bool isSample) {
+        limits_.reset(limits);
+        isSample_ = isSample;
+    }
+
+    const std::vector<int32_t>& limits() const {
+        return *limits_;
+    }
+
+    bool isSample() const {
+        return isSample_;
+    }
+
+    std::string toString() const;
+
+private:
+    std::unique_ptr<std::vector<int32_t>>       limits_;
+    bool                                        isSample_{false};
+};
+
 class WhereClause final {
 public:
     explicit WhereClause(Expression *filter) {
@@ -79,6 +79,7 @@ public:
         kShowZones,
         kShowStats,
         kShowTSClients,
+        kShowQueries,
         kDeleteVertices,
         kDeleteEdges,
         kLookup,
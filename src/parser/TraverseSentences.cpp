@@ -33,6 +33,10 @@ std::string GoSentence::toString() const {
         buf += " ";
         buf += yieldClause_->toString();
     }
+    if (truncateClause_ != nullptr) {
+        buf += " ";
+        buf += truncateClause_->toString();
+    }
 
     return buf;
 }
@@ -196,6 +200,10 @@ std::string FindPathSentence::toString() const {
         buf += over_->toString();
         buf += " ";
     }
+    if (weight_ != nullptr) {
+        buf += weight_->toString();
+        buf += " ";
+    }
     if (step_ != nullptr) {
         buf += step_->toString();
         buf += " ";
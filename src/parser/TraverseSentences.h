@@ -40,6 +40,10 @@ public:
         yieldClause_.reset(clause);
     }
 
+    void setTruncateClause(TruncateClause *clause) {
+        truncateClause_.reset(clause);
+    }
+
     const StepClause* stepClause() const {
         return stepClause_.get();
     }
@@ -68,6 +72,10 @@ public:
         return yieldClause_.get();
     }
 
+    const TruncateClause* truncateClause() const {
+        return truncateClause_.get();
+    }
+
     std::string toString() const override;
 
 private:
@@ -76,6 +84,7 @@ private:
     std::unique_ptr<OverClause>                 overClause_;
     std::unique_ptr<WhereClause>                whereClause_;
     std::unique_ptr<YieldClause>                yieldClause_;
+    std::unique_ptr<TruncateClause>             truncateClause_;
 };
 
 
@@ -460,6 +469,10 @@ public:
         where_.reset(clause);
     }
 
+    void setWeight(WeightClause *clause) {
+        weight_.reset(clause);
+    }
+
     FromClause* from() const {
         return from_.get();
     }
@@ -480,6 +493,10 @@ public:
         return where_.get();
     }
 
+    WeightClause* weight() const {
+        return weight_.get();
+    }
+
     bool isShortest() const {
         return isShortest_;
     }
@@ -503,6 +520,7 @@ private:
     std::unique_ptr<OverClause>     over_;
     std::unique_ptr<StepClause>     step_;
     std::unique_ptr<WhereClause>    where_;
+    std::unique_ptr<WeightClause>   weight_;
 };
 
 class LimitSentence final : public Sentence {
@@ -70,6 +70,8 @@ static constexpr size_t MAX_ABS_INTEGER = 9223372036854775808ULL;
     nebula::ColumnNameList                 *column_name_list;
     nebula::StepClause                     *step_clause;
     nebula::StepClause                     *find_path_upto_clause;
+    nebula::WeightClause                   *find_path_weight_clause;
+    nebula::TruncateClause                 *truncate_clause;
     nebula::FromClause                     *from_clause;
     nebula::ToClause                       *to_clause;
     nebula::VertexIDList                   *vid_list;
@@ -168,10 +170,11 @@ static constexpr size_t MAX_ABS_INTEGER = 9223372036854775808ULL;
 %token KW_ORDER KW_ASC KW_LIMIT KW_OFFSET KW_ASCENDING KW_DESCENDING
 %token KW_DISTINCT KW_ALL KW_OF
 %token KW_BALANCE KW_LEADER KW_RESET KW_PLAN
-%token KW_SHORTEST KW_PATH KW_NOLOOP
+%token KW_SHORTEST KW_PATH KW_NOLOOP KW_WEIGHT KW_SAMPLE
 %token KW_IS KW_NULL KW_DEFAULT
 %token KW_SNAPSHOT KW_SNAPSHOTS KW_LOOKUP
 %token KW_JOBS KW_JOB KW_RECOVER KW_FLUSH KW_COMPACT KW_REBUILD KW_SUBMIT KW_STATS KW_STATUS
+%token KW_QUERIES
 %token KW_BIDIRECT
 %token KW_USER KW_USERS KW_ACCOUNT
 %token KW_PASSWORD KW_CHANGE KW_ROLE KW_ROLES
@@ -269,6 +272,8 @@ static constexpr size_t MAX_ABS_INTEGER = 9223372036854775808ULL;
 %type <edge_key_ref> edge_key_ref
 %type <to_clause> to_clause
 %type <find_path_upto_clause> find_path_upto_clause
+%type <find_path_weight_clause> find_path_weight_clause
+%type <truncate_clause> truncate_clause
 %type <group_clause> group_clause
 %type <host_list> host_list
 %type <host_item> host_item
@@ -468,6 +473,8 @@ unreserved_keyword
     | KW_NONE               { $$ = new std::string("none"); }
     | KW_REDUCE             { $$ = new std::string("reduce"); }
     | KW_SHORTEST           { $$ = new std::string("shortest"); }
+    | KW_WEIGHT             { $$ = new std::string("weight"); }
+    | KW_SAMPLE             { $$ = new std::string("sample"); }
     | KW_NOLOOP             { $$ = new std::string("noloop"); }
     | KW_COUNT_DISTINCT     { $$ = new std::string("count_distinct"); }
     | KW_CONTAINS           { $$ = new std::string("contains"); }
@@ -494,6 +501,7 @@ unreserved_keyword
     | KW_ELASTICSEARCH      { $$ = new std::string("elasticsearch"); }
     | KW_STATS              { $$ = new std::string("stats"); }
     | KW_STATUS             { $$ = new std::string("status"); }
+    | KW_QUERIES            { $$ = new std::string("queries"); }
     | KW_AUTO               { $$ = new std::string("auto"); }
     | KW_FUZZY              { $$ = new std::string("fuzzy"); }
     | KW_PREFIX             { $$ = new std::string("prefix"); }
@@ -1062,7 +1070,7 @@ map_item_list
     ;
 
 go_sentence
-    : KW_GO step_clause from_clause over_clause where_clause yield_clause {
+    : KW_GO step_clause from_clause over_clause where_clause yield_clause truncate_clause {
         auto go = new GoSentence();
         go->setStepClause($2);
         go->setFromClause($3);
@@ -1081,10 +1089,21 @@ go_sentence
             $6 = new YieldClause(cols);
         }
         go->setYieldClause($6);
+        go->setTruncateClause($7);
         $$ = go;
     }
     ;
 
+truncate_clause
+    : %empty { $$ = nullptr; }
+    | KW_LIMIT L_BRACKET integer_list R_BRACKET {
+        $$ = new TruncateClause($3, false);
+    }
+    | KW_SAMPLE L_BRACKET integer_list R_BRACKET {
+        $$ = new TruncateClause($3, true);
+    }
+    ;
+
 step_clause
     : %empty { $$ = new StepClause(); }
     | legal_integer KW_STEPS {
@@ -1806,13 +1825,14 @@ find_path_sentence
         /* s->setWhere($9); */
         $$ = s;
     }
-    | KW_FIND KW_SHORTEST KW_PATH opt_with_properites from_clause to_clause over_clause find_path_upto_clause
+    | KW_FIND KW_SHORTEST KW_PATH opt_with_properites from_clause to_clause over_clause find_path_weight_clause find_path_upto_clause
     /* where_clause */ {
         auto *s = new FindPathSentence(true, $4, false);
         s->setFrom($5);
         s->setTo($6);
         s->setOver($7);
-        s->setStep($8);
+        s->setWeight($8);
+        s->setStep($9);
         /* s->setWhere($9); */
         $$ = s;
     }
@@ -1833,6 +1853,13 @@ opt_with_properites
     | KW_WITH KW_PROP { $$ = true; }
     ;
 
+find_path_weight_clause
+    : %empty { $$ = nullptr; }
+    | KW_WEIGHT KW_BY name_label DOT name_label {
+        $$ = new WeightClause($3, $5);
+    }
+    ;
+
 find_path_upto_clause
     : %empty { $$ = new StepClause(5); }
     | KW_UPTO legal_integer KW_STEPS {
@@ -2752,6 +2779,9 @@ show_sentence
     | KW_SHOW KW_STATS {
         $$ = new ShowStatsSentence();
     }
+    | KW_SHOW KW_QUERIES {
+        $$ = new ShowQueriesSentence();
+    }
     | KW_SHOW KW_TEXT KW_SEARCH KW_CLIENTS {
         $$ = new ShowTSClientsSentence();
     }
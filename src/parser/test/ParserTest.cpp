@@ -167,6 +167,24 @@ TEST(Parser, Go) {
         auto result = parser.parse(query);
         ASSERT_TRUE(result.ok()) << result.status();
     }
+    {
+        GQLParser parser;
+        std::string query = "GO 2 STEPS FROM \"1\" OVER friend YIELD friend._dst LIMIT [2, 3]";
+        auto result = parser.parse(query);
+        ASSERT_TRUE(result.ok()) << result.status();
+    }
+    {
+        GQLParser parser;
+        std::string query = "GO 1 TO 2 STEPS FROM \"1\" OVER friend SAMPLE [10, 2]";
+        auto result = parser.parse(query);
+        ASSERT_TRUE(result.ok()) << result.status();
+    }
+    {
+        GQLParser parser;
+        std::string query = "GO FROM \"1\" OVER friend SAMPLE 10";
+        auto result = parser.parse(query);
+        ASSERT_FALSE(result.ok());
+    }
 }
 
 TEST(Parser, SpaceOperation) {
@@ -1523,6 +1541,12 @@ TEST(Parser, AdminOperation) {
         auto result = parser.parse(query);
         ASSERT_TRUE(result.ok()) << result.status();
     }
+    {
+        GQLParser parser;
+        std::string query = "SHOW QUERIES";
+        auto result = parser.parse(query);
+        ASSERT_TRUE(result.ok()) << result.status();
+    }
 }
 
 TEST(Parser, UserOperation) {
@@ -2045,6 +2069,19 @@ TEST(Parser, FindPath) {
         auto result = parser.parse(query);
         ASSERT_TRUE(result.ok()) << result.status();
     }
+    {
+        GQLParser parser;
+        std::string query = "FIND SHORTEST PATH FROM \"1\" TO \"2\" OVER like "
+                            "WEIGHT BY like.likeness UPTO 3 STEPS";
+        auto result = parser.parse(query);
+        ASSERT_TRUE(result.ok()) << result.status();
+    }
+    {
+        GQLParser parser;
+        std::string query = "FIND ALL PATH FROM \"1\" TO \"2\" OVER like WEIGHT BY like.likeness";
+        auto result = parser.parse(query);
+        ASSERT_FALSE(result.ok());
+    }
 }
 
 TEST(Parser, Limit) {
@@ -419,6 +419,12 @@ TEST(Scanner, Basic) {
         CHECK_SEMANTIC_TYPE("SHORTEST", TokenType::KW_SHORTEST),
         CHECK_SEMANTIC_TYPE("Shortest", TokenType::KW_SHORTEST),
         CHECK_SEMANTIC_TYPE("shortest", TokenType::KW_SHORTEST),
+        CHECK_SEMANTIC_TYPE("WEIGHT", TokenType::KW_WEIGHT),
+        CHECK_SEMANTIC_TYPE("Weight", TokenType::KW_WEIGHT),
+        CHECK_SEMANTIC_TYPE("weight", TokenType::KW_WEIGHT),
+        CHECK_SEMANTIC_TYPE("SAMPLE", TokenType::KW_SAMPLE),
+        CHECK_SEMANTIC_TYPE("Sample", TokenType::KW_SAMPLE),
+        CHECK_SEMANTIC_TYPE("sample", TokenType::KW_SAMPLE),
         CHECK_SEMANTIC_TYPE("SUBGRAPH", TokenType::KW_SUBGRAPH),
         CHECK_SEMANTIC_TYPE("Subgraph", TokenType::KW_SUBGRAPH),
         CHECK_SEMANTIC_TYPE("subgraph", TokenType::KW_SUBGRAPH),
@@ -482,6 +488,9 @@ TEST(Scanner, Basic) {
         CHECK_SEMANTIC_TYPE("STATS", TokenType::KW_STATS),
         CHECK_SEMANTIC_TYPE("Stats", TokenType::KW_STATS),
         CHECK_SEMANTIC_TYPE("stats", TokenType::KW_STATS),
+        CHECK_SEMANTIC_TYPE("QUERIES", TokenType::KW_QUERIES),
+        CHECK_SEMANTIC_TYPE("Queries", TokenType::KW_QUERIES),
+        CHECK_SEMANTIC_TYPE("queries", TokenType::KW_QUERIES),
         CHECK_SEMANTIC_TYPE("ANY", TokenType::KW_ANY),
         CHECK_SEMANTIC_TYPE("any", TokenType::KW_ANY),
         CHECK_SEMANTIC_TYPE("SINGLE", TokenType::KW_SINGLE),
@@ -906,6 +906,17 @@ private:
         : SingleDependencyNode(qctx, Kind::kShowCollation, input) {}
 };
 
+class ShowQueries final : public SingleDependencyNode {
+public:
+    static ShowQueries* make(QueryContext* qctx, PlanNode* input) {
+        return qctx->objPool()->add(new ShowQueries(qctx, input));
+    }
+
+private:
+    ShowQueries(QueryContext* qctx, PlanNode* input)
+        : SingleDependencyNode(qctx, Kind::kShowQueries, input) {}
+};
+
 class AddGroup final : public SingleDependencyNode {
 public:
     static AddGroup* make(QueryContext* qctx,
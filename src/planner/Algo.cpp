@@ -10,6 +10,13 @@ namespace nebula {
 namespace graph {
 
 
+std::unique_ptr<PlanNodeDescription> ProduceSemiShortestPath::explain() const {
+    auto desc = SingleDependencyNode::explain();
+    addDescription("weight", util::toJson(weightProp_), desc.get());
+    addDescription("trackSources", util::toJson(trackSources_), desc.get());
+    return desc;
+}
+
 std::unique_ptr<PlanNodeDescription> ConjunctPath::explain() const {
     auto desc = BiInputNode::explain();
     switch (pathKind_) {
@@ -29,8 +36,24 @@ std::unique_ptr<PlanNodeDescription> ConjunctPath::explain() const {
             addDescription("kind", "AllPath", desc.get());
             break;
         }
+        case PathKind::kMultiSourceBFS: {
+            addDescription("kind", "MultiSourceBFS", desc.get());
+            break;
+        }
+        case PathKind::kBiLabelCorrecting: {
+            addDescription("kind", "LabelCorrecting", desc.get());
+            break;
+        }
     }
     addDescription("conditionalVar", util::toJson(conditionalVar_), desc.get());
+    if (!directionVar_.empty()) {
+        addDescription("directionVar", util::toJson(directionVar_), desc.get());
+    }
+    if (!terminationVar_.empty()) {
+        addDescription("terminationVar", util::toJson(terminationVar_), desc.get());
+        addDescription("leftFrontierVar", util::toJson(leftFrontierVar_), desc.get());
+        addDescription("rightFrontierVar", util::toJson(rightFrontierVar_), desc.get());
+    }
     addDescription("noloop", util::toJson(noLoop_), desc.get());
     return desc;
 }
@@ -58,6 +81,7 @@ Status CartesianProduct::addVar(std::string varName) {
     DCHECK(varPtr != nullptr);
     allColNames_.emplace_back(varPtr->colNames);
     inputVars_.emplace_back(varPtr);
+    qctx_->symTable()->readBy(varName, this);
     return Status::OK();
 }
 
@@ -70,5 +94,40 @@ std::vector<std::string> CartesianProduct::inputVars() const {
     return varNames;
 }
 
+IntersectNeighbors::IntersectNeighbors(QueryContext* qctx,
+                                       PlanNode* input,
+                                       const std::string& edgesVar,
+                                       const std::string& bindingsVar,
+                                       Expression* srcVid,
+                                       std::vector<Expression*> boundVids,
+                                       std::vector<std::string> neighborsVars)
+    : SingleDependencyNode(qctx, Kind::kIntersectNeighbors, input),
+      edgesVar_(edgesVar),
+      bindingsVar_(bindingsVar),
+      srcVid_(srcVid),
+      boundVids_(std::move(boundVids)),
+      neighborsVars_(std::move(neighborsVars)) {
+    DCHECK_EQ(boundVids_.size(), neighborsVars_.size());
+    inputVars_.clear();
+    std::vector<std::string> vars = {edgesVar_, bindingsVar_};
+    vars.insert(vars.end(), neighborsVars_.begin(), neighborsVars_.end());
+    for (auto& var : vars) {
+        auto* varPtr = qctx_->symTable()->getVar(var);
+        DCHECK(varPtr != nullptr);
+        inputVars_.emplace_back(varPtr);
+        qctx_->symTable()->readBy(var, this);
+    }
+}
+
+std::unique_ptr<PlanNodeDescription> IntersectNeighbors::explain() const {
+    auto desc = SingleDependencyNode::explain();
+    addDescription("edgesVar", util::toJson(edgesVar_), desc.get());
+    addDescription("bindingsVar", util::toJson(bindingsVar_), desc.get());
+    addDescription("srcVid", srcVid_ ? srcVid_->toString() : "", desc.get());
+    addDescription("boundVids", folly::toJson(util::toJson(boundVids_)), desc.get());
+    addDescription("neighborsVars", folly::toJson(util::toJson(neighborsVars_)), desc.get());
+    return desc;
+}
+
 }  // namespace graph
 }  // namespace nebula
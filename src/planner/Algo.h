@@ -19,9 +19,39 @@ public:
         return qctx->objPool()->add(new ProduceSemiShortestPath(qctx, input));
     }
 
+    // The shortest paths found are referred to by the later steps
+    bool refersToEarlierOutputs() const override {
+        return !trackSources_;
+    }
+
+    // Track only the starts reaching each vertex by SourceBits, and output the edges of the
+    // shortest paths with the starts of them instead of the paths, which are built by
+    // ConjunctPath for the pairs met. The columns are the dst, the edge and the starts.
+    bool trackSources() const {
+        return trackSources_;
+    }
+
+    void setTrackSources(bool trackSources) {
+        trackSources_ = trackSources;
+    }
+
+    // The edge prop to weight the paths by, empty to count the hops
+    const std::string& weightProp() const {
+        return weightProp_;
+    }
+
+    void setWeightProp(std::string prop) {
+        weightProp_ = std::move(prop);
+    }
+
+    std::unique_ptr<PlanNodeDescription> explain() const override;
+
 private:
     ProduceSemiShortestPath(QueryContext* qctx, PlanNode* input)
         : SingleInputNode(qctx, Kind::kProduceSemiShortestPath, input) {}
+
+    std::string weightProp_;
+    bool trackSources_{false};
 };
 
 class BFSShortestPath : public SingleInputNode {
@@ -42,6 +72,9 @@ public:
         kBiDijkstra,
         kFloyd,
         kAllPaths,
+        kMultiSourceBFS,
+        // The weighted paths relaxed level by level until no cost improves
+        kBiLabelCorrecting,
     };
 
     static ConjunctPath* make(QueryContext* qctx,
@@ -68,6 +101,41 @@ public:
         return conditionalVar_;
     }
 
+    // The variable of the condition choosing the side to expand, true if the forward side has
+    // expanded in this iteration. Only one side expands in each iteration of the BFS.
+    void setDirectionVar(std::string varName) {
+        directionVar_ = std::move(varName);
+    }
+
+    const std::string& directionVar() const {
+        return directionVar_;
+    }
+
+    // The variable set true by the multi-source BFS once no more shortest paths could be found,
+    // i.e. the paths of all the pairs are found or either side has nothing left to expand.
+    void setTerminationVar(std::string varName) {
+        terminationVar_ = std::move(varName);
+    }
+
+    const std::string& terminationVar() const {
+        return terminationVar_;
+    }
+
+    // The variables of the vids which both sides expand in the next iteration. The multi-source
+    // BFS drops the vertices reached only by the starts of the found pairs from them.
+    void setFrontierVars(std::string leftVar, std::string rightVar) {
+        leftFrontierVar_ = std::move(leftVar);
+        rightFrontierVar_ = std::move(rightVar);
+    }
+
+    const std::string& leftFrontierVar() const {
+        return leftFrontierVar_;
+    }
+
+    const std::string& rightFrontierVar() const {
+        return rightFrontierVar_;
+    }
+
     bool noLoop() const {
         return noLoop_;
     }
@@ -75,6 +143,21 @@ public:
     void setNoLoop(bool noLoop) {
         noLoop_ = noLoop;
     }
+
+    // The latest and the previous steps of the right side are conjuncted, the BFS keeps the
+    // steps itself and the weighted paths are conjuncted with all the steps
+    size_t numVersionsToRead(const std::string& var) const override {
+        switch (pathKind_) {
+            case PathKind::kBiBFS:
+            case PathKind::kMultiSourceBFS:
+                return 1;
+            case PathKind::kBiLabelCorrecting:
+                return Variable::kAllVersions;
+            default:
+                return var == rightInputVar() ? 2 : 1;
+        }
+    }
+
     std::unique_ptr<PlanNodeDescription> explain() const override;
 
 private:
@@ -91,6 +174,10 @@ private:
     PathKind pathKind_;
     size_t   steps_{0};
     std::string conditionalVar_;
+    std::string directionVar_;
+    std::string terminationVar_;
+    std::string leftFrontierVar_;
+    std::string rightFrontierVar_;
     bool noLoop_;
 };
 
@@ -178,6 +265,70 @@ private:
     uint32_t steps_;
 };
 
+/*
+ * Keep the edges of the GetNeighbors result `edgesVar' whose other ends are also neighbors of
+ * the vertices bound with their source, i.e. intersect the neighbors of all the vertices of
+ * each row of `bindingsVar'. The source is `srcVid' of the row, and the i-th vertex bound is
+ * `boundVids[i]' of the row, whose neighbors are in the GetNeighbors result `neighborsVars[i]'.
+ * It outputs the edges kept in the iterator of `edgesVar', so it closes the cycles of
+ * patterns without materializing the open paths.
+ */
+class IntersectNeighbors final : public SingleDependencyNode {
+public:
+    static IntersectNeighbors* make(QueryContext* qctx,
+                                    PlanNode* input,
+                                    const std::string& edgesVar,
+                                    const std::string& bindingsVar,
+                                    Expression* srcVid,
+                                    std::vector<Expression*> boundVids,
+                                    std::vector<std::string> neighborsVars) {
+        return qctx->objPool()->add(new IntersectNeighbors(qctx,
+                                                           input,
+                                                           edgesVar,
+                                                           bindingsVar,
+                                                           srcVid,
+                                                           std::move(boundVids),
+                                                           std::move(neighborsVars)));
+    }
+
+    const std::string& edgesVar() const {
+        return edgesVar_;
+    }
+
+    const std::string& bindingsVar() const {
+        return bindingsVar_;
+    }
+
+    Expression* srcVid() const {
+        return srcVid_;
+    }
+
+    const std::vector<Expression*>& boundVids() const {
+        return boundVids_;
+    }
+
+    const std::vector<std::string>& neighborsVars() const {
+        return neighborsVars_;
+    }
+
+    std::unique_ptr<PlanNodeDescription> explain() const override;
+
+private:
+    IntersectNeighbors(QueryContext* qctx,
+                       PlanNode* input,
+                       const std::string& edgesVar,
+                       const std::string& bindingsVar,
+                       Expression* srcVid,
+                       std::vector<Expression*> boundVids,
+                       std::vector<std::string> neighborsVars);
+
+    std::string                         edgesVar_;
+    std::string                         bindingsVar_;
+    Expression*                         srcVid_{nullptr};
+    std::vector<Expression*>            boundVids_;
+    std::vector<std::string>            neighborsVars_;
+};
+
 }  // namespace graph
 }  // namespace nebula
 #endif  // PLANNER_ALGO_H_
@@ -214,6 +214,10 @@ const char* PlanNode::toString(PlanNode::Kind kind) {
             return "CartesianProduct";
         case Kind::kSubgraph:
             return "Subgraph";
+        case Kind::kIntersectNeighbors:
+            return "IntersectNeighbors";
+        case Kind::kTraverse:
+            return "Traverse";
         // Group and Zone
         case Kind::kAddGroup:
             return "AddGroup";
@@ -250,6 +254,8 @@ const char* PlanNode::toString(PlanNode::Kind kind) {
         // text search
         case Kind::kShowTSClients:
             return "ShowTSClients";
+        case Kind::kShowQueries:
+            return "ShowQueries";
         case Kind::kSignInTSService:
             return "SignInTSService";
         case Kind::kSignOutTSService:
@@ -271,10 +277,6 @@ void PlanNode::addDescription(std::string key, std::string value, PlanNodeDescri
     desc->description->emplace_back(Pair{std::move(key), std::move(value)});
 }
 
-void PlanNode::calcCost() {
-    VLOG(1) << "unimplemented cost calculation.";
-}
-
 std::unique_ptr<PlanNodeDescription> PlanNode::explain() const {
     auto desc = std::make_unique<PlanNodeDescription>();
     desc->id = id_;
@@ -120,6 +120,8 @@ public:
         kProduceAllPaths,
         kCartesianProduct,
         kSubgraph,
+        kIntersectNeighbors,
+        kTraverse,
         // zone related
         kAddGroup,
         kDropGroup,
@@ -137,6 +139,7 @@ public:
         kShowListener,
         // text service related
         kShowTSClients,
+        kShowQueries,
         kSignInTSService,
         kSignOutTSService,
         kDownload,
@@ -150,8 +153,6 @@ public:
     // Describe plan node
     virtual std::unique_ptr<PlanNodeDescription> explain() const;
 
-    virtual void calcCost();
-
     Kind kind() const {
         return kind_;
     }
@@ -164,6 +165,19 @@ public:
         return false;
     }
 
+    // The number of the latest versions of the input variable `var' read by this node,
+    // Variable::kAllVersions if it reads the whole history
+    virtual size_t numVersionsToRead(const std::string& var) const {
+        UNUSED(var);
+        return 1;
+    }
+
+    // Whether the executor of this node refers to the values of its earlier outputs,
+    // then the whole history of the output variable is kept
+    virtual bool refersToEarlierOutputs() const {
+        return false;
+    }
+
     void setOutputVar(const std::string &var) {
         DCHECK_EQ(1, outputVars_.size());
         auto* outputVarPtr = qctx_->symTable()->getVar(var);
@@ -227,10 +241,15 @@ public:
 
     static const char* toString(Kind kind);
 
+    // The estimated cost of the plan rooted at this node, set by the optimizer
     double cost() const {
         return cost_;
     }
 
+    void setCost(double cost) {
+        cost_ = cost;
+    }
+
 protected:
     static void addDescription(std::string key, std::string value, PlanNodeDescription* desc);
 
@@ -49,6 +49,10 @@ std::unique_ptr<PlanNodeDescription> GetNeighbors::explain() const {
         "statProps", statProps_ ? folly::toJson(util::toJson(*statProps_)) : "", desc.get());
     addDescription("exprs", exprs_ ? folly::toJson(util::toJson(*exprs_)) : "", desc.get());
     addDescription("random", util::toJson(random_), desc.get());
+    if (!vertexLimits_.empty()) {
+        addDescription("vertexLimits", folly::toJson(util::toJson(vertexLimits_)), desc.get());
+        addDescription("sample", util::toJson(sample_), desc.get());
+    }
     return desc;
 }
 
@@ -58,6 +62,7 @@ void GetNeighbors::clone(const GetNeighbors& g) {
     setEdgeTypes(g.edgeTypes_);
     setEdgeDirection(g.edgeDirection_);
     setRandom(g.random_);
+    setVertexLimits(g.vertexLimits_, g.sample_, g.stepVar_);
     if (g.vertexProps_) {
         auto vertexProps = *g.vertexProps_;
         auto vertexPropsPtr = std::make_unique<decltype(vertexProps)>(vertexProps);
@@ -83,6 +88,15 @@ void GetNeighbors::clone(const GetNeighbors& g) {
     }
 }
 
+std::unique_ptr<PlanNodeDescription> Traverse::explain() const {
+    auto desc = GetNeighbors::explain();
+    addDescription("minSteps", folly::to<std::string>(minSteps_), desc.get());
+    addDescription("maxSteps", folly::to<std::string>(maxSteps_), desc.get());
+    addDescription(
+        "vertexFilter", vertexFilter_ ? vertexFilter_->toString() : "", desc.get());
+    addDescription("edgeFilter", edgeFilter_ ? edgeFilter_->toString() : "", desc.get());
+    return desc;
+}
 
 std::unique_ptr<PlanNodeDescription> GetVertices::explain() const {
     auto desc = Explore::explain();
@@ -250,10 +264,32 @@ std::unique_ptr<PlanNodeDescription> DataCollect::explain() const {
             addDescription("kind", "Multiple Pair Shortest", desc.get());
             break;
         }
+        case CollectKind::kMToNCount: {
+            addDescription("kind", "M TO N COUNT", desc.get());
+            break;
+        }
     }
     return desc;
 }
 
+size_t DataCollect::numVersionsToRead(const std::string& var) const {
+    UNUSED(var);
+    switch (collectKind_) {
+        // Collect the results of all the steps, the history of the steps is indexed from
+        // the oldest and bounded by the steps of the loop
+        case CollectKind::kSubgraph:
+        case CollectKind::kMToN:
+        case CollectKind::kMToNCount:
+        case CollectKind::kAllPaths:
+        case CollectKind::kMultiplePairShortest:
+            return Variable::kAllVersions;
+        case CollectKind::kRowBasedMove:
+        case CollectKind::kBFSShortest:
+            return 1;
+    }
+    return Variable::kAllVersions;
+}
+
 std::unique_ptr<PlanNodeDescription> DataJoin::explain() const {
     auto desc = SingleDependencyNode::explain();
     folly::dynamic inputVar = folly::dynamic::object();
@@ -262,9 +298,42 @@ std::unique_ptr<PlanNodeDescription> DataJoin::explain() const {
     addDescription("inputVar", folly::toJson(inputVar), desc.get());
     addDescription("hashKeys", folly::toJson(util::toJson(hashKeys_)), desc.get());
     addDescription("probeKeys", folly::toJson(util::toJson(probeKeys_)), desc.get());
+    switch (joinKind_) {
+        case JoinKind::kInner: {
+            addDescription("kind", "INNER", desc.get());
+            break;
+        }
+        case JoinKind::kLeft: {
+            addDescription("kind", "LEFT", desc.get());
+            break;
+        }
+        case JoinKind::kSemi: {
+            addDescription("kind", "SEMI", desc.get());
+            break;
+        }
+        case JoinKind::kAnti: {
+            addDescription("kind", "ANTI", desc.get());
+            break;
+        }
+    }
     return desc;
 }
 
+size_t DataJoin::numVersionsToRead(const std::string& var) const {
+    size_t numVersions = 1;
+    for (const auto* side : {&leftVar_, &rightVar_}) {
+        if (side->first != var) {
+            continue;
+        }
+        // The positive versions count from the oldest one
+        if (side->second > 0) {
+            return Variable::kAllVersions;
+        }
+        numVersions = std::max(numVersions, static_cast<size_t>(1 - side->second));
+    }
+    return numVersions;
+}
+
 std::unique_ptr<PlanNodeDescription> Assign::explain() const {
     auto desc = SingleDependencyNode::explain();
     for (size_t i = 0; i < items_.size(); ++i) {
@@ -109,7 +109,7 @@ protected:
 /**
  * Get neighbors' property
  */
-class GetNeighbors final : public Explore {
+class GetNeighbors : public Explore {
 public:
     using VertexProps = std::unique_ptr<std::vector<storage::cpp2::VertexProp>>;
     using EdgeProps = std::unique_ptr<std::vector<storage::cpp2::EdgeProp>>;
@@ -187,6 +187,20 @@ public:
         return random_;
     }
 
+    // The max edges expanded from each vertex of the step, by the step variable of the loop
+    // if any, empty if unlimited
+    const std::vector<int64_t>& vertexLimits() const {
+        return vertexLimits_;
+    }
+
+    bool sample() const {
+        return sample_;
+    }
+
+    const std::string& stepVar() const {
+        return stepVar_;
+    }
+
     void setSrc(Expression* src) {
         src_ = src;
     }
@@ -219,12 +233,22 @@ public:
         random_ = random;
     }
 
-private:
-    GetNeighbors(QueryContext* qctx, PlanNode* input, GraphSpaceID space)
-        : Explore(qctx, Kind::kGetNeighbors, input, space) {
+    void setVertexLimits(std::vector<int64_t> limits, bool sample, std::string stepVar = "") {
+        vertexLimits_ = std::move(limits);
+        sample_ = sample;
+        stepVar_ = std::move(stepVar);
+    }
+
+protected:
+    GetNeighbors(QueryContext* qctx, Kind kind, PlanNode* input, GraphSpaceID space)
+        : Explore(qctx, kind, input, space) {
         setLimit(-1);
     }
 
+private:
+    GetNeighbors(QueryContext* qctx, PlanNode* input, GraphSpaceID space)
+        : GetNeighbors(qctx, Kind::kGetNeighbors, input, space) {}
+
 private:
     void clone(const GetNeighbors& g);
 
@@ -236,6 +260,64 @@ private:
     StatProps                                    statProps_;
     Exprs                                        exprs_;
     bool                                         random_{false};
+    std::vector<int64_t>                         vertexLimits_;
+    bool                                         sample_{false};
+    std::string                                  stepVar_;
+};
+
+/**
+ * Expand the paths from the src vids step by step, by getting the neighbors of the ends of
+ * the paths of the last step, and output the paths of the steps in [minSteps, maxSteps].
+ * The paths passing an edge twice are not expanded.
+ */
+class Traverse final : public GetNeighbors {
+public:
+    static Traverse* make(QueryContext* qctx, PlanNode* input, GraphSpaceID space) {
+        return qctx->objPool()->add(new Traverse(qctx, input, space));
+    }
+
+    std::unique_ptr<PlanNodeDescription> explain() const override;
+
+    int64_t minSteps() const {
+        return minSteps_;
+    }
+
+    int64_t maxSteps() const {
+        return maxSteps_;
+    }
+
+    // The filter of the vertices expanded from at the first step
+    Expression* vertexFilter() const {
+        return vertexFilter_;
+    }
+
+    // The filter of the edges of all the steps
+    Expression* edgeFilter() const {
+        return edgeFilter_;
+    }
+
+    void setSteps(int64_t minSteps, int64_t maxSteps) {
+        minSteps_ = minSteps;
+        maxSteps_ = maxSteps;
+    }
+
+    void setVertexFilter(Expression* filter) {
+        vertexFilter_ = filter;
+    }
+
+    void setEdgeFilter(Expression* filter) {
+        edgeFilter_ = filter;
+    }
+
+private:
+    Traverse(QueryContext* qctx, PlanNode* input, GraphSpaceID space)
+        : GetNeighbors(qctx, Kind::kTraverse, input, space) {}
+
+private:
+    int64_t                                      minSteps_{1};
+    int64_t                                      maxSteps_{1};
+    Expression*                                  vertexFilter_{nullptr};
+    Expression*                                  edgeFilter_{nullptr};
 };
 
 /**
@@ -884,6 +966,8 @@ public:
         kBFSShortest,
         kAllPaths,
         kMultiplePairShortest,
+        // The count of the rows collected by kMToN, as COUNT(*) over them
+        kMToNCount,
     };
 
     static DataCollect* make(QueryContext* qctx,
@@ -922,6 +1006,8 @@ public:
         return distinct_;
     }
 
+    size_t numVersionsToRead(const std::string& var) const override;
+
     std::unique_ptr<PlanNodeDescription> explain() const override;
 
 private:
@@ -948,10 +1034,19 @@ private:
 };
 
 /**
- * An implementation of inner join which join two given variable.
+ * An implementation of hash join which join two given variable.
  */
 class DataJoin final : public SingleDependencyNode {
 public:
+    enum class JoinKind : uint8_t {
+        kInner,
+        // Keep all the rows of the left, and pad the rows not matched with NULLs
+        kLeft,
+        // Keep the rows of the left matched by the right, or not matched by the right
+        kSemi,
+        kAnti,
+    };
+
     static DataJoin* make(QueryContext* qctx,
                           PlanNode* input,
                           std::pair<std::string, int64_t> leftVar,
@@ -982,6 +1077,16 @@ public:
         return probeKeys_;
     }
 
+    JoinKind joinKind() const {
+        return joinKind_;
+    }
+
+    void setJoinKind(JoinKind joinKind) {
+        joinKind_ = joinKind;
+    }
+
+    size_t numVersionsToRead(const std::string& var) const override;
+
     std::unique_ptr<PlanNodeDescription> explain() const override;
 
 private:
@@ -1015,6 +1120,7 @@ private:
     std::pair<std::string, int64_t>         rightVar_;
     std::vector<Expression*>                hashKeys_;
     std::vector<Expression*>                probeKeys_;
+    JoinKind                                joinKind_{JoinKind::kInner};
 };
 
 /*
@@ -1055,6 +1161,12 @@ public:
     static UnionAllVersionVar* make(QueryContext* qctx, PlanNode* input) {
         return qctx->objPool()->add(new UnionAllVersionVar(qctx, input));
     }
+
+    size_t numVersionsToRead(const std::string& var) const override {
+        UNUSED(var);
+        return Variable::kAllVersions;
+    }
+
 private:
     UnionAllVersionVar(QueryContext* qctx, PlanNode* input)
         : SingleInputNode(qctx, Kind::kUnionAllVersionVar, input) {}
@@ -0,0 +1,92 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "planner/match/EdgeIndexSeek.h"
+
+#include "planner/Query.h"
+#include "util/ExpressionUtils.h"
+
+namespace nebula {
+namespace graph {
+
+// static
+bool EdgeIndexSeek::canSeek(const EdgeInfo& edge) {
+    return edge.range == nullptr && edge.edgeTypes.size() == 1 && edge.types.size() == 1 &&
+           edge.direction != MatchEdge::Direction::BOTH;
+}
+
+// static
+StatusOr<std::vector<std::shared_ptr<meta::cpp2::IndexItem>>> EdgeIndexSeek::edgeIndexes(
+    const EdgeContext* edgeCtx) {
+    auto* matchClauseCtx = edgeCtx->matchClauseCtx;
+    auto result = matchClauseCtx->qctx->indexMng()->getEdgeIndexes(matchClauseCtx->space.id);
+    NG_RETURN_IF_ERROR(result);
+    auto edgeType = edgeCtx->info->edgeTypes.back();
+    std::vector<std::shared_ptr<meta::cpp2::IndexItem>> indexes;
+    for (auto& index : result.value()) {
+        if (index->get_schema_id().get_edge_type() == edgeType) {
+            indexes.emplace_back(index);
+        }
+    }
+    return indexes;
+}
+
+// static
+bool EdgeIndexSeek::indexedBy(const EdgeContext* edgeCtx, const Expression* filter) {
+    auto indexes = edgeIndexes(edgeCtx);
+    if (!indexes.ok()) {
+        return false;
+    }
+    std::unordered_set<std::string> props;
+    for (auto* expr : ExpressionUtils::collectAll(filter, {Expression::Kind::kEdgeProperty})) {
+        props.emplace(*static_cast<const EdgePropertyExpression*>(expr)->prop());
+    }
+    for (auto& index : indexes.value()) {
+        const auto& fields = index->get_fields();
+        if (!fields.empty() && props.count(fields.front().get_name()) == 1) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// static
+SubPlan EdgeIndexSeek::makeScan(EdgeContext* edgeCtx) {
+    SubPlan plan;
+    auto* matchClauseCtx = edgeCtx->matchClauseCtx;
+    auto& scanInfo = edgeCtx->scanInfo;
+    using IQC = nebula::storage::cpp2::IndexQueryContext;
+    IQC iqctx;
+    if (scanInfo.filter != nullptr) {
+        iqctx.set_filter(Expression::encode(*scanInfo.filter));
+    } else {
+        DCHECK_EQ(scanInfo.indexIds.size(), 1);
+        iqctx.set_index_id(scanInfo.indexIds.back());
+    }
+    auto contexts = std::make_unique<std::vector<IQC>>();
+    contexts->emplace_back(std::move(iqctx));
+    auto columns = std::make_unique<std::vector<std::string>>();
+    columns->emplace_back(kSrc);
+    columns->emplace_back(kDst);
+    auto scan = IndexScan::make(matchClauseCtx->qctx,
+                                nullptr,
+                                matchClauseCtx->space.id,
+                                std::move(contexts),
+                                std::move(columns),
+                                true,
+                                scanInfo.schemaIds.back());
+    scan->setColNames({kSrc, kDst});
+    plan.tail = scan;
+    plan.root = scan;
+
+    // The node on the left is the src of the out edge, and the dst of the in edge
+    auto* vidCol = edgeCtx->info->direction == MatchEdge::Direction::OUT_EDGE ? kSrc : kDst;
+    edgeCtx->initialExpr.reset(ExpressionUtils::newVarPropExpr(vidCol));
+    return plan;
+}
+
+}  // namespace graph
+}  // namespace nebula
@@ -7,13 +7,35 @@
 #ifndef PLANNER_MATCH_EDGEINDEXSCAN_H_
 #define PLANNER_MATCH_EDGEINDEXSCAN_H_
 
+#include "context/ast/QueryAstContext.h"
+#include "planner/Planner.h"
+
 namespace nebula {
 namespace graph {
 /*
  * The EdgeIndexSeek was designed to find if could get the starting vids by edge index.
+ * The edges scanned give the vids of the node on the left of the edge, from which the
+ * pattern expands to both sides as if starting from that node. It's shared by the
+ * LabelIndexSeek and the PropIndexSeek to seek the edges of a type or by their properties.
  */
 class EdgeIndexSeek final {
+public:
+    EdgeIndexSeek() = delete;
+
+    // Only the one step edge of one type could be sought, the edges of a variable length
+    // pattern could be reached by any step. The edges of both directions are not supported yet.
+    static bool canSeek(const EdgeInfo& edge);
+
+    // The indexes on the edge type
+    static StatusOr<std::vector<std::shared_ptr<meta::cpp2::IndexItem>>> edgeIndexes(
+        const EdgeContext* edgeCtx);
+
+    // Whether the filter compares the first field of any index on the edge type
+    static bool indexedBy(const EdgeContext* edgeCtx, const Expression* filter);
+
+    // Scan the edges by the filter of the scan info, or all the edges by its index if no filter
+    static SubPlan makeScan(EdgeContext* edgeCtx);
 };
-}
+}  // namespace graph
 }  // namespace nebula
 #endif  // PLANNER_MATCH_EDGEINDEXSCAN_H_
@@ -6,6 +6,7 @@
 
 #include "planner/match/Expand.h"
 
+#include "planner/Algo.h"
 #include "planner/Logic.h"
 #include "planner/Query.h"
 #include "planner/match/MatchSolver.h"
@@ -25,7 +26,8 @@ static std::unique_ptr<std::vector<VertexProp>> genVertexProps() {
     return std::make_unique<std::vector<VertexProp>>();
 }
 
-std::unique_ptr<std::vector<storage::cpp2::EdgeProp>> Expand::genEdgeProps(const EdgeInfo &edge) {
+std::unique_ptr<std::vector<storage::cpp2::EdgeProp>> Expand::genEdgeProps(const EdgeInfo &edge,
+                                                                           bool withProps) {
     auto edgeProps = std::make_unique<std::vector<EdgeProp>>();
     for (auto edgeType : edge.edgeTypes) {
         auto edgeSchema = matchCtx_->qctx->schemaMng()->getEdgeSchema(
@@ -48,7 +50,7 @@ std::unique_ptr<std::vector<storage::cpp2::EdgeProp>> Expand::genEdgeProps(const
                 EdgeProp edgeProp;
                 edgeProp.set_type(-edgeType);
                 std::vector<std::string> props{kSrc, kType, kRank, kDst};
-                for (std::size_t i = 0; i < edgeSchema->getNumFields(); ++i) {
+                for (std::size_t i = 0; withProps && i < edgeSchema->getNumFields(); ++i) {
                     props.emplace_back(edgeSchema->getFieldName(i));
                 }
                 edgeProp.set_props(std::move(props));
@@ -59,7 +61,7 @@ std::unique_ptr<std::vector<storage::cpp2::EdgeProp>> Expand::genEdgeProps(const
         EdgeProp edgeProp;
         edgeProp.set_type(edgeType);
         std::vector<std::string> props{kSrc, kType, kRank, kDst};
-        for (std::size_t i = 0; i < edgeSchema->getNumFields(); ++i) {
+        for (std::size_t i = 0; withProps && i < edgeSchema->getNumFields(); ++i) {
             props.emplace_back(edgeSchema->getFieldName(i));
         }
         edgeProp.set_props(std::move(props));
@@ -85,6 +87,11 @@ static Expression* buildPathExpr() {
 Status Expand::doExpand(const NodeInfo& node,
                         const EdgeInfo& edge,
                         SubPlan* plan) {
+    // The paths of the steps in the range are expanded and output by the Traverse, except
+    // the zero step which fetches the vertices
+    if (edge.range != nullptr && edge.range->min() > 0 && edge.range->max() > 1) {
+        return traverse(node, edge, plan);
+    }
     NG_RETURN_IF_ERROR(expandSteps(node, edge, plan));
     NG_RETURN_IF_ERROR(filterDatasetByPathLength(edge, plan->root, plan));
     return Status::OK();
@@ -163,12 +170,75 @@ Status Expand::expandSteps(const NodeInfo& node,
     return Status::OK();
 }
 
-// Build subplan: Project->Dedup->GetNeighbors->[Filter]->Project
-Status Expand::expandStep(const EdgeInfo& edge,
-                          PlanNode* dep,
-                          const std::string& inputVar,
-                          const Expression* nodeFilter,
-                          SubPlan* plan) {
+// Build subplan: Project->Dedup->Traverse
+Status Expand::traverse(const NodeInfo& node, const EdgeInfo& edge, SubPlan* plan) {
+    auto qctx = matchCtx_->qctx;
+    SubPlan curr;
+    curr.root = dependency_;
+    MatchSolver::extractAndDedupVidColumn(
+        qctx, initialExpr_.release(), dependency_, inputVar_, curr);
+    // [Traverse]
+    auto traverse = Traverse::make(qctx, curr.root, matchCtx_->space.id);
+    auto srcExpr = ExpressionUtils::inputPropExpr(kVid);
+    traverse->setSrc(qctx->objPool()->add(srcExpr.release()));
+    traverse->setVertexProps(genVertexProps());
+    traverse->setEdgeProps(genEdgeProps(edge));
+    traverse->setEdgeDirection(edge.direction);
+    traverse->setSteps(edge.range->min(), edge.range->max());
+    if (node.filter != nullptr) {
+        traverse->setVertexFilter(rewriteVertexFilter(node.filter));
+    }
+    if (edge.filter != nullptr) {
+        traverse->setEdgeFilter(rewriteEdgeFilter(edge.filter));
+    }
+    traverse->setColNames({kPathStr});
+
+    plan->root = traverse;
+    return Status::OK();
+}
+
+Expression* Expand::rewriteVertexFilter(const Expression* filter) const {
+    auto rewritten = saveObject(filter->clone().release());
+    RewriteMatchLabelVisitor visitor(
+        [](const Expression* expr) -> Expression *{
+        DCHECK(expr->kind() == Expression::Kind::kLabelAttribute ||
+            expr->kind() == Expression::Kind::kLabel);
+        // filter prop
+        if (expr->kind() == Expression::Kind::kLabelAttribute) {
+            auto la = static_cast<const LabelAttributeExpression*>(expr);
+            return new AttributeExpression(
+                new VertexExpression(), la->right()->clone().release());
+        }
+        // filter tag
+        return new VertexExpression();
+    });
+    rewritten->accept(&visitor);
+    return rewritten;
+}
+
+Expression* Expand::rewriteEdgeFilter(const Expression* filter) const {
+    RewriteMatchLabelVisitor visitor([](const Expression* expr) {
+        DCHECK_EQ(expr->kind(), Expression::Kind::kLabelAttribute);
+        auto la = static_cast<const LabelAttributeExpression*>(expr);
+        return new AttributeExpression(new EdgeExpression(), la->right()->clone().release());
+    });
+    auto rewritten = saveObject(filter->clone().release());
+    rewritten->accept(&visitor);
+    return rewritten;
+}
+
+Status Expand::doGetNeighbors(const EdgeInfo& edge, SubPlan* plan) {
+    SubPlan subplan;
+    plan->root = getNeighbors(edge, dependency_, inputVar_, false, &subplan);
+    return Status::OK();
+}
+
+// Build subplan: Project->Dedup->GetNeighbors
+GetNeighbors* Expand::getNeighbors(const EdgeInfo& edge,
+                                   PlanNode* dep,
+                                   const std::string& inputVar,
+                                   bool withProps,
+                                   SubPlan* plan) {
     auto qctx = matchCtx_->qctx;
 
     // Extract dst vid from input project node which output dataset format is: [v1,e1,...,vn,en]
@@ -180,41 +250,47 @@ Status Expand::expandStep(const EdgeInfo& edge,
     auto srcExpr = ExpressionUtils::inputPropExpr(kVid);
     gn->setSrc(qctx->objPool()->add(srcExpr.release()));
     gn->setVertexProps(genVertexProps());
-    gn->setEdgeProps(genEdgeProps(edge));
+    gn->setEdgeProps(genEdgeProps(edge, withProps));
     gn->setEdgeDirection(edge.direction);
 
+    plan->root = gn;
+    plan->tail = curr.tail;
+    return gn;
+}
+
+// Build subplan: Project->Dedup->GetNeighbors->[IntersectNeighbors]->[Filter]->Project
+Status Expand::expandStep(const EdgeInfo& edge,
+                          PlanNode* dep,
+                          const std::string& inputVar,
+                          const Expression* nodeFilter,
+                          SubPlan* plan) {
+    auto qctx = matchCtx_->qctx;
+    SubPlan curr;
+    auto gn = getNeighbors(edge, dep, inputVar, true, &curr);
+
     PlanNode* root = gn;
+    // [IntersectNeighbors] only the first step
+    if (!bindingsVar_.empty()) {
+        auto intersect = IntersectNeighbors::make(qctx,
+                                                  root,
+                                                  gn->outputVar(),
+                                                  bindingsVar_,
+                                                  srcVid_,
+                                                  {boundVid_},
+                                                  {neighborsVar_});
+        intersect->setColNames(root->colNames());
+        root = intersect;
+        bindingsVar_.clear();
+    }
     // [Filter]
     if (nodeFilter != nullptr) {
-        auto filter = qctx->objPool()->add(nodeFilter->clone().release());
-        RewriteMatchLabelVisitor visitor(
-            [](const Expression* expr) -> Expression *{
-            DCHECK(expr->kind() == Expression::Kind::kLabelAttribute ||
-                expr->kind() == Expression::Kind::kLabel);
-            // filter prop
-            if (expr->kind() == Expression::Kind::kLabelAttribute) {
-                auto la = static_cast<const LabelAttributeExpression*>(expr);
-                return new AttributeExpression(
-                    new VertexExpression(), la->right()->clone().release());
-            }
-            // filter tag
-            return new VertexExpression();
-        });
-        filter->accept(&visitor);
-        auto filterNode = Filter::make(matchCtx_->qctx, root, filter);
+        auto filterNode = Filter::make(matchCtx_->qctx, root, rewriteVertexFilter(nodeFilter));
         filterNode->setColNames(root->colNames());
         root = filterNode;
     }
 
     if (edge.filter != nullptr) {
-        RewriteMatchLabelVisitor visitor([](const Expression* expr) {
-            DCHECK_EQ(expr->kind(), Expression::Kind::kLabelAttribute);
-            auto la = static_cast<const LabelAttributeExpression*>(expr);
-            return new AttributeExpression(new EdgeExpression(), la->right()->clone().release());
-        });
-        auto filter = saveObject(edge.filter->clone().release());
-        filter->accept(&visitor);
-        auto filterNode = Filter::make(qctx, root, filter);
+        auto filterNode = Filter::make(qctx, root, rewriteEdgeFilter(edge.filter));
         filterNode->setColNames(root->colNames());
         root = filterNode;
     }
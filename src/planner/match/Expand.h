@@ -11,6 +11,7 @@
 #include "context/ast/QueryAstContext.h"
 #include "planner/PlanNode.h"
 #include "planner/Planner.h"
+#include "planner/Query.h"
 
 namespace nebula {
 namespace graph {
@@ -37,15 +38,43 @@ public:
         return this;
     }
 
+    // Keep only the edges of the first step whose other ends are also neighbors of the
+    // vertices bound with their sources in the rows of `bindingsVar', see IntersectNeighbors.
+    Expand* intersect(const std::string& bindingsVar,
+                      Expression* srcVid,
+                      Expression* boundVid,
+                      const std::string& neighborsVar) {
+        bindingsVar_ = bindingsVar;
+        srcVid_ = srcVid;
+        boundVid_ = boundVid;
+        neighborsVar_ = neighborsVar;
+        return this;
+    }
+
     Status doExpand(const NodeInfo& node,
                     const EdgeInfo& edge,
                     SubPlan* plan);
 
+    // Build subplan: Project->Dedup->GetNeighbors, the edges without their props
+    Status doGetNeighbors(const EdgeInfo& edge, SubPlan* plan);
+
 private:
     Status expandSteps(const NodeInfo& node,
                        const EdgeInfo& edge,
                        SubPlan* plan);
 
+    Status traverse(const NodeInfo& node, const EdgeInfo& edge, SubPlan* plan);
+
+    // Rewrite the labels of the filter to the vertex or the edge of the GetNeighbors
+    Expression* rewriteVertexFilter(const Expression* filter) const;
+    Expression* rewriteEdgeFilter(const Expression* filter) const;
+
+    GetNeighbors* getNeighbors(const EdgeInfo& edge,
+                               PlanNode* dep,
+                               const std::string& inputVar,
+                               bool withProps,
+                               SubPlan* plan);
+
     Status expandStep(const EdgeInfo& edge,
                       PlanNode* dep,
                       const std::string& inputVar,
@@ -68,13 +97,18 @@ private:
         return matchCtx_->qctx->objPool()->add(obj);
     }
 
-    std::unique_ptr<std::vector<storage::cpp2::EdgeProp>> genEdgeProps(const EdgeInfo &edge);
+    std::unique_ptr<std::vector<storage::cpp2::EdgeProp>> genEdgeProps(const EdgeInfo &edge,
+                                                                       bool withProps = true);
 
     MatchClauseContext*                 matchCtx_;
     std::unique_ptr<Expression>         initialExpr_;
     bool                                reversely_{false};
     PlanNode*                           dependency_{nullptr};
     std::string                         inputVar_;
+    std::string                         bindingsVar_;
+    Expression*                         srcVid_{nullptr};
+    Expression*                         boundVid_{nullptr};
+    std::string                         neighborsVar_;
 };
 }   // namespace graph
 }   // namespace nebula
@@ -38,8 +38,9 @@ PlanNode* InnerJoinStrategy::joinDataSet(const PlanNode* left, const PlanNode* r
 
     qctx_->objPool()->add(buildExpr);
     qctx_->objPool()->add(probeExpr);
+    auto* dep = dependency_ == nullptr ? right : dependency_;
     auto join = DataJoin::make(qctx_,
-                               const_cast<PlanNode*>(right),
+                               const_cast<PlanNode*>(dep),
                                {left->outputVar(), 0},
                                {right->outputVar(), 0},
                                {buildExpr},
@@ -34,13 +34,20 @@ public:
         return this;
     }
 
+    // The plan node the join depends on, the right segment by default
+    InnerJoinStrategy* dependency(const PlanNode* dep) {
+        dependency_ = dep;
+        return this;
+    }
+
     PlanNode* connect(const PlanNode* left, const PlanNode* right) override;
 
 private:
     PlanNode* joinDataSet(const PlanNode* left, const PlanNode* right);
 
-    JoinPos     leftPos_{JoinPos::kEnd};
-    JoinPos     rightPos_{JoinPos::kStart};
+    JoinPos                 leftPos_{JoinPos::kEnd};
+    JoinPos                 rightPos_{JoinPos::kStart};
+    const PlanNode*         dependency_{nullptr};
 };
 }  // namespace graph
 }  // namespace nebula
@@ -6,6 +6,7 @@
 
 #include "planner/match/LabelIndexSeek.h"
 #include "planner/Query.h"
+#include "planner/match/EdgeIndexSeek.h"
 #include "planner/match/MatchSolver.h"
 #include "util/ExpressionUtils.h"
 
@@ -33,9 +34,25 @@ bool LabelIndexSeek::matchNode(NodeContext* nodeCtx) {
     return true;
 }
 
-bool LabelIndexSeek::matchEdge(EdgeContext*) {
-    // TODO
-    return false;
+bool LabelIndexSeek::matchEdge(EdgeContext* edgeCtx) {
+    auto& edge = *edgeCtx->info;
+    if (!EdgeIndexSeek::canSeek(edge)) {
+        return false;
+    }
+
+    auto indexesResult = EdgeIndexSeek::edgeIndexes(edgeCtx);
+    if (!indexesResult.ok() || indexesResult.value().empty()) {
+        return false;
+    }
+    std::shared_ptr<meta::cpp2::IndexItem> candidateIndex{nullptr};
+    for (const auto& index : indexesResult.value()) {
+        candidateIndex = candidateIndex == nullptr ? index : selectIndex(candidateIndex, index);
+    }
+
+    edgeCtx->scanInfo.schemaIds = edge.edgeTypes;
+    edgeCtx->scanInfo.schemaNames = {&edge.types.back()};
+    edgeCtx->scanInfo.indexIds = {candidateIndex->get_index_id()};
+    return true;
 }
 
 StatusOr<SubPlan> LabelIndexSeek::transformNode(NodeContext* nodeCtx) {
@@ -65,9 +82,8 @@ StatusOr<SubPlan> LabelIndexSeek::transformNode(NodeContext* nodeCtx) {
     return plan;
 }
 
-StatusOr<SubPlan> LabelIndexSeek::transformEdge(EdgeContext*) {
-    // TODO
-    return Status::Error("TODO");
+StatusOr<SubPlan> LabelIndexSeek::transformEdge(EdgeContext* edgeCtx) {
+    return EdgeIndexSeek::makeScan(edgeCtx);
 }
 
 /*static*/ StatusOr<std::vector<IndexID>> LabelIndexSeek::pickTagIndex(const NodeContext* nodeCtx) {
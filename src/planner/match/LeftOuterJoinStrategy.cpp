@@ -0,0 +1,53 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "planner/match/LeftOuterJoinStrategy.h"
+
+#include "planner/Query.h"
+#include "util/ExpressionUtils.h"
+#include "planner/match/MatchSolver.h"
+
+namespace nebula {
+namespace graph {
+PlanNode* LeftOuterJoinStrategy::connect(const PlanNode* left, const PlanNode* right) {
+    return joinDataSet(left, right);
+}
+
+PlanNode* LeftOuterJoinStrategy::joinDataSet(const PlanNode* left, const PlanNode* right) {
+    DCHECK(!colName_.empty());
+    auto* buildExpr = qctx_->objPool()->add(MatchSolver::getVidOfVertex(colName_));
+    auto* probeExpr = qctx_->objPool()->add(MatchSolver::getVidOfVertex(colName_));
+    auto join = DataJoin::make(qctx_,
+                               const_cast<PlanNode*>(right),
+                               {left->outputVar(), 0},
+                               {right->outputVar(), 0},
+                               {buildExpr},
+                               {probeExpr});
+    join->setJoinKind(DataJoin::JoinKind::kLeft);
+    std::vector<std::string> colNames = left->colNames();
+    const auto& rightColNames = right->colNamesRef();
+    colNames.insert(colNames.end(), rightColNames.begin(), rightColNames.end());
+    join->setColNames(std::move(colNames));
+
+    // The columns of the right named as the left are dropped, the column joined on is the same
+    // of both sides and the left one is never NULL.
+    auto* columns = qctx_->objPool()->add(new YieldColumns);
+    std::vector<std::string> projectColNames;
+    for (auto& colName : join->colNamesRef()) {
+        if (std::find(projectColNames.begin(), projectColNames.end(), colName) !=
+            projectColNames.end()) {
+            continue;
+        }
+        columns->addColumn(new YieldColumn(ExpressionUtils::inputPropExpr(colName).release(),
+                                           new std::string(colName)));
+        projectColNames.emplace_back(colName);
+    }
+    auto* project = Project::make(qctx_, join, columns);
+    project->setColNames(std::move(projectColNames));
+    return project;
+}
+}  // namespace graph
+}  // namespace nebula
@@ -6,13 +6,32 @@
 
 #ifndef PLANNER_MATCH_LEFTOUTERJOINSTRATEGY_H_
 #define PLANNER_MATCH_LEFTOUTERJOINSTRATEGY_H_
+
+#include "planner/PlanNode.h"
+#include "planner/match/SegmentsConnectStrategy.h"
+
 namespace nebula {
 namespace graph {
 /*
  * The LeftOuterJoinStrategy was designed to connect two expand part by left outer join
  * in optional match situation.
  */
-class LeftOuterJoinStrategy final {
+class LeftOuterJoinStrategy final : public SegmentsConnectStrategy {
+public:
+    explicit LeftOuterJoinStrategy(QueryContext* qctx) : SegmentsConnectStrategy(qctx) {}
+
+    // The column of the vertex both parts join on
+    LeftOuterJoinStrategy* joinOn(std::string colName) {
+        colName_ = std::move(colName);
+        return this;
+    }
+
+    PlanNode* connect(const PlanNode* left, const PlanNode* right) override;
+
+private:
+    PlanNode* joinDataSet(const PlanNode* left, const PlanNode* right);
+
+    std::string     colName_;
 };
 }  // namespace graph
 }  // namespace nebula
@@ -6,7 +6,10 @@
 
 #include "planner/match/MatchClausePlanner.h"
 
+#include <cmath>
+
 #include "context/ast/QueryAstContext.h"
+#include "optimizer/CostModel.h"
 #include "planner/Query.h"
 #include "planner/match/Expand.h"
 #include "planner/match/MatchSolver.h"
@@ -14,6 +17,7 @@
 #include "planner/match/StartVidFinder.h"
 #include "planner/match/WhereClausePlanner.h"
 #include "util/ExpressionUtils.h"
+#include "util/StatsCache.h"
 #include "visitor/RewriteMatchLabelVisitor.h"
 
 namespace nebula {
@@ -46,55 +50,143 @@ Status MatchClausePlanner::findStarts(MatchClauseContext* matchClauseCtx,
     auto& nodeInfos = matchClauseCtx->nodeInfos;
     auto& edgeInfos = matchClauseCtx->edgeInfos;
     auto& startVidFinders = StartVidFinder::finders();
-    bool foundStart = false;
-    // Find the start plan node
+    stats_ = StatsCache::instance().get(matchClauseCtx->qctx->getMetaClient(),
+                                        matchClauseCtx->space.id);
+    if (matchClauseCtx->isOptional) {
+        return findBoundStarts(matchClauseCtx, startIndex, matchClausePlan);
+    }
+    // Find the start plan node by the first finder matched, and among the nodes and edges
+    // matched by that finder, start from the one estimated to have the fewest rows.
     for (auto& finder : startVidFinders) {
-        for (size_t i = 0; i < nodeInfos.size() && !foundStart; ++i) {
-            auto nodeCtx = NodeContext(matchClauseCtx, &nodeInfos[i]);
+        std::unique_ptr<StartVidFinder> startFinder;
+        std::unique_ptr<NodeContext> startNode;
+        std::unique_ptr<EdgeContext> startEdge;
+        double minRows = 0.0;
+        for (size_t i = 0; i < nodeInfos.size(); ++i) {
+            auto nodeCtx = std::make_unique<NodeContext>(matchClauseCtx, &nodeInfos[i]);
             auto nodeFinder = finder();
-            if (nodeFinder->match(&nodeCtx)) {
-                auto plan = nodeFinder->transform(&nodeCtx);
-                if (!plan.ok()) {
-                    return plan.status();
+            if (nodeFinder->match(nodeCtx.get())) {
+                auto rows = estimateStartRows(stats_.get(), nodeInfos[i]);
+                if (startFinder == nullptr || rows < minRows) {
+                    startFinder = std::move(nodeFinder);
+                    startNode = std::move(nodeCtx);
+                    startEdge.reset();
+                    minRows = rows;
+                    startIndex = i;
                 }
-                matchClausePlan = std::move(plan).value();
-                startIndex = i;
-                foundStart = true;
-                initialExpr_ = nodeCtx.initialExpr->clone();
-                VLOG(1) << "Find starts: " << startIndex
-                    << " node: " << matchClausePlan.root->outputVar()
-                    << " colNames: " << folly::join(",", matchClausePlan.root->colNames());
-                break;
             }
 
             if (i != nodeInfos.size() - 1) {
-                auto edgeCtx = EdgeContext(matchClauseCtx, &edgeInfos[i]);
+                auto edgeCtx = std::make_unique<EdgeContext>(matchClauseCtx, &edgeInfos[i]);
                 auto edgeFinder = finder();
-                if (edgeFinder->match(&edgeCtx)) {
-                    auto plan = edgeFinder->transform(&edgeCtx);
-                    if (!plan.ok()) {
-                        return plan.status();
+                if (edgeFinder->match(edgeCtx.get())) {
+                    auto rows = estimateStartRows(stats_.get(), edgeInfos[i]);
+                    if (startFinder == nullptr || rows < minRows) {
+                        startFinder = std::move(edgeFinder);
+                        startEdge = std::move(edgeCtx);
+                        startNode.reset();
+                        minRows = rows;
+                        startIndex = i;
                     }
-                    matchClausePlan = std::move(plan).value();
-                    startFromEdge = true;
-                    startIndex = i;
-                    foundStart = true;
-                    break;
                 }
             }
         }
-        if (foundStart) {
-            break;
+        if (startFinder == nullptr) {
+            continue;
         }
-    }
-    if (!foundStart) {
-        return Status::Error("Can't solve the start vids from the sentence: %s",
-                             matchClauseCtx->sentence->toString().c_str());
+        startRows_ = minRows < std::numeric_limits<double>::max()
+                         ? minRows
+                         : opt::CostModel::kDefaultScanRows;
+
+        if (startEdge != nullptr) {
+            auto plan = startFinder->transform(startEdge.get());
+            if (!plan.ok()) {
+                return plan.status();
+            }
+            matchClausePlan = std::move(plan).value();
+            initialExpr_ = startEdge->initialExpr->clone();
+            startFromEdge = true;
+            VLOG(1) << "Find starts from edge: " << startIndex
+                << " node: " << matchClausePlan.root->outputVar()
+                << " colNames: " << folly::join(",", matchClausePlan.root->colNames());
+            return Status::OK();
+        }
+
+        auto plan = startFinder->transform(startNode.get());
+        if (!plan.ok()) {
+            return plan.status();
+        }
+        matchClausePlan = std::move(plan).value();
+        initialExpr_ = startNode->initialExpr->clone();
+        VLOG(1) << "Find starts: " << startIndex
+            << " node: " << matchClausePlan.root->outputVar()
+            << " colNames: " << folly::join(",", matchClausePlan.root->colNames());
+        return Status::OK();
     }
 
+    return Status::Error("Can't solve the start vids from the sentence: %s",
+                         matchClauseCtx->sentence->toString().c_str());
+}
+
+Status MatchClausePlanner::findBoundStarts(MatchClauseContext* matchClauseCtx,
+                                           size_t& startIndex,
+                                           SubPlan& matchClausePlan) {
+    auto& nodeInfos = matchClauseCtx->nodeInfos;
+    auto bound = std::find_if(nodeInfos.begin(), nodeInfos.end(), [](const auto& node) {
+        return node.bound;
+    });
+    if (bound == nodeInfos.end()) {
+        return Status::Error("The OPTIONAL MATCH is not bound by the previous clauses.");
+    }
+    startIndex = std::distance(nodeInfos.begin(), bound);
+
+    // The vids of the bound node are projected from the input, which is connected to the
+    // result of the previous clauses later.
+    auto* qctx = matchClauseCtx->qctx;
+    auto* columns = qctx->objPool()->add(new YieldColumns);
+    columns->addColumn(
+        new YieldColumn(MatchSolver::getVidOfVertex(*bound->alias), new std::string(kVid)));
+    auto* project = Project::make(qctx, nullptr, columns);
+    project->setColNames({kVid});
+    matchClausePlan.root = project;
+    matchClausePlan.tail = project;
+    initialExpr_ = std::make_unique<VariablePropertyExpression>(
+        new std::string(project->outputVar()), new std::string(kVid));
+    startRows_ = opt::CostModel::kDefaultScanRows;
+    VLOG(1) << "Find bound starts: " << startIndex << " node: " << project->outputVar();
     return Status::OK();
 }
 
+// static
+double MatchClausePlanner::estimateStartRows(const meta::cpp2::StatisItem* stats,
+                                             const NodeInfo& node) {
+    double rows = std::numeric_limits<double>::max();
+    for (auto* label : node.labels) {
+        auto count = StatsCache::tagCount(stats, *label);
+        if (count >= 0) {
+            rows = std::min(rows, static_cast<double>(count));
+        }
+    }
+    return rows;
+}
+
+// static
+double MatchClausePlanner::estimateStartRows(const meta::cpp2::StatisItem* stats,
+                                             const EdgeInfo& edge) {
+    if (edge.types.empty()) {
+        return std::numeric_limits<double>::max();
+    }
+    double rows = 0.0;
+    for (auto& type : edge.types) {
+        auto count = StatsCache::edgeCount(stats, type);
+        if (count < 0) {
+            return std::numeric_limits<double>::max();
+        }
+        rows += count;
+    }
+    return rows;
+}
+
 Status MatchClausePlanner::expand(const std::vector<NodeInfo>& nodeInfos,
                                   const std::vector<EdgeInfo>& edgeInfos,
                                   MatchClauseContext* matchClauseCtx,
@@ -150,8 +242,9 @@ Status MatchClausePlanner::leftExpandFromNode(const std::vector<NodeInfo>& nodeI
                                               SubPlan& subplan) {
     std::vector<std::string> joinColNames = {
         folly::stringPrintf("%s_%lu", kPathStr, nodeInfos.size())};
+    std::vector<PlanNode*> segments;
+    std::vector<SegmentsJoinOrder::Segment> estimates;
     for (size_t i = startIndex; i > 0; --i) {
-        auto left = subplan.root;
         auto status = std::make_unique<Expand>(matchClauseCtx,
                                                i == startIndex ? initialExpr_->clone() : nullptr)
                           ->depends(subplan.root)
@@ -162,19 +255,15 @@ Status MatchClausePlanner::leftExpandFromNode(const std::vector<NodeInfo>& nodeI
             return status;
         }
         if (i < startIndex) {
-            auto right = subplan.root;
-            VLOG(1) << "left: " << folly::join(",", left->colNames())
-                << " right: " << folly::join(",", right->colNames());
-            subplan.root = SegmentsConnector::innerJoinSegments(matchClauseCtx->qctx, left, right);
             joinColNames.emplace_back(
                 folly::stringPrintf("%s_%lu", kPathStr, nodeInfos.size() + i));
-            subplan.root->setColNames(joinColNames);
         }
+        segments.emplace_back(subplan.root);
+        estimateSegment(estimateFanout(stats_.get(), nodeInfos[i], edgeInfos[i - 1]), estimates);
         inputVar = subplan.root->outputVar();
     }
 
     VLOG(1) << "root: " << subplan.root->outputVar() << " tail: " << subplan.tail->outputVar();
-    auto left = subplan.root;
     NG_RETURN_IF_ERROR(MatchSolver::appendFetchVertexPlan(
         nodeInfos.front().filter,
         matchClauseCtx->space,
@@ -182,13 +271,14 @@ Status MatchClausePlanner::leftExpandFromNode(const std::vector<NodeInfo>& nodeI
         edgeInfos.empty() ? initialExpr_->clone().release() : nullptr,
         subplan));
     if (!edgeInfos.empty()) {
-        auto right = subplan.root;
-        VLOG(1) << "left: " << folly::join(",", left->colNames())
-                << " right: " << folly::join(",", right->colNames());
-        subplan.root = SegmentsConnector::innerJoinSegments(matchClauseCtx->qctx, left, right);
         joinColNames.emplace_back(
             folly::stringPrintf("%s_%lu", kPathStr, nodeInfos.size() + startIndex));
-        subplan.root->setColNames(joinColNames);
+        segments.emplace_back(subplan.root);
+        estimateSegment(estimateFanout(nodeInfos.front()), estimates);
+        subplan.root = SegmentsConnector::joinSegments(matchClauseCtx->qctx,
+                                                       segments,
+                                                       SegmentsJoinOrder(std::move(estimates)),
+                                                       joinColNames);
     }
 
     VLOG(1) << "root: " << subplan.root->outputVar() << " tail: " << subplan.tail->outputVar();
@@ -200,30 +290,60 @@ Status MatchClausePlanner::rightExpandFromNode(const std::vector<NodeInfo>& node
                                                MatchClauseContext* matchClauseCtx,
                                                size_t startIndex,
                                                SubPlan& subplan) {
+    auto qctx = matchClauseCtx->qctx;
     std::vector<std::string> joinColNames = {folly::stringPrintf("%s_%lu", kPathStr, startIndex)};
+    std::vector<PlanNode*> segments;
+    std::vector<SegmentsJoinOrder::Segment> estimates;
+    auto startVar = subplan.root->outputVar();
+    auto inputVar = startVar;
+    auto intersected = intersectedEdge(nodeInfos, edgeInfos, startIndex);
     for (size_t i = startIndex; i < edgeInfos.size(); ++i) {
-        auto left = subplan.root;
-        auto status =
-            std::make_unique<Expand>(matchClauseCtx,
-                                     i == startIndex ? initialExpr_->clone() : nullptr)
-                ->depends(subplan.root)
-                ->inputVar(subplan.root->outputVar())
-                ->doExpand(nodeInfos[i], edgeInfos[i], &subplan);
+        auto expand = std::make_unique<Expand>(matchClauseCtx,
+                                               i == startIndex ? initialExpr_->clone() : nullptr);
+        auto fanout = estimateFanout(stats_.get(), nodeInfos[i], edgeInfos[i]);
+        if (i == intersected) {
+            // [GetNeighbors] of the start through the closing edge, reversely
+            NG_RETURN_IF_ERROR(std::make_unique<Expand>(matchClauseCtx, initialExpr_->clone())
+                                   ->depends(subplan.root)
+                                   ->inputVar(startVar)
+                                   ->reversely()
+                                   ->doGetNeighbors(edgeInfos.back(), &subplan));
+            auto* pool = qctx->objPool();
+            if (i == startIndex) {
+                // The 2-cycle, the source is the start itself
+                expand->intersect(startVar,
+                                  pool->add(initialExpr_->clone().release()),
+                                  pool->add(initialExpr_->clone().release()),
+                                  subplan.root->outputVar());
+            } else {
+                // The triangle, the source is bound with the start by the first segment
+                expand->intersect(inputVar,
+                                  pool->add(MatchSolver::getEndVidInPath(kPathStr)),
+                                  pool->add(MatchSolver::getStartVidInPath(kPathStr)),
+                                  subplan.root->outputVar());
+            }
+            fanout *= opt::CostModel::kFilterSelectivity;
+        }
+        auto status = expand->depends(subplan.root)
+                          ->inputVar(inputVar)
+                          ->doExpand(nodeInfos[i], edgeInfos[i], &subplan);
         if (!status.ok()) {
             return status;
         }
         if (i > startIndex) {
-            auto right = subplan.root;
-            VLOG(1) << "left: " << folly::join(",", left->colNames())
-                << " right: " << folly::join(",", right->colNames());
-            subplan.root = SegmentsConnector::innerJoinSegments(matchClauseCtx->qctx, left, right);
             joinColNames.emplace_back(folly::stringPrintf("%s_%lu", kPathStr, i));
-            subplan.root->setColNames(joinColNames);
         }
+        segments.emplace_back(subplan.root);
+        estimateSegment(fanout, estimates);
+        inputVar = subplan.root->outputVar();
     }
 
     VLOG(1) << "root: " << subplan.root->outputVar() << " tail: " << subplan.tail->outputVar();
-    auto left = subplan.root;
+    if (segments.empty() && !edgeInfos.empty()) {
+        // Start from the last node, join its vertex with the starts
+        segments.emplace_back(subplan.root);
+        estimateSegment(1.0, estimates);
+    }
     NG_RETURN_IF_ERROR(MatchSolver::appendFetchVertexPlan(
         nodeInfos.back().filter,
         matchClauseCtx->space,
@@ -231,29 +351,93 @@ Status MatchClausePlanner::rightExpandFromNode(const std::vector<NodeInfo>& node
         edgeInfos.empty() ? initialExpr_->clone().release() : nullptr,
         subplan));
     if (!edgeInfos.empty()) {
-        auto right = subplan.root;
-        VLOG(1) << "left: " << folly::join(",", left->colNames())
-            << " right: " << folly::join(",", right->colNames());
-        subplan.root = SegmentsConnector::innerJoinSegments(matchClauseCtx->qctx, left, right);
         joinColNames.emplace_back(folly::stringPrintf("%s_%lu", kPathStr, edgeInfos.size()));
-        subplan.root->setColNames(joinColNames);
+        segments.emplace_back(subplan.root);
+        estimateSegment(estimateFanout(nodeInfos.back()), estimates);
+        subplan.root = SegmentsConnector::joinSegments(matchClauseCtx->qctx,
+                                                       segments,
+                                                       SegmentsJoinOrder(std::move(estimates)),
+                                                       joinColNames);
     }
 
     VLOG(1) << "root: " << subplan.root->outputVar() << " tail: " << subplan.tail->outputVar();
     return Status::OK();
 }
 
+// static
+size_t MatchClausePlanner::intersectedEdge(const std::vector<NodeInfo>& nodeInfos,
+                                           const std::vector<EdgeInfo>& edgeInfos,
+                                           size_t startIndex) {
+    auto size = edgeInfos.size();
+    if (startIndex != 0 || !nodeInfos.back().closing || size < 2 || size > 3) {
+        return size;
+    }
+    auto& edge = edgeInfos[size - 2];
+    auto& closingEdge = edgeInfos[size - 1];
+    if (edge.range != nullptr || closingEdge.range != nullptr) {
+        return size;
+    }
+    return size - 2;
+}
+
+// static
+double MatchClausePlanner::estimateFanout(const meta::cpp2::StatisItem* stats,
+                                          const NodeInfo& node,
+                                          const EdgeInfo& edge) {
+    double degree = 0.0;
+    for (auto& type : edge.types) {
+        auto count = StatsCache::edgeCount(stats, type);
+        degree += count >= 0 && stats->space_vertices > 0
+                      ? count / static_cast<double>(stats->space_vertices)
+                      : opt::CostModel::kDefaultDegree;
+    }
+    if (edge.types.empty()) {
+        degree = opt::CostModel::kDefaultDegree;
+    }
+    if (edge.direction == Direction::BOTH) {
+        degree *= 2;
+    }
+    if (edge.filter != nullptr) {
+        degree *= opt::CostModel::kFilterSelectivity;
+    }
+
+    // The paths of all the lengths in the range
+    double minHop = edge.range != nullptr ? edge.range->min() : 1;
+    double maxHop = edge.range != nullptr ? edge.range->max() : 1;
+    double fanout = degree == 1.0 ? maxHop - minHop + 1
+                                  : std::pow(degree, minHop) *
+                                        (std::pow(degree, maxHop - minHop + 1) - 1) /
+                                        (degree - 1);
+    return estimateFanout(node) * fanout;
+}
+
+// static
+double MatchClausePlanner::estimateFanout(const NodeInfo& node) {
+    return node.filter != nullptr ? opt::CostModel::kFilterSelectivity : 1.0;
+}
+
+void MatchClausePlanner::estimateSegment(double fanout,
+                                         std::vector<SegmentsJoinOrder::Segment>& segments) const {
+    // Expand from the starts, or from the distinct ends of the last segment
+    double inputRows = startRows_;
+    if (!segments.empty()) {
+        inputRows = segments.back().inputRows * segments.back().fanout;
+        if (stats_ != nullptr && stats_->space_vertices > 0) {
+            inputRows = std::min(inputRows, static_cast<double>(stats_->space_vertices));
+        }
+    }
+    segments.emplace_back(SegmentsJoinOrder::Segment{inputRows, fanout});
+}
+
 Status MatchClausePlanner::expandFromEdge(const std::vector<NodeInfo>& nodeInfos,
                                           const std::vector<EdgeInfo>& edgeInfos,
                                           MatchClauseContext* matchClauseCtx,
                                           size_t startIndex,
                                           SubPlan& subplan) {
-    UNUSED(nodeInfos);
-    UNUSED(edgeInfos);
-    UNUSED(matchClauseCtx);
-    UNUSED(startIndex);
-    UNUSED(subplan);
-    return Status::Error("Expand from edge has not been implemented yet.");
+    // The starts are the vids of the node on the left of the edge sought, so it expands to
+    // both sides from that node, and the edge is fetched again by the right expansion to filter
+    // the other properties and to build the path.
+    return expandFromNode(nodeInfos, edgeInfos, matchClauseCtx, startIndex, subplan);
 }
 
 Status MatchClausePlanner::projectColumnsBySymbols(MatchClauseContext* matchClauseCtx,
@@ -269,7 +453,7 @@ Status MatchClausePlanner::projectColumnsBySymbols(MatchClauseContext* matchClau
 
     auto addNode = [&, this](size_t i) {
         auto& nodeInfo = nodeInfos[i];
-        if (nodeInfo.alias != nullptr && !nodeInfo.anonymous) {
+        if (nodeInfo.alias != nullptr && !nodeInfo.anonymous && !nodeInfo.closing) {
             if (i >= startIndex) {
                 columns->addColumn(
                     buildVertexColumn(inColNames[i - startIndex], *nodeInfo.alias));
@@ -320,6 +504,9 @@ Status MatchClausePlanner::projectColumnsBySymbols(MatchClauseContext* matchClau
     project->setColNames(std::move(colNames));
 
     plan.root = MatchSolver::filtPathHasSameEdge(project, alias, qctx);
+    if (nodeInfos.back().closing) {
+        plan.root = MatchSolver::filtPathNotClosed(plan.root, alias, qctx);
+    }
     VLOG(1) << "root: " << plan.root->outputVar() << " tail: " << plan.tail->outputVar();
     return Status::OK();
 }
@@ -7,7 +7,9 @@
 #ifndef PLANNER_MATCH_MATCHCLAUSEPLANNER_H_
 #define PLANNER_MATCH_MATCHCLAUSEPLANNER_H_
 
+#include "common/interface/gen-cpp2/meta_types.h"
 #include "planner/match/CypherClausePlanner.h"
+#include "planner/match/SegmentsJoinOrder.h"
 
 namespace nebula {
 namespace graph {
@@ -26,6 +28,15 @@ private:
                       size_t& startIndex,
                       SubPlan& matchClausePlan);
 
+    // Start the OPTIONAL MATCH from the node bound by the previous clauses
+    Status findBoundStarts(MatchClauseContext* matchClauseCtx,
+                           size_t& startIndex,
+                           SubPlan& matchClausePlan);
+
+    // The estimated rows to start from by the space statistics, the unknown is the most
+    static double estimateStartRows(const meta::cpp2::StatisItem* stats, const NodeInfo& node);
+    static double estimateStartRows(const meta::cpp2::StatisItem* stats, const EdgeInfo& edge);
+
     Status expand(const std::vector<NodeInfo>& nodeInfos,
                   const std::vector<EdgeInfo>& edgeInfos,
                   MatchClauseContext* matchClauseCtx,
@@ -54,6 +65,23 @@ private:
                                size_t startIndex,
                                SubPlan& subplan);
 
+    // The edge of a triangle or of a 2-cycle from the start to expand by intersecting
+    // the neighbors with the ones of the start through the closing edge, or the count of
+    // the edges if the pattern is not such a cycle
+    static size_t intersectedEdge(const std::vector<NodeInfo>& nodeInfos,
+                                  const std::vector<EdgeInfo>& edgeInfos,
+                                  size_t startIndex);
+
+    // The rows expanded from each vertex through the edge, or kept by the filter of the
+    // vertices fetched at the end of the pattern
+    static double estimateFanout(const meta::cpp2::StatisItem* stats,
+                                 const NodeInfo& node,
+                                 const EdgeInfo& edge);
+    static double estimateFanout(const NodeInfo& node);
+
+    // Append the estimate of the segment following the last one
+    void estimateSegment(double fanout, std::vector<SegmentsJoinOrder::Segment>& segments) const;
+
     Status expandFromEdge(const std::vector<NodeInfo>& nodeInfos,
                           const std::vector<EdgeInfo>& edgeInfos,
                           MatchClauseContext* matchClauseCtx,
@@ -76,7 +104,10 @@ private:
     Status appendFilterPlan(MatchClauseContext* matchClauseCtx, SubPlan& subplan);
 
 private:
-    std::unique_ptr<Expression> initialExpr_;
+    std::unique_ptr<Expression>                         initialExpr_;
+    std::shared_ptr<const meta::cpp2::StatisItem>       stats_;
+    // The estimated rows of the starts, to order the joins of the segments
+    double                                              startRows_{0.0};
 };
 }  // namespace graph
 }  // namespace nebula
@@ -44,20 +44,26 @@ Expression* MatchSolver::doRewrite(const std::unordered_map<std::string, AliasTy
     return rewrite(labelExpr);
 }
 
+static Expression* makePropExpr(const std::string& label, const std::string& prop, bool isEdge) {
+    if (isEdge) {
+        return new EdgePropertyExpression(new std::string(label), new std::string(prop));
+    }
+    return new TagPropertyExpression(new std::string(label), new std::string(prop));
+}
+
 Expression* MatchSolver::makeIndexFilter(const std::string& label,
                                          const MapExpression* map,
-                                         QueryContext* qctx) {
+                                         QueryContext* qctx,
+                                         bool isEdge) {
     auto& items = map->items();
-    Expression* root = new RelationalExpression(
-        Expression::Kind::kRelEQ,
-        new TagPropertyExpression(new std::string(label), new std::string(*items[0].first)),
-        items[0].second->clone().release());
+    Expression* root = new RelationalExpression(Expression::Kind::kRelEQ,
+                                                makePropExpr(label, *items[0].first, isEdge),
+                                                items[0].second->clone().release());
     for (auto i = 1u; i < items.size(); i++) {
         auto* left = root;
-        auto* right = new RelationalExpression(
-            Expression::Kind::kRelEQ,
-            new TagPropertyExpression(new std::string(label), new std::string(*items[i].first)),
-            items[i].second->clone().release());
+        auto* right = new RelationalExpression(Expression::Kind::kRelEQ,
+                                               makePropExpr(label, *items[i].first, isEdge),
+                                               items[i].second->clone().release());
         root = new LogicalExpression(Expression::Kind::kLogicalAnd, left, right);
     }
     return qctx->objPool()->add(root);
@@ -66,7 +72,8 @@ Expression* MatchSolver::makeIndexFilter(const std::string& label,
 Expression* MatchSolver::makeIndexFilter(const std::string& label,
                                          const std::string& alias,
                                          Expression* filter,
-                                         QueryContext* qctx) {
+                                         QueryContext* qctx,
+                                         bool isEdge) {
     static const std::unordered_set<Expression::Kind> kinds = {
         Expression::Kind::kRelEQ,
         Expression::Kind::kRelLT,
@@ -117,8 +124,7 @@ Expression* MatchSolver::makeIndexFilter(const std::string& label,
         }
 
         const auto &value = la->right()->value();
-        auto *tpExpr = new TagPropertyExpression(new std::string(label),
-                                                 new std::string(value.getStr()));
+        auto *tpExpr = makePropExpr(label, value.getStr(), isEdge);
         auto *newConstant = constant->clone().release();
         if (left->kind() == Expression::Kind::kLabelAttribute) {
             auto* rel = new RelationalExpression(item->kind(), tpExpr, newConstant);
@@ -213,6 +219,12 @@ Expression* MatchSolver::getStartVidInPath(const std::string& colName) {
     return new AttributeExpression(firstVertexExpr.release(), new ConstantExpression(kVid));
 }
 
+Expression* MatchSolver::getVidOfVertex(const std::string& colName) {
+    // expr: v[_vid] => vid
+    auto columnExpr = ExpressionUtils::inputPropExpr(colName);
+    return new AttributeExpression(columnExpr.release(), new ConstantExpression(kVid));
+}
+
 PlanNode* MatchSolver::filtPathHasSameEdge(PlanNode* input,
                                            const std::string& column,
                                            QueryContext* qctx) {
@@ -228,6 +240,17 @@ PlanNode* MatchSolver::filtPathHasSameEdge(PlanNode* input,
     return filter;
 }
 
+PlanNode* MatchSolver::filtPathNotClosed(PlanNode* input,
+                                         const std::string& column,
+                                         QueryContext* qctx) {
+    auto cond = std::make_unique<RelationalExpression>(Expression::Kind::kRelEQ,
+                                                       getStartVidInPath(column),
+                                                       getEndVidInPath(column));
+    auto filter = Filter::make(qctx, input, qctx->objPool()->add(cond.release()));
+    filter->setColNames(input->colNames());
+    return filter;
+}
+
 Status MatchSolver::appendFetchVertexPlan(const Expression* nodeFilter,
                                           const SpaceInfo& space,
                                           QueryContext* qctx,
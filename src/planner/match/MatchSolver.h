@@ -33,14 +33,17 @@ public:
     static Expression* doRewrite(const std::unordered_map<std::string, AliasType>& aliases,
                                  const Expression* expr);
 
+    // The filters of the index scan on the properties of the tag, or the edge if `isEdge'
     static Expression* makeIndexFilter(const std::string& label,
                                        const MapExpression* map,
-                                       QueryContext* qctx);
+                                       QueryContext* qctx,
+                                       bool isEdge = false);
 
     static Expression* makeIndexFilter(const std::string& label,
                                        const std::string& alias,
                                        Expression* filter,
-                                       QueryContext* qctx);
+                                       QueryContext* qctx,
+                                       bool isEdge = false);
 
     static Status buildFilter(const MatchClauseContext* mctx, SubPlan* plan);
 
@@ -57,10 +60,18 @@ public:
 
     static Expression* getStartVidInPath(const std::string& colName);
 
+    // The vid of the vertex column
+    static Expression* getVidOfVertex(const std::string& colName);
+
     static PlanNode* filtPathHasSameEdge(PlanNode* input,
                                          const std::string& column,
                                          QueryContext* qctx);
 
+    // Keep the paths ending at their start vertices
+    static PlanNode* filtPathNotClosed(PlanNode* input,
+                                       const std::string& column,
+                                       QueryContext* qctx);
+
     static Status appendFetchVertexPlan(const Expression* nodeFilter,
                                         const SpaceInfo& space,
                                         QueryContext* qctx,
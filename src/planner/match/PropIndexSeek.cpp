@@ -7,19 +7,44 @@
 #include "planner/match/PropIndexSeek.h"
 
 #include "planner/Query.h"
+#include "planner/match/EdgeIndexSeek.h"
 #include "planner/match/MatchSolver.h"
 #include "util/ExpressionUtils.h"
 
 namespace nebula {
 namespace graph {
 bool PropIndexSeek::matchEdge(EdgeContext* edgeCtx) {
-    UNUSED(edgeCtx);
-    return false;
+    auto& edge = *edgeCtx->info;
+    if (!EdgeIndexSeek::canSeek(edge)) {
+        return false;
+    }
+
+    auto* matchClauseCtx = edgeCtx->matchClauseCtx;
+    const auto& type = edge.types.back();
+    Expression* filter = nullptr;
+    if (matchClauseCtx->where != nullptr && matchClauseCtx->where->filter != nullptr) {
+        filter = MatchSolver::makeIndexFilter(
+            type, *edge.alias, matchClauseCtx->where->filter.get(), matchClauseCtx->qctx, true);
+    }
+    if (filter == nullptr && edge.props != nullptr && !edge.props->items().empty()) {
+        filter = MatchSolver::makeIndexFilter(type, edge.props, matchClauseCtx->qctx, true);
+    }
+
+    // Unlike the tags, not every edge type has an index, so leave the pattern to start from
+    // the nodes if no index could be used
+    if (filter == nullptr || !EdgeIndexSeek::indexedBy(edgeCtx, filter)) {
+        return false;
+    }
+
+    edgeCtx->scanInfo.filter = filter;
+    edgeCtx->scanInfo.schemaIds = edge.edgeTypes;
+    edgeCtx->scanInfo.schemaNames = {&type};
+
+    return true;
 }
 
 StatusOr<SubPlan> PropIndexSeek::transformEdge(EdgeContext* edgeCtx) {
-    UNUSED(edgeCtx);
-    return Status::Error("Unimplement for edge pattern.");
+    return EdgeIndexSeek::makeScan(edgeCtx);
 }
 
 bool PropIndexSeek::matchNode(NodeContext* nodeCtx) {
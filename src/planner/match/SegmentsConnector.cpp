@@ -8,6 +8,7 @@
 #include "planner/match/AddDependencyStrategy.h"
 #include "planner/match/AddInputStrategy.h"
 #include "planner/match/CartesianProductStrategy.h"
+#include "planner/match/LeftOuterJoinStrategy.h"
 
 namespace nebula {
 namespace graph {
@@ -17,6 +18,25 @@ StatusOr<SubPlan> SegmentsConnector::connectSegments(CypherClauseContextBase* le
                                                      SubPlan& left,
                                                      SubPlan& right) {
     UNUSED(rightCtx);
+    if (leftCtx->kind == CypherClauseKind::kMatch &&
+        static_cast<MatchClauseContext*>(leftCtx)->isOptional) {
+        // The OPTIONAL MATCH reads the bound node from the right, and is joined back to it
+        auto* matchClauseCtx = static_cast<MatchClauseContext*>(leftCtx);
+        auto& nodeInfos = matchClauseCtx->nodeInfos;
+        auto bound = std::find_if(nodeInfos.begin(), nodeInfos.end(), [](const auto& node) {
+            return node.bound;
+        });
+        if (bound == nodeInfos.end()) {
+            return Status::Error("The OPTIONAL MATCH is not bound by the previous clauses.");
+        }
+        VLOG(1) << "left tail: " << left.tail->outputVar()
+                << "right root: " << right.root->outputVar();
+        addInput(left.tail, right.root);
+        left.root =
+            leftOuterJoinSegments(matchClauseCtx->qctx, right.root, left.root, *bound->alias);
+        left.tail = right.tail;
+        return left;
+    }
     if (leftCtx->kind == CypherClauseKind::kReturn) {
         VLOG(1) << "left tail: " << left.tail->outputVar()
                 << "right root: " << right.root->outputVar();
@@ -45,6 +65,40 @@ PlanNode* SegmentsConnector::innerJoinSegments(QueryContext* qctx,
                 ->connect(left, right);
 }
 
+PlanNode* SegmentsConnector::joinSegments(QueryContext* qctx,
+                                          const std::vector<PlanNode*>& segments,
+                                          const SegmentsJoinOrder& order,
+                                          const std::vector<std::string>& colNames) {
+    DCHECK(!segments.empty());
+    DCHECK_EQ(segments.size(), order.size());
+    DCHECK_EQ(segments.size(), colNames.size());
+    PlanNode* dep = segments.back();
+    std::function<PlanNode*(size_t, size_t)> join = [&](size_t begin, size_t end) {
+        if (begin == end) {
+            return segments[begin];
+        }
+        auto split = order.split(begin, end);
+        auto left = join(begin, split);
+        auto right = join(split + 1, end);
+        VLOG(1) << "left: " << folly::join(",", left->colNames())
+                << " right: " << folly::join(",", right->colNames());
+        auto node = std::make_unique<InnerJoinStrategy>(qctx)->dependency(dep)->connect(left,
+                                                                                        right);
+        node->setColNames(
+            std::vector<std::string>(colNames.begin() + begin, colNames.begin() + end + 1));
+        dep = node;
+        return node;
+    };
+    return join(0, segments.size() - 1);
+}
+
+PlanNode* SegmentsConnector::leftOuterJoinSegments(QueryContext* qctx,
+                                                   const PlanNode* left,
+                                                   const PlanNode* right,
+                                                   const std::string& colName) {
+    return std::make_unique<LeftOuterJoinStrategy>(qctx)->joinOn(colName)->connect(left, right);
+}
+
 PlanNode* SegmentsConnector::cartesianProductSegments(QueryContext* qctx,
                                                       const PlanNode* left,
                                                       const PlanNode* right) {
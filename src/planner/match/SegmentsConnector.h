@@ -12,6 +12,7 @@
 #include "planner/PlanNode.h"
 #include "planner/Planner.h"
 #include "planner/match/InnerJoinStrategy.h"
+#include "planner/match/SegmentsJoinOrder.h"
 
 namespace nebula {
 namespace graph {
@@ -44,6 +45,20 @@ public:
         InnerJoinStrategy::JoinPos leftPos = InnerJoinStrategy::JoinPos::kEnd,
         InnerJoinStrategy::JoinPos rightPos = InnerJoinStrategy::JoinPos::kStart);
 
+    // Join the chain of segments in the order chosen, each join is named by the columns of
+    // the segments joined. The joins depend on the last segment and on each other in turn,
+    // so all the segments are done before any join.
+    static PlanNode* joinSegments(QueryContext* qctx,
+                                  const std::vector<PlanNode*>& segments,
+                                  const SegmentsJoinOrder& order,
+                                  const std::vector<std::string>& colNames);
+
+    // Keep all the rows of left, and join the rows of right by the vertex column `colName'
+    static PlanNode* leftOuterJoinSegments(QueryContext* qctx,
+                                           const PlanNode* left,
+                                           const PlanNode* right,
+                                           const std::string& colName);
+
     static PlanNode* cartesianProductSegments(QueryContext* qctx,
                                               const PlanNode* left,
                                               const PlanNode* right);
@@ -0,0 +1,64 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "planner/match/SegmentsJoinOrder.h"
+
+namespace nebula {
+namespace graph {
+
+SegmentsJoinOrder::SegmentsJoinOrder(std::vector<Segment> segments)
+    : segments_(std::move(segments)) {
+    auto size = segments_.size();
+    costs_.resize(size * size, 0.0);
+    splits_.resize(size * size, 0);
+    for (size_t len = 2; len <= size; ++len) {
+        for (size_t begin = 0; begin + len <= size; ++begin) {
+            auto end = begin + len - 1;
+            auto joined = rows(begin, end);
+            auto splitCost = [&, this](size_t k) {
+                return costs_[index(begin, k)] + costs_[index(k + 1, end)] + rows(begin, k) +
+                       rows(k + 1, end) + joined;
+            };
+            // From the left deep split, so it wins the ties
+            auto split = end - 1;
+            auto best = splitCost(split);
+            for (size_t k = split; k-- > begin;) {
+                auto cost = splitCost(k);
+                if (cost < best) {
+                    best = cost;
+                    split = k;
+                }
+            }
+            costs_[index(begin, end)] = best;
+            splits_[index(begin, end)] = split;
+        }
+    }
+}
+
+size_t SegmentsJoinOrder::split(size_t begin, size_t end) const {
+    DCHECK_LT(begin, end);
+    DCHECK_LT(end, segments_.size());
+    return splits_[index(begin, end)];
+}
+
+double SegmentsJoinOrder::rows(size_t begin, size_t end) const {
+    DCHECK_LE(begin, end);
+    double rows = segments_[begin].inputRows * segments_[begin].fanout;
+    for (size_t i = begin + 1; i <= end; ++i) {
+        rows *= segments_[i].fanout;
+    }
+    return rows;
+}
+
+double SegmentsJoinOrder::cost() const {
+    if (segments_.empty()) {
+        return 0.0;
+    }
+    return costs_[index(0, segments_.size() - 1)];
+}
+
+}   // namespace graph
+}   // namespace nebula
@@ -0,0 +1,56 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef PLANNER_MATCH_SEGMENTSJOINORDER_H_
+#define PLANNER_MATCH_SEGMENTSJOINORDER_H_
+
+#include "common/base/Base.h"
+
+namespace nebula {
+namespace graph {
+/*
+ * The SegmentsJoinOrder was designed to choose the order to join a chain of pattern segments,
+ * where the end of each segment is joined with the start of the next one.
+ *
+ * The segment k expands `fanout' rows from each of its `inputRows' distinct vids, and the
+ * join of the segments [i, j] is estimated as rows(i) * fanout(i + 1) * ... * fanout(j).
+ * The cost of a hash join is the rows of both sides and of its result, and the order of
+ * the least total cost is found by dynamic programming over the ranges of the chain.
+ * The left deep order, i.e. the textual one, is kept on ties.
+ */
+class SegmentsJoinOrder final {
+public:
+    struct Segment {
+        double inputRows{0.0};
+        double fanout{0.0};
+    };
+
+    explicit SegmentsJoinOrder(std::vector<Segment> segments);
+
+    size_t size() const {
+        return segments_.size();
+    }
+
+    // The last segment of the left side to join the segments [begin, end] by, begin < end
+    size_t split(size_t begin, size_t end) const;
+
+    double rows(size_t begin, size_t end) const;
+
+    // The total cost to join all the segments
+    double cost() const;
+
+private:
+    size_t index(size_t begin, size_t end) const {
+        return begin * segments_.size() + end;
+    }
+
+    std::vector<Segment>            segments_;
+    std::vector<double>             costs_;
+    std::vector<size_t>             splits_;
+};
+}   // namespace graph
+}   // namespace nebula
+#endif   // PLANNER_MATCH_SEGMENTSJOINORDER_H_
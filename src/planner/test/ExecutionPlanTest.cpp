@@ -13,6 +13,7 @@
 #include "context/QueryContext.h"
 #include "executor/ExecutionError.h"
 #include "executor/Executor.h"
+#include "planner/Algo.h"
 #include "planner/Query.h"
 #include "scheduler/Scheduler.h"
 
@@ -118,6 +119,44 @@ TEST_F(ExecutionPlanTest, TestMultiOutputsInLoop) {
     run();
 }
 
+TEST_F(ExecutionPlanTest, TestHistoryLiveness) {
+    auto start = StartNode::make(qctx_.get());
+    auto gn = Project::make(qctx_.get(), start, nullptr);
+    auto project = Project::make(qctx_.get(), gn, nullptr);
+    auto join = DataJoin::make(qctx_.get(),
+                               project,
+                               {gn->outputVar(), ExecutionContext::kPreviousOneVersion},
+                               {project->outputVar(), ExecutionContext::kLatestVersion},
+                               {},
+                               {});
+    auto collect = DataCollect::make(
+        qctx_.get(), join, DataCollect::CollectKind::kMToN, {join->outputVar()});
+
+    auto* symTable = qctx_->symTable();
+    symTable->analyzeHistory();
+    EXPECT_EQ(2u, symTable->getVar(gn->outputVar())->numVersionsToKeep);
+    EXPECT_EQ(1u, symTable->getVar(project->outputVar())->numVersionsToKeep);
+    EXPECT_EQ(Variable::kAllVersions, symTable->getVar(join->outputVar())->numVersionsToKeep);
+    EXPECT_EQ(1u, symTable->getVar(collect->outputVar())->numVersionsToKeep);
+
+    // The earlier shortest paths are referred to by the later steps
+    auto pssp = ProduceSemiShortestPath::make(qctx_.get(), start);
+    auto allPaths = ProduceAllPaths::make(qctx_.get(), start);
+    symTable->analyzeHistory();
+    EXPECT_EQ(Variable::kAllVersions, symTable->getVar(pssp->outputVar())->numVersionsToKeep);
+    // The all paths are kept in the arena of the executor instead
+    EXPECT_EQ(1u, symTable->getVar(allPaths->outputVar())->numVersionsToKeep);
+
+    // Only the needed versions are kept after each execution
+    for (int64_t i = 0; i < 3; ++i) {
+        qctx_->ectx()->setValue(gn->outputVar(), i);
+    }
+    qctx_->ectx()->truncHistory(gn->outputVar(),
+                                symTable->getVar(gn->outputVar())->numVersionsToKeep);
+    EXPECT_EQ(2u, qctx_->ectx()->numVersions(gn->outputVar()));
+    EXPECT_EQ(Value(1), qctx_->ectx()->getVersionedResult(gn->outputVar(), -1).value());
+}
+
 }   // namespace graph
 }   // namespace nebula
 
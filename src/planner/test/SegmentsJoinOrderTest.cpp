@@ -0,0 +1,51 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include <gtest/gtest.h>
+
+#include "planner/match/SegmentsJoinOrder.h"
+
+namespace nebula {
+namespace graph {
+
+TEST(SegmentsJoinOrderTest, LeftDeepOnTies) {
+    // (v1)-[:e]->(v2)-[:e]->(v3), each vertex has 10 edges
+    SegmentsJoinOrder order({{1.0, 10.0}, {10.0, 10.0}, {100.0, 1.0}});
+    ASSERT_EQ(3, order.size());
+    EXPECT_EQ(100.0, order.rows(0, 2));
+    EXPECT_EQ(1, order.split(0, 2));
+    EXPECT_EQ(0, order.split(0, 1));
+    EXPECT_EQ(1, order.split(1, 2));
+    EXPECT_EQ(510.0, order.cost());
+}
+
+TEST(SegmentsJoinOrderTest, JoinTheFilteredFirst) {
+    // The vertices fetched last are filtered, so join them with the edges before the starts
+    SegmentsJoinOrder order({{1.0, 10.0}, {10.0, 10.0}, {100.0, 0.5}});
+    EXPECT_EQ(50.0, order.rows(0, 2));
+    EXPECT_EQ(0, order.split(0, 2));
+    EXPECT_EQ(1, order.split(1, 2));
+    EXPECT_EQ(310.0, order.cost());
+}
+
+TEST(SegmentsJoinOrderTest, Bushy) {
+    // The third segment fans out and the last one filters most out, so both pairs are joined
+    // before each other
+    SegmentsJoinOrder order({{1.0, 1.0}, {1.0, 1.0}, {1.0, 100.0}, {100.0, 0.01}});
+    EXPECT_EQ(1, order.split(0, 3));
+    EXPECT_EQ(0, order.split(0, 1));
+    EXPECT_EQ(2, order.split(2, 3));
+    EXPECT_EQ(108.0, order.cost());
+}
+
+TEST(SegmentsJoinOrderTest, Single) {
+    SegmentsJoinOrder order({{10.0, 10.0}});
+    EXPECT_EQ(100.0, order.rows(0, 0));
+    EXPECT_EQ(0.0, order.cost());
+}
+
+}   // namespace graph
+}   // namespace nebula
@@ -168,11 +168,22 @@ folly::Future<Status> Scheduler::execute(Executor *executor) {
     if (!status.ok()) {
         return executor->error(std::move(status));
     }
-    return executor->execute().then([executor](Status s) {
+    return executor->execute().then([executor, this](Status s) {
         NG_RETURN_IF_ERROR(s);
+        truncHistory(executor);
         return executor->close();
     });
 }
 
+void Scheduler::truncHistory(const Executor *executor) const {
+    // Drop the versions of the outputs no longer read, so the loop doesn't hold the results of
+    // all the former iterations
+    for (auto *var : executor->node()->outputVars()) {
+        if (var->numVersionsToKeep != Variable::kAllVersions) {
+            qctx_->ectx()->truncHistory(var->name, var->numVersionsToKeep);
+        }
+    }
+}
+
 }   // namespace graph
 }   // namespace nebula
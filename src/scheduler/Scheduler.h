@@ -67,6 +67,7 @@ private:
     folly::Future<Status> doScheduleParallel(const std::set<Executor *> &dependents);
     folly::Future<Status> iterate(LoopExecutor *loop);
     folly::Future<Status> execute(Executor *executor);
+    void truncHistory(const Executor *executor) const;
 
     struct PassThroughData {
         folly::SpinLock lock;
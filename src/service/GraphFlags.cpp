@@ -48,7 +48,47 @@ DEFINE_string(cloud_http_url, "", "cloud http url including ip, port, url path")
 DEFINE_uint32(max_allowed_statements, 512, "Max allowed sequential statements");
 
 DEFINE_bool(enable_optimizer, false, "Whether to enable optimizer");
+DEFINE_int32(optimizer_stats_refresh_interval_secs, 600,
+             "Seconds to refresh the space statistics used to estimate the cost of plans");
+DEFINE_bool(enable_plan_cache, false,
+            "Whether to reuse the plans of the same read-only queries without parsing, "
+            "validating and optimizing again");
+DEFINE_uint32(plan_cache_capacity, 1024, "Max number of the distinct queries in the plan cache");
+DEFINE_uint32(plan_cache_schema_check_interval_ms, 1000,
+              "Milliseconds to reuse the signature of the schema of a space computed for the "
+              "plan cache, the plans may be reused for the interval after the schema changes");
 
 DEFINE_uint32(ft_request_retry_times, 3, "Retry times if fulltext request failed");
 
 DEFINE_bool(accept_partial_success, false, "Whether to accept partial success, default false");
+
+DEFINE_int64(min_parallel_join_rows, 100000,
+             "Minimum rows of the build side to run the hash join by partitions in parallel, "
+             "0 to disable the parallel join");
+DEFINE_uint32(num_join_partitions, 16, "Number of partitions of the parallel hash join");
+DEFINE_int64(min_morsel_parallel_rows, 200000,
+             "Minimum input rows to split into morsels and run Project/Filter/Aggregate "
+             "in parallel, 0 to disable the morsel execution");
+DEFINE_uint32(morsel_size, 50000, "Number of rows of a morsel");
+DEFINE_uint32(get_neighbors_batch_size, 1024,
+              "Number of vids of a batch when GetNeighbors is limited, the batches are fetched "
+              "one by one until the limit is reached, 0 to fetch all vids at once");
+DEFINE_uint32(get_neighbors_max_vids_per_request, 10000,
+              "Max number of vids of a GetNeighbors request, the larger frontier is split by "
+              "the storage partitions into several requests, 0 to fetch all vids at once");
+DEFINE_uint32(get_neighbors_max_inflight_requests, 4,
+              "Max number of the split GetNeighbors requests of a query in flight");
+DEFINE_int64(min_parallel_subgraph_rows, 100000,
+             "Minimum edges of all the steps of GET SUBGRAPH to collect the steps in parallel, "
+             "0 to disable the parallel collection");
+DEFINE_int64(max_match_hops, 0,
+             "Max hop of the variable length relationships of MATCH, 0 for no limit");
+DEFINE_bool(enable_vectorized_eval, true,
+            "Whether to evaluate the arithmetic, relational and logical expressions of "
+            "Filter/Project over the columns of all rows at once");
+DEFINE_int64(max_query_memory_bytes, 0,
+             "Max estimated bytes of the results held by a query, the query over the limit "
+             "fails, 0 for no limit");
+DEFINE_int64(max_total_query_memory_bytes, 0,
+             "Max estimated bytes of the results held by all the running queries, the query "
+             "making it over the limit fails, 0 for no limit");
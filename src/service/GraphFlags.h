@@ -38,5 +38,23 @@ DECLARE_uint32(max_allowed_statements);
 
 // optimizer
 DECLARE_bool(enable_optimizer);
+DECLARE_int32(optimizer_stats_refresh_interval_secs);
+DECLARE_bool(enable_plan_cache);
+DECLARE_uint32(plan_cache_capacity);
+DECLARE_uint32(plan_cache_schema_check_interval_ms);
+
+// executor
+DECLARE_int64(min_parallel_join_rows);
+DECLARE_uint32(num_join_partitions);
+DECLARE_int64(min_morsel_parallel_rows);
+DECLARE_uint32(morsel_size);
+DECLARE_uint32(get_neighbors_batch_size);
+DECLARE_uint32(get_neighbors_max_vids_per_request);
+DECLARE_uint32(get_neighbors_max_inflight_requests);
+DECLARE_int64(min_parallel_subgraph_rows);
+DECLARE_int64(max_match_hops);
+DECLARE_bool(enable_vectorized_eval);
+DECLARE_int64(max_query_memory_bytes);
+DECLARE_int64(max_total_query_memory_bytes);
 
 #endif   // GRAPH_GRAPHFLAGS_H_
@@ -190,6 +190,16 @@ Status PermissionCheck::permissionCheck(Session *session,
                 return Status::PermissionError("No permission to show users/snapshots/textClients");
             }
         }
+        case Sentence::Kind::kShowQueries: {
+            /**
+             * The queries of all sessions, only GOD role can show them.
+             */
+            if (session->isGod()) {
+                return Status::OK();
+            } else {
+                return Status::PermissionError("No permission to show queries");
+            }
+        }
         case Sentence::Kind::kChangePassword: {
             return Status::OK();
         }
@@ -0,0 +1,200 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "service/PlanCache.h"
+
+#include <folly/hash/Hash.h>
+
+#include "common/time/WallClock.h"
+#include "parser/TraverseSentences.h"
+#include "service/GraphFlags.h"
+
+namespace nebula {
+namespace graph {
+
+constexpr size_t PlanCache::kMaxIdlePlans;
+
+// static
+PlanCache& PlanCache::instance() {
+    static PlanCache cache;
+    return cache;
+}
+
+PlanCache::PlanCache() : entries_(FLAGS_plan_cache_capacity) {}
+
+// static
+std::string PlanCache::makeKey(GraphSpaceID space, const std::string& query) {
+    if (space <= kInvalidSpaceID) {
+        return "";
+    }
+    // Collapse the blanks out of the quotes
+    std::string key = folly::to<std::string>(space, ":");
+    auto prefix = key.size();
+    key.reserve(prefix + query.size());
+    char quote = '\0';
+    bool blank = false;
+    for (size_t i = 0; i < query.size(); ++i) {
+        char c = query[i];
+        if (quote != '\0') {
+            key += c;
+            if (c == '\\' && i + 1 < query.size()) {
+                key += query[++i];
+            } else if (c == quote) {
+                quote = '\0';
+            }
+            continue;
+        }
+        if (std::isspace(static_cast<unsigned char>(c))) {
+            blank = true;
+            continue;
+        }
+        if (blank && key.size() > prefix) {
+            key += ' ';
+        }
+        blank = false;
+        if (c == '"' || c == '\'' || c == '`') {
+            quote = c;
+        }
+        key += c;
+    }
+    return key;
+}
+
+// static
+bool PlanCache::isCacheable(const Sentence* sentence) {
+    switch (sentence->kind()) {
+        case Sentence::Kind::kSequential: {
+            auto sentences = static_cast<const SequentialSentences*>(sentence)->sentences();
+            return std::all_of(sentences.begin(), sentences.end(), [](auto* s) {
+                return isCacheable(s);
+            });
+        }
+        case Sentence::Kind::kPipe: {
+            auto* piped = static_cast<const PipedSentence*>(sentence);
+            return isCacheable(piped->left()) && isCacheable(piped->right());
+        }
+        case Sentence::Kind::kGo:
+        case Sentence::Kind::kMatch:
+        case Sentence::Kind::kLookup:
+        case Sentence::Kind::kFetchVertices:
+        case Sentence::Kind::kFetchEdges:
+        case Sentence::Kind::kFindPath:
+        case Sentence::Kind::kGetSubgraph:
+        case Sentence::Kind::kYield:
+        case Sentence::Kind::kOrderBy:
+        case Sentence::Kind::kLimit:
+        case Sentence::Kind::kGroupBy:
+            return true;
+        default:
+            // The statements with side effects, EXPLAIN and the assignments
+            return false;
+    }
+}
+
+int64_t PlanCache::schemaVersion(QueryContext* qctx, GraphSpaceID space) {
+    auto now = time::WallClock::fastNowInMilliSec();
+    {
+        std::lock_guard<std::mutex> guard(versionLock_);
+        auto found = versions_.find(space);
+        if (found != versions_.end() &&
+            now - found->second.checkedAtInMs < FLAGS_plan_cache_schema_check_interval_ms) {
+            return found->second.version;
+        }
+    }
+    // Walk the schema out of the lock, the concurrent queries may compute it more than once
+    auto version = computeSchemaVersion(qctx, space);
+    std::lock_guard<std::mutex> guard(versionLock_);
+    versions_[space] = SchemaVersion{version, now};
+    return version;
+}
+
+// static
+int64_t PlanCache::computeSchemaVersion(QueryContext* qctx, GraphSpaceID space) {
+    // Combined regardless of the order of the unordered maps
+    uint64_t version = 0;
+    auto tags = qctx->schemaMng()->getAllVerTagSchema(space);
+    if (tags.ok()) {
+        for (const auto& tag : tags.value()) {
+            version += folly::hash::hash_combine(0, tag.first, tag.second.size());
+        }
+    }
+    auto edges = qctx->schemaMng()->getAllVerEdgeSchema(space);
+    if (edges.ok()) {
+        for (const auto& edge : edges.value()) {
+            version += folly::hash::hash_combine(1, edge.first, edge.second.size());
+        }
+    }
+    auto* metaClient = qctx->getMetaClient();
+    if (metaClient == nullptr) {
+        return static_cast<int64_t>(version);
+    }
+    auto tagIndexes = metaClient->getTagIndexesFromCache(space);
+    if (tagIndexes.ok()) {
+        for (const auto& index : tagIndexes.value()) {
+            version += folly::hash::hash_combine(2, index->get_index_id());
+        }
+    }
+    auto edgeIndexes = metaClient->getEdgeIndexesFromCache(space);
+    if (edgeIndexes.ok()) {
+        for (const auto& index : edgeIndexes.value()) {
+            version += folly::hash::hash_combine(3, index->get_index_id());
+        }
+    }
+    return static_cast<int64_t>(version);
+}
+
+PlanCache::Plan PlanCache::take(const std::string& key, int64_t schemaVersion) {
+    std::lock_guard<std::mutex> guard(lock_);
+    auto found = entries_.find(key);
+    if (found == entries_.end()) {
+        return Plan();
+    }
+    auto& entry = found->second;
+    if (entry.schemaVersion != schemaVersion) {
+        entries_.erase(key);
+        return Plan();
+    }
+    if (entry.idle.empty()) {
+        return Plan();
+    }
+    auto plan = std::move(entry.idle.back());
+    entry.idle.pop_back();
+    return plan;
+}
+
+void PlanCache::put(const std::string& key, int64_t schemaVersion, Plan plan) {
+    // Release the request and the results before queued
+    plan.qctx->reset(nullptr, nullptr);
+    std::lock_guard<std::mutex> guard(lock_);
+    auto found = entries_.find(key);
+    if (found == entries_.end()) {
+        Entry entry;
+        entry.schemaVersion = schemaVersion;
+        entry.idle.emplace_back(std::move(plan));
+        entries_.set(key, std::move(entry));
+        return;
+    }
+    auto& entry = found->second;
+    if (entry.schemaVersion != schemaVersion) {
+        entry.schemaVersion = schemaVersion;
+        entry.idle.clear();
+    }
+    if (entry.idle.size() < kMaxIdlePlans) {
+        entry.idle.emplace_back(std::move(plan));
+    }
+}
+
+void PlanCache::clear() {
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        entries_.clear();
+    }
+    std::lock_guard<std::mutex> guard(versionLock_);
+    versions_.clear();
+}
+
+}   // namespace graph
+}   // namespace nebula
@@ -0,0 +1,84 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef SERVICE_PLANCACHE_H_
+#define SERVICE_PLANCACHE_H_
+
+#include <folly/container/EvictingCacheMap.h>
+
+#include "common/base/Base.h"
+#include "context/QueryContext.h"
+
+/**
+ * PlanCache keeps the validated and optimized plans of the read-only queries, keyed by the
+ * space and the normalized query text, so the same query skips parsing, validating and
+ * optimizing. A plan holds the states of its execution, i.e. the expressions and the executors,
+ * so a cached plan is taken out by one query at a time and put back once it finishes.
+ * The plans of a space are dropped when its schema, i.e. the tags, edges and indexes, changes.
+ * The signature of the schema is computed from the schema cached by the meta client, which is
+ * refreshed by the heartbeats, and reused for plan_cache_schema_check_interval_ms.
+ */
+
+namespace nebula {
+namespace graph {
+
+class PlanCache final {
+public:
+    struct Plan {
+        // The plan nodes refer to the expressions of the sentence
+        std::unique_ptr<Sentence>           sentence;
+        std::unique_ptr<QueryContext>       qctx;
+        // The values prepared by the validators before the execution
+        std::unique_ptr<ExecutionContext>   ectx;
+    };
+
+    static PlanCache& instance();
+
+    // Empty if the query of the space could not be cached
+    static std::string makeKey(GraphSpaceID space, const std::string& query);
+
+    static bool isCacheable(const Sentence* sentence);
+
+    // The signature of the schema of the space, which changes when any tag, edge or index
+    // is created, altered or dropped
+    int64_t schemaVersion(QueryContext* qctx, GraphSpaceID space);
+
+    // Take an idle plan of the key out, the plan is nullptr if missed
+    Plan take(const std::string& key, int64_t schemaVersion);
+
+    // Put the plan back after the execution
+    void put(const std::string& key, int64_t schemaVersion, Plan plan);
+
+    void clear();
+
+private:
+    PlanCache();
+
+    static constexpr size_t kMaxIdlePlans = 8;
+
+    struct Entry {
+        int64_t                 schemaVersion{0};
+        std::vector<Plan>       idle;
+    };
+
+    struct SchemaVersion {
+        int64_t                 version{0};
+        int64_t                 checkedAtInMs{0};
+    };
+
+    static int64_t computeSchemaVersion(QueryContext* qctx, GraphSpaceID space);
+
+    std::mutex                                          lock_;
+    folly::EvictingCacheMap<std::string, Entry>         entries_;
+
+    std::mutex                                          versionLock_;
+    std::unordered_map<GraphSpaceID, SchemaVersion>     versions_;
+};
+
+}   // namespace graph
+}   // namespace nebula
+
+#endif   // SERVICE_PLANCACHE_H_
@@ -14,6 +14,8 @@
 #include "planner/ExecutionPlan.h"
 #include "planner/PlanNode.h"
 #include "scheduler/Scheduler.h"
+#include "service/GraphFlags.h"
+#include "service/PermissionManager.h"
 #include "validator/Validator.h"
 #include "stats/StatsDef.h"
 
@@ -59,6 +61,14 @@ void QueryInstance::execute() {
 
 Status QueryInstance::validateAndOptimize() {
     auto *rctx = qctx()->rctx();
+    if (FLAGS_enable_plan_cache && reuseCachedPlan()) {
+        VLOG(1) << "Reuse the cached plan of query: " << rctx->query();
+        if (FLAGS_enable_authorize) {
+            NG_RETURN_IF_ERROR(PermissionManager::canReadSchemaOrData(rctx->session()));
+        }
+        return Status::OK();
+    }
+
     VLOG(1) << "Parsing query: " << rctx->query();
     auto result = GQLParser(qctx()).parse(rctx->query());
     NG_RETURN_IF_ERROR(result);
@@ -70,13 +80,43 @@ Status QueryInstance::validateAndOptimize() {
     NG_RETURN_IF_ERROR(rootStatus);
     auto newRoot = std::move(rootStatus).value();
     qctx_->setPlan(std::make_unique<ExecutionPlan>(const_cast<PlanNode *>(newRoot)));
+    qctx_->symTable()->analyzeHistory();
 
+    if (!cacheKey_.empty() && PlanCache::isCacheable(sentence_.get())) {
+        preparedECtx_ = qctx_->ectx()->copy();
+    } else {
+        cacheKey_.clear();
+    }
     return Status::OK();
 }
 
 
+bool QueryInstance::reuseCachedPlan() {
+    auto *rctx = qctx()->rctx();
+    auto space = rctx->session()->space().id;
+    cacheKey_ = PlanCache::makeKey(space, rctx->query());
+    if (cacheKey_.empty()) {
+        return false;
+    }
+    schemaVersion_ = PlanCache::instance().schemaVersion(qctx(), space);
+    auto plan = PlanCache::instance().take(cacheKey_, schemaVersion_);
+    if (plan.qctx == nullptr) {
+        stats::StatsManager::addValue(kNumPlanCacheMisses);
+        return false;
+    }
+    stats::StatsManager::addValue(kNumPlanCacheHits);
+    plan.qctx->reset(qctx_->releaseRCtx(), plan.ectx->copy());
+    qctx_ = std::move(plan.qctx);
+    sentence_ = std::move(plan.sentence);
+    preparedECtx_ = std::move(plan.ectx);
+    scheduler_ = std::make_unique<Scheduler>(qctx_.get());
+    return true;
+}
+
+
 bool QueryInstance::explainOrContinue() {
-    if (sentence_->kind() != Sentence::Kind::kExplain) {
+    // The cached plans are never explained
+    if (sentence_ == nullptr || sentence_->kind() != Sentence::Kind::kExplain) {
         return true;
     }
     qctx_->fillPlanDescription();
@@ -120,6 +160,14 @@ void QueryInstance::onFinish() {
     }
     rctx->finish();
 
+    if (!cacheKey_.empty()) {
+        PlanCache::Plan plan;
+        plan.sentence = std::move(sentence_);
+        plan.qctx = std::move(qctx_);
+        plan.ectx = std::move(preparedECtx_);
+        PlanCache::instance().put(cacheKey_, schemaVersion_, std::move(plan));
+    }
+
     // The `QueryInstance' is the root node holding all resources during the execution.
     // When the whole query process is done, it's safe to release this object, as long as
     // no other contexts have chances to access these resources later on,
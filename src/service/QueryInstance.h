@@ -14,6 +14,7 @@
 #include "optimizer/Optimizer.h"
 #include "parser/GQLParser.h"
 #include "scheduler/Scheduler.h"
+#include "service/PlanCache.h"
 
 /**
  * QueryInstance coordinates the execution process,
@@ -52,11 +53,18 @@ private:
     Status validateAndOptimize();
     // return true if continue to execute
     bool explainOrContinue();
+    // return true if the plan is taken from the plan cache
+    bool reuseCachedPlan();
 
     std::unique_ptr<Sentence>                   sentence_;
     std::unique_ptr<QueryContext>               qctx_;
     std::unique_ptr<Scheduler>                  scheduler_;
     opt::Optimizer*                             optimizer_{nullptr};
+
+    // Put the plan back to the plan cache when finished if the key is not empty
+    std::string                                 cacheKey_;
+    int64_t                                     schemaVersion_{0};
+    std::unique_ptr<ExecutionContext>           preparedECtx_;
 };
 
 }   // namespace graph
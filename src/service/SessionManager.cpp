@@ -6,6 +6,8 @@
 
 #include "common/base/Base.h"
 #include "service/SessionManager.h"
+
+#include "common/time/WallClock.h"
 #include "service/GraphFlags.h"
 
 namespace nebula {
@@ -31,9 +33,10 @@ SessionManager::~SessionManager() {
 
 StatusOr<std::shared_ptr<Session>>
 SessionManager::findSession(int64_t id) {
-    folly::RWSpinLock::ReadHolder holder(rwlock_);
-    auto iter = activeSessions_.find(id);
-    if (iter == activeSessions_.end()) {
+    auto& shard = shardOf(id);
+    folly::RWSpinLock::ReadHolder holder(shard.rwlock);
+    auto iter = shard.sessions.find(id);
+    if (iter == shard.sessions.end()) {
         return Status::Error("Session `%ld' has expired", id);
     }
     return iter->second;
@@ -41,31 +44,36 @@ SessionManager::findSession(int64_t id) {
 
 
 std::shared_ptr<Session> SessionManager::createSession() {
-    folly::RWSpinLock::WriteHolder holder(rwlock_);
-    auto sid = newSessionId();
+    SessionPtr session;
     while (true) {
-        if (activeSessions_.count(sid) == 0UL) {
-            break;
+        auto sid = newSessionId();
+        DCHECK_NE(sid, 0L);
+        auto& shard = shardOf(sid);
+        folly::RWSpinLock::WriteHolder holder(shard.rwlock);
+        if (shard.sessions.count(sid) != 0UL) {
+            // This ID is in use already, try another one
+            continue;
         }
-        // This ID is in use already, try another one
-        sid = newSessionId();
+        session = Session::create(sid);
+        shard.sessions[sid] = session;
+        session->charge();
+        break;
     }
-    DCHECK_NE(sid, 0L);
-    auto session = Session::create(sid);
-    activeSessions_[sid] = session;
-    session->charge();
+    scheduleExpiry(session->id(), time::WallClock::fastNowInSec());
     return session;
 }
 
 
 std::shared_ptr<Session> SessionManager::removeSession(int64_t id) {
-    folly::RWSpinLock::WriteHolder holder(rwlock_);
-    auto iter = activeSessions_.find(id);
-    if (iter == activeSessions_.end()) {
+    // The id left in the expiry queue is skipped when due
+    auto& shard = shardOf(id);
+    folly::RWSpinLock::WriteHolder holder(shard.rwlock);
+    auto iter = shard.sessions.find(id);
+    if (iter == shard.sessions.end()) {
         return nullptr;
     }
     auto session = std::move(iter->second);
-    activeSessions_.erase(iter);
+    shard.sessions.erase(iter);
     return session;
 }
 
@@ -79,29 +87,78 @@ int64_t SessionManager::newSessionId() {
 }
 
 
-// TODO(dutor) Now we do a brute-force scanning, of course we could make it more efficient.
+void SessionManager::scheduleExpiry(int64_t id, int64_t idleSince) {
+    std::lock_guard<std::mutex> guard(expiryLock_);
+    expiryQueue_[idleSince].emplace_back(id);
+}
+
+
 void SessionManager::reclaimExpiredSessions() {
-    if (FLAGS_session_idle_timeout_secs == 0) {
-        return;
+    reclaimExpiredSessions(time::WallClock::fastNowInSec());
+}
+
+
+size_t SessionManager::reclaimExpiredSessions(int64_t now) {
+    int64_t timeout = FLAGS_session_idle_timeout_secs;
+    if (timeout == 0) {
+        // Sessions never expire without the idle timeout, but they stay queued in case
+        // it's enabled again
+        return 0;
+    }
+    std::vector<int64_t> due;
+    {
+        // The sessions idle since then would expire by now, whatever the timeout was when
+        // they were queued
+        std::lock_guard<std::mutex> guard(expiryLock_);
+        auto end = expiryQueue_.upper_bound(now - timeout);
+        for (auto iter = expiryQueue_.begin(); iter != end; ++iter) {
+            due.insert(due.end(), iter->second.begin(), iter->second.end());
+        }
+        expiryQueue_.erase(expiryQueue_.begin(), end);
     }
-    folly::RWSpinLock::WriteHolder holder(rwlock_);
-    if (activeSessions_.empty()) {
-        return;
+    if (due.empty()) {
+        return 0;
     }
 
-    FVLOG3("Try to reclaim expired sessions out of %lu ones", activeSessions_.size());
-    auto iter = activeSessions_.begin();
-    auto end = activeSessions_.end();
-    while (iter != end) {
-        auto *session = iter->second.get();
-        int32_t idleSecs = session->idleSeconds();
-        if (idleSecs < FLAGS_session_idle_timeout_secs) {
-            ++iter;
-            continue;
+    FVLOG3("Try to reclaim expired sessions out of %lu due ones", due.size());
+    size_t checked = 0;
+    std::vector<std::pair<int64_t, int64_t>> charged;
+    for (auto id : due) {
+        auto& shard = shardOf(id);
+        int64_t idleSecs = 0;
+        {
+            // Most of the due sessions have been charged since, which are only queued again
+            folly::RWSpinLock::ReadHolder holder(shard.rwlock);
+            auto iter = shard.sessions.find(id);
+            if (iter == shard.sessions.end()) {
+                // Removed already
+                continue;
+            }
+            ++checked;
+            idleSecs = iter->second->idleSeconds();
         }
-        FLOG_INFO("Session %ld has expired", session->id());
-        iter = activeSessions_.erase(iter);
+        if (idleSecs >= timeout) {
+            folly::RWSpinLock::WriteHolder holder(shard.rwlock);
+            auto iter = shard.sessions.find(id);
+            if (iter == shard.sessions.end()) {
+                continue;
+            }
+            // It may be charged before the write lock is taken
+            idleSecs = iter->second->idleSeconds();
+            if (idleSecs >= timeout) {
+                FLOG_INFO("Session %ld has expired", id);
+                shard.sessions.erase(iter);
+                continue;
+            }
+        }
+        charged.emplace_back(id, now - idleSecs);
+    }
+
+    std::lock_guard<std::mutex> guard(expiryLock_);
+    for (auto& session : charged) {
+        expiryQueue_[session.second].emplace_back(session.first);
     }
+    return checked;
 }
 
 }   // namespace graph
@@ -14,6 +14,12 @@
 
 /**
  * SessionManager manages the client sessions, e.g. create new, find existing and drop expired.
+ *
+ * The sessions are sharded by their ids, so finding a session only takes the read lock of
+ * its shard. The ids are also queued by the time they have been idle since, and the
+ * scavenger only checks the ones idle over the timeout: the expired are dropped and the
+ * charged are queued again by the time they were charged. The queue doesn't depend on the
+ * timeout, so changing it applies to the queued sessions too.
  */
 
 namespace nebula {
@@ -39,17 +45,42 @@ public:
     SessionPtr removeSession(int64_t id);
 
 private:
+    friend class SessionManager_ReclaimDueOnly_Test;
+    friend class SessionManager_NoIdleTimeout_Test;
+    friend class SessionManager_IdleTimeoutChanged_Test;
+
+    static constexpr size_t kNumShards = 64;
+
+    struct Shard {
+        folly::RWSpinLock                           rwlock;
+        std::unordered_map<int64_t, SessionPtr>     sessions;
+    };
+
+    Shard& shardOf(int64_t id) {
+        return shards_[static_cast<uint64_t>(id) % kNumShards];
+    }
+
     /**
      * Generate a non-zero number
      */
     int64_t newSessionId();
 
+    /**
+     * Queue the session to be checked once idle over the timeout
+     */
+    void scheduleExpiry(int64_t id, int64_t idleSince);
+
     void reclaimExpiredSessions();
 
+    // Returns the number of the sessions checked
+    size_t reclaimExpiredSessions(int64_t now);
+
 private:
     std::atomic<int64_t>                        nextId_{0};
-    folly::RWSpinLock                           rwlock_;        // TODO(dutor) writer might starve
-    std::unordered_map<int64_t, SessionPtr>     activeSessions_;
+    std::array<Shard, kNumShards>               shards_;
+    std::mutex                                  expiryLock_;
+    // idle since in seconds => session ids
+    std::map<int64_t, std::vector<int64_t>>     expiryQueue_;
     std::unique_ptr<thread::GenericWorker>      scavenger_;
 };
 
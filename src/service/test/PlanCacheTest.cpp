@@ -0,0 +1,135 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include <gtest/gtest.h>
+
+#include "optimizer/OptRule.h"
+#include "optimizer/Optimizer.h"
+#include "parser/GQLParser.h"
+#include "planner/PlannersRegister.h"
+#include "service/GraphFlags.h"
+#include "service/PlanCache.h"
+#include "service/QueryInstance.h"
+#include "stats/StatsDef.h"
+#include "validator/test/MockIndexManager.h"
+#include "validator/test/MockSchemaManager.h"
+
+namespace nebula {
+namespace graph {
+
+TEST(PlanCacheTest, MakeKey) {
+    EXPECT_EQ("", PlanCache::makeKey(kInvalidSpaceID, "GO FROM 1 OVER like"));
+    EXPECT_EQ(PlanCache::makeKey(1, "GO FROM 1 OVER like"),
+              PlanCache::makeKey(1, "  GO  FROM 1\n\tOVER like "));
+    EXPECT_NE(PlanCache::makeKey(1, "GO FROM 1 OVER like"),
+              PlanCache::makeKey(2, "GO FROM 1 OVER like"));
+    // The blanks in the strings are kept
+    EXPECT_NE(PlanCache::makeKey(1, "FETCH PROP ON person \"a  b\""),
+              PlanCache::makeKey(1, "FETCH PROP ON person \"a b\""));
+    EXPECT_EQ("1:YIELD \"a  \\\"  b\"", PlanCache::makeKey(1, "YIELD  \"a  \\\"  b\""));
+}
+
+TEST(PlanCacheTest, Cacheable) {
+    auto cacheable = [](const std::string& query) {
+        auto result = GQLParser().parse(query);
+        CHECK(result.ok()) << result.status();
+        return PlanCache::isCacheable(result.value().get());
+    };
+    EXPECT_TRUE(cacheable("GO FROM \"1\" OVER like YIELD like._dst AS id"));
+    EXPECT_TRUE(cacheable("GO FROM \"1\" OVER like YIELD like._dst AS id | LIMIT 10"));
+    EXPECT_TRUE(cacheable("MATCH (v:person) RETURN v"));
+    EXPECT_TRUE(cacheable("FETCH PROP ON person \"1\"; LOOKUP ON person"));
+    EXPECT_FALSE(cacheable("EXPLAIN GO FROM \"1\" OVER like"));
+    EXPECT_FALSE(cacheable("$a = GO FROM \"1\" OVER like YIELD like._dst AS id"));
+    EXPECT_FALSE(cacheable("INSERT VERTEX person(name) VALUES \"1\":(\"a\")"));
+    EXPECT_FALSE(cacheable("GO FROM \"1\" OVER like; USE nba"));
+}
+
+TEST(PlanCacheTest, TakeAndPut) {
+    auto& cache = PlanCache::instance();
+    auto key = PlanCache::makeKey(1, "GO FROM \"1\" OVER like");
+    EXPECT_EQ(nullptr, cache.take(key, 1).qctx);
+
+    PlanCache::Plan plan;
+    plan.qctx = std::make_unique<QueryContext>();
+    plan.qctx->ectx()->setValue("v", 1);
+    plan.ectx = plan.qctx->ectx()->copy();
+    auto* qctx = plan.qctx.get();
+    cache.put(key, 1, std::move(plan));
+
+    // Taken by one query at a time
+    auto taken = cache.take(key, 1);
+    ASSERT_EQ(qctx, taken.qctx.get());
+    EXPECT_EQ(nullptr, cache.take(key, 1).qctx);
+    EXPECT_EQ(Value(1), taken.ectx->getValue("v"));
+
+    // Dropped once the schema changes
+    cache.put(key, 1, std::move(taken));
+    EXPECT_EQ(nullptr, cache.take(key, 2).qctx);
+    EXPECT_EQ(nullptr, cache.take(key, 1).qctx);
+    cache.clear();
+}
+
+TEST(PlanCacheTest, ReuseByQueryInstance) {
+    gflags::FlagSaver flagSaver;
+    FLAGS_enable_plan_cache = true;
+    initCounters();
+    PlannersRegister::registPlanners();
+    auto schemaMng = MockSchemaManager::makeUnique();
+    auto indexMng = MockIndexManager::makeUnique();
+    opt::Optimizer optimizer({&opt::RuleSet::DefaultRules()});
+    auto session = Session::create(0);
+    SpaceInfo spaceInfo;
+    spaceInfo.name = "test_space";
+    spaceInfo.id = 1;
+    spaceInfo.spaceDesc.space_name = "test_space";
+    session->setSpace(std::move(spaceInfo));
+
+    auto makeContext = [&](const std::string& query) {
+        auto rctx = std::make_unique<RequestContext<ExecutionResponse>>();
+        rctx->setSession(session);
+        rctx->setQuery(query);
+        auto qctx = std::make_unique<QueryContext>();
+        qctx->setRCtx(std::move(rctx));
+        qctx->setSchemaManager(schemaMng.get());
+        qctx->setIndexManager(indexMng.get());
+        qctx->setCharsetInfo(CharsetInfo::instance());
+        return qctx;
+    };
+    auto run = [&](const std::string& query) {
+        auto qctx = makeContext(query);
+        auto future = qctx->rctx()->future();
+        // The instance deletes itself once finished
+        (new QueryInstance(std::move(qctx), &optimizer))->execute();
+        return std::move(future).get();
+    };
+
+    // The unit tests have no storage, so the plan is of the piped YIELDs, whose Project nodes
+    // refer to the columns of the sentence as those of GO and MATCH do
+    const std::string query = "YIELD 1 + 1 AS a, \"plan\" AS b | YIELD $-.a * 2 AS c, $-.b AS d";
+    DataSet expected({"c", "d"});
+    expected.emplace_back(Row({4, "plan"}));
+    auto& cache = PlanCache::instance();
+    auto key = PlanCache::makeKey(1, query);
+    for (auto i = 0; i < 3; ++i) {
+        auto resp = run(query);
+        ASSERT_EQ(ErrorCode::SUCCEEDED, resp.errorCode);
+        ASSERT_NE(nullptr, resp.data);
+        EXPECT_EQ(expected, *resp.data);
+
+        // The plan is put back with the sentence it refers to
+        auto qctx = makeContext(query);
+        auto version = cache.schemaVersion(qctx.get(), 1);
+        auto plan = cache.take(key, version);
+        ASSERT_NE(nullptr, plan.qctx);
+        ASSERT_NE(nullptr, plan.sentence);
+        cache.put(key, version, std::move(plan));
+    }
+    cache.clear();
+}
+
+}   // namespace graph
+}   // namespace nebula
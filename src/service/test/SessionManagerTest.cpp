@@ -8,6 +8,7 @@
 
 #include "common/base/Base.h"
 #include "common/thread/GenericWorker.h"
+#include "common/time/WallClock.h"
 
 #include "service/SessionManager.h"
 #include "service/GraphFlags.h"
@@ -30,6 +31,7 @@ TEST(SessionManager, Basic) {
 }
 
 TEST(SessionManager, ExpiredSession) {
+    gflags::FlagSaver flagSaver;
     FLAGS_session_idle_timeout_secs = 3;
     FLAGS_session_reclaim_interval_secs = 1;
 
@@ -80,5 +82,79 @@ TEST(SessionManager, ExpiredSession) {
     worker->wait();
 }
 
+TEST(SessionManager, ReclaimDueOnly) {
+    gflags::FlagSaver flagSaver;
+    FLAGS_session_idle_timeout_secs = 100;
+    auto sm = std::make_shared<SessionManager>();
+
+    auto now = time::WallClock::fastNowInSec();
+    std::vector<std::shared_ptr<Session>> sessions;
+    for (auto i = 0; i < 3; ++i) {
+        sessions.emplace_back(sm->createSession());
+    }
+    // None is due
+    ASSERT_EQ(0, sm->reclaimExpiredSessions(now - 1));
+
+    // All are due but charged, so they are queued again
+    ASSERT_EQ(3, sm->reclaimExpiredSessions(now + 100));
+    ASSERT_EQ(0, sm->reclaimExpiredSessions(now + 100));
+    for (auto& session : sessions) {
+        ASSERT_TRUE(sm->findSession(session->id()).ok());
+    }
+
+    // The removed is skipped
+    ASSERT_NE(nullptr, sm->removeSession(sessions[0]->id()));
+    ASSERT_EQ(2, sm->reclaimExpiredSessions(now + 200));
+    ASSERT_FALSE(sm->findSession(sessions[0]->id()).ok());
+    ASSERT_TRUE(sm->findSession(sessions[1]->id()).ok());
+}
+
+TEST(SessionManager, NoIdleTimeout) {
+    gflags::FlagSaver flagSaver;
+    FLAGS_session_idle_timeout_secs = 100;
+    auto sm = std::make_shared<SessionManager>();
+    auto numQueued = [&sm] () {
+        size_t num = 0;
+        for (auto& ids : sm->expiryQueue_) {
+            num += ids.second.size();
+        }
+        return num;
+    };
+    auto queued = sm->createSession();
+    ASSERT_EQ(1, numQueued());
+
+    // Nothing expires without the idle timeout, but the sessions are still queued
+    FLAGS_session_idle_timeout_secs = 0;
+    auto session = sm->createSession();
+    ASSERT_EQ(2, numQueued());
+    auto now = time::WallClock::fastNowInSec();
+    ASSERT_EQ(0, sm->reclaimExpiredSessions(now + 200));
+    ASSERT_EQ(2, numQueued());
+    ASSERT_TRUE(sm->findSession(queued->id()).ok());
+    ASSERT_TRUE(sm->findSession(session->id()).ok());
+}
+
+TEST(SessionManager, IdleTimeoutChanged) {
+    gflags::FlagSaver flagSaver;
+    FLAGS_session_idle_timeout_secs = 100;
+    auto sm = std::make_shared<SessionManager>();
+    auto queued = sm->createSession();
+
+    FLAGS_session_idle_timeout_secs = 0;
+    auto session = sm->createSession();
+    std::this_thread::sleep_for(std::chrono::seconds(2));
+    ASSERT_EQ(0, sm->reclaimExpiredSessions(time::WallClock::fastNowInSec()));
+    ASSERT_TRUE(sm->findSession(queued->id()).ok());
+    ASSERT_TRUE(sm->findSession(session->id()).ok());
+
+    // Enabled again by a lower timeout, both the one queued with the former timeout and the one
+    // queued without it expire
+    FLAGS_session_idle_timeout_secs = 1;
+    ASSERT_EQ(2, sm->reclaimExpiredSessions(time::WallClock::fastNowInSec()));
+    ASSERT_FALSE(sm->findSession(queued->id()).ok());
+    ASSERT_FALSE(sm->findSession(session->id()).ok());
+    ASSERT_EQ(0, sm->expiryQueue_.size());
+}
+
 }   // namespace graph
 }   // namespace nebula
@@ -20,6 +20,8 @@ stats::CounterId kNumSlowQueries;
 stats::CounterId kNumQueryErrors;
 stats::CounterId kQueryLatencyUs;
 stats::CounterId kSlowQueryLatencyUs;
+stats::CounterId kNumPlanCacheHits;
+stats::CounterId kNumPlanCacheMisses;
 
 void initCounters() {
     kNumQueries = stats::StatsManager::registerStats("num_queries", "rate, sum");
@@ -29,6 +31,9 @@ void initCounters() {
         "query_latency_us", 1000, 0, 2000, "avg, p75, p95, p99, p999");
     kSlowQueryLatencyUs = stats::StatsManager::registerHisto(
         "slow_query_latency_us", 1000, 0, 2000, "avg, p75, p95, p99, p999");
+    kNumPlanCacheHits = stats::StatsManager::registerStats("num_plan_cache_hits", "rate, sum");
+    kNumPlanCacheMisses =
+        stats::StatsManager::registerStats("num_plan_cache_misses", "rate, sum");
 }
 
 }  // namespace nebula
@@ -92,6 +92,17 @@ public:
                         Expression::Kind::kEdge});
     }
 
+    // Whether the expression could be evaluated by several threads at the same time, each
+    // thread should evaluate on its own clone since the expression caches the result.
+    // The expressions defining inner variables are excluded because they write to the
+    // execution context.
+    static bool isConcurrentEvaluable(const Expression* expr) {
+        return !hasAny(expr,
+                       {Expression::Kind::kListComprehension,
+                        Expression::Kind::kPredicate,
+                        Expression::Kind::kReduce});
+    }
+
     // determine the detail about symbol property expression
     template <typename To,
               typename = std::enable_if_t<std::is_same<To, EdgePropertyExpression>::value ||
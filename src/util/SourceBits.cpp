@@ -0,0 +1,111 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "util/SourceBits.h"
+
+namespace nebula {
+namespace graph {
+
+namespace {
+constexpr size_t kWordBits = 64;
+}   // namespace
+
+// static
+SourceBits SourceBits::decode(const std::string& encoded) {
+    SourceBits bits;
+    bits.words_.resize(encoded.size() / sizeof(uint64_t));
+    memcpy(bits.words_.data(), encoded.data(), bits.words_.size() * sizeof(uint64_t));
+    return bits;
+}
+
+std::string SourceBits::encode() const {
+    // The trailing zero words are not encoded
+    auto size = words_.size();
+    while (size > 0 && words_[size - 1] == 0) {
+        --size;
+    }
+    return std::string(reinterpret_cast<const char*>(words_.data()), size * sizeof(uint64_t));
+}
+
+void SourceBits::set(size_t index) {
+    auto word = index / kWordBits;
+    if (word >= words_.size()) {
+        words_.resize(word + 1, 0);
+    }
+    words_[word] |= uint64_t{1} << (index % kWordBits);
+}
+
+bool SourceBits::test(size_t index) const {
+    auto word = index / kWordBits;
+    return word < words_.size() && (words_[word] & (uint64_t{1} << (index % kWordBits))) != 0;
+}
+
+bool SourceBits::any() const {
+    for (auto word : words_) {
+        if (word != 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+SourceBits SourceBits::minus(const SourceBits& other) const {
+    SourceBits result;
+    result.words_ = words_;
+    auto size = std::min(words_.size(), other.words_.size());
+    for (size_t i = 0; i < size; ++i) {
+        result.words_[i] &= ~other.words_[i];
+    }
+    return result;
+}
+
+bool SourceBits::intersects(const SourceBits& other) const {
+    auto size = std::min(words_.size(), other.words_.size());
+    for (size_t i = 0; i < size; ++i) {
+        if ((words_[i] & other.words_[i]) != 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+SourceBits& SourceBits::operator|=(const SourceBits& other) {
+    if (other.words_.size() > words_.size()) {
+        words_.resize(other.words_.size(), 0);
+    }
+    for (size_t i = 0; i < other.words_.size(); ++i) {
+        words_[i] |= other.words_[i];
+    }
+    return *this;
+}
+
+std::vector<size_t> SourceBits::indexes() const {
+    std::vector<size_t> result;
+    for (size_t i = 0; i < words_.size(); ++i) {
+        auto word = words_[i];
+        while (word != 0) {
+            result.emplace_back(i * kWordBits + __builtin_ctzll(word));
+            // Clear the lowest set bit
+            word &= word - 1;
+        }
+    }
+    return result;
+}
+
+bool SourceBits::operator==(const SourceBits& other) const {
+    auto size = std::max(words_.size(), other.words_.size());
+    for (size_t i = 0; i < size; ++i) {
+        auto lhs = i < words_.size() ? words_[i] : 0;
+        auto rhs = i < other.words_.size() ? other.words_[i] : 0;
+        if (lhs != rhs) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}   // namespace graph
+}   // namespace nebula
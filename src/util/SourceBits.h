@@ -0,0 +1,53 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef UTIL_SOURCEBITS_H_
+#define UTIL_SOURCEBITS_H_
+
+#include "common/base/Base.h"
+
+namespace nebula {
+namespace graph {
+
+// The set of the starts reaching a vertex in the multi-source shortest path, the bit i is set
+// if the start of index i reaches it. The bits are kept in 64-bit words, so propagating the
+// starts along an edge costs a word operation per 64 starts instead of a map lookup per
+// start. It's passed between the executors as a string of the raw words.
+class SourceBits final {
+public:
+    SourceBits() = default;
+
+    static SourceBits decode(const std::string& encoded);
+
+    std::string encode() const;
+
+    void set(size_t index);
+
+    bool test(size_t index) const;
+
+    bool any() const;
+
+    // The bits set here but not in `other'
+    SourceBits minus(const SourceBits& other) const;
+
+    // Whether any bit is set both here and in `other'
+    bool intersects(const SourceBits& other) const;
+
+    SourceBits& operator|=(const SourceBits& other);
+
+    // The indexes of the set bits in ascending order
+    std::vector<size_t> indexes() const;
+
+    bool operator==(const SourceBits& other) const;
+
+private:
+    std::vector<uint64_t> words_;
+};
+
+}   // namespace graph
+}   // namespace nebula
+
+#endif   // UTIL_SOURCEBITS_H_
@@ -0,0 +1,98 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "util/StatsCache.h"
+
+#include "common/time/WallClock.h"
+#include "service/GraphFlags.h"
+
+namespace nebula {
+namespace graph {
+
+// static
+StatsCache& StatsCache::instance() {
+    static StatsCache cache;
+    return cache;
+}
+
+std::shared_ptr<const meta::cpp2::StatisItem> StatsCache::get(meta::MetaClient* client,
+                                                              GraphSpaceID space) {
+    auto now = time::WallClock::fastNowInSec();
+    {
+        folly::RWSpinLock::ReadHolder holder(rwlock_);
+        auto found = entries_.find(space);
+        if (found != entries_.end() &&
+            (found->second.refreshing ||
+             now - found->second.updateTime < FLAGS_optimizer_stats_refresh_interval_secs)) {
+            return found->second.stats;
+        }
+    }
+
+    std::shared_ptr<const meta::cpp2::StatisItem> stats;
+    {
+        folly::RWSpinLock::WriteHolder holder(rwlock_);
+        auto& entry = entries_[space];
+        if (entry.refreshing || client == nullptr) {
+            return entry.stats;
+        }
+        entry.refreshing = true;
+        stats = entry.stats;
+    }
+    refresh(client, space);
+    return stats;
+}
+
+void StatsCache::refresh(meta::MetaClient* client, GraphSpaceID space) {
+    client->getStatis(space).thenValue([this, space](StatusOr<meta::cpp2::StatisItem> resp) {
+        folly::RWSpinLock::WriteHolder holder(rwlock_);
+        auto& entry = entries_[space];
+        entry.refreshing = false;
+        // Retry on the next interval even if failed
+        entry.updateTime = time::WallClock::fastNowInSec();
+        if (!resp.ok()) {
+            VLOG(1) << "Refresh the statistics of space " << space
+                    << " failed: " << resp.status();
+            return;
+        }
+        entry.stats = std::make_shared<const meta::cpp2::StatisItem>(std::move(resp).value());
+    });
+}
+
+void StatsCache::set(GraphSpaceID space, meta::cpp2::StatisItem item) {
+    folly::RWSpinLock::WriteHolder holder(rwlock_);
+    auto& entry = entries_[space];
+    entry.stats = std::make_shared<const meta::cpp2::StatisItem>(std::move(item));
+    entry.updateTime = time::WallClock::fastNowInSec();
+    entry.refreshing = false;
+}
+
+void StatsCache::clear() {
+    folly::RWSpinLock::WriteHolder holder(rwlock_);
+    entries_.clear();
+}
+
+// static
+int64_t StatsCache::tagCount(const meta::cpp2::StatisItem* stats, const std::string& tag) {
+    if (stats == nullptr) {
+        return -1;
+    }
+    const auto& tags = stats->get_tag_vertices();
+    auto found = tags.find(tag);
+    return found == tags.end() ? -1 : found->second;
+}
+
+// static
+int64_t StatsCache::edgeCount(const meta::cpp2::StatisItem* stats, const std::string& edge) {
+    if (stats == nullptr) {
+        return -1;
+    }
+    const auto& edges = stats->get_edges();
+    auto found = edges.find(edge);
+    return found == edges.end() ? -1 : found->second;
+}
+
+}   // namespace graph
+}   // namespace nebula
@@ -0,0 +1,57 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef UTIL_STATSCACHE_H_
+#define UTIL_STATSCACHE_H_
+
+#include <folly/RWSpinLock.h>
+
+#include "common/base/Base.h"
+#include "common/clients/meta/MetaClient.h"
+
+namespace nebula {
+namespace graph {
+
+// The space statistics collected by the STATS job, i.e. what SHOW STATS shows, cached to
+// estimate the cardinality of plans. The lookup never waits for the meta service: the missing
+// or stale statistics are refreshed in the background, and the callers fall back to their
+// default estimates meanwhile.
+class StatsCache final {
+public:
+    static StatsCache& instance();
+
+    // nullptr if the statistics of the space are not cached yet
+    std::shared_ptr<const meta::cpp2::StatisItem> get(meta::MetaClient* client,
+                                                      GraphSpaceID space);
+
+    void set(GraphSpaceID space, meta::cpp2::StatisItem item);
+
+    void clear();
+
+    // The count of the vertices with the tag, or the edges of the edge type, in the space.
+    // -1 if unknown.
+    static int64_t tagCount(const meta::cpp2::StatisItem* stats, const std::string& tag);
+    static int64_t edgeCount(const meta::cpp2::StatisItem* stats, const std::string& edge);
+
+private:
+    StatsCache() = default;
+
+    void refresh(meta::MetaClient* client, GraphSpaceID space);
+
+    struct Entry {
+        std::shared_ptr<const meta::cpp2::StatisItem>   stats;
+        int64_t                                         updateTime{0};
+        bool                                            refreshing{false};
+    };
+
+    folly::RWSpinLock                           rwlock_;
+    std::unordered_map<GraphSpaceID, Entry>     entries_;
+};
+
+}   // namespace graph
+}   // namespace nebula
+
+#endif   // UTIL_STATSCACHE_H_
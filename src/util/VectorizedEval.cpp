@@ -0,0 +1,426 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "util/VectorizedEval.h"
+
+#include <functional>
+#include <limits>
+
+#include "common/expression/BinaryExpression.h"
+#include "common/expression/ConstantExpression.h"
+#include "common/expression/LogicalExpression.h"
+#include "common/expression/PropertyExpression.h"
+#include "common/expression/UnaryExpression.h"
+
+namespace nebula {
+namespace graph {
+
+namespace {
+
+using Kind = Expression::Kind;
+using Type = Column::Type;
+
+bool isRelational(Kind kind) {
+    switch (kind) {
+        case Kind::kRelEQ:
+        case Kind::kRelNE:
+        case Kind::kRelLT:
+        case Kind::kRelLE:
+        case Kind::kRelGT:
+        case Kind::kRelGE:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// The result is valid in the rows where both operands are valid
+std::shared_ptr<Column> makeResult(Type type, const Column& lhs, const Column& rhs) {
+    auto result = std::make_shared<Column>(type, lhs.size());
+    auto size = lhs.size();
+    auto* valid = result->valid().data();
+    const auto* l = lhs.valid().data();
+    const auto* r = rhs.valid().data();
+    for (size_t i = 0; i < size; ++i) {
+        valid[i] = l[i] & r[i];
+    }
+    return result;
+}
+
+// Apply `op' to all rows and keep the rows valid only if `op' succeeds. The values of the
+// invalid numeric rows are zero, so `op' is safe to run on them, which keeps the loop
+// free of the branches.
+template <typename T, typename R, typename Op>
+void apply(const std::vector<T>& lhs,
+           const std::vector<T>& rhs,
+           std::vector<R>* result,
+           std::vector<uint8_t>* valid,
+           Op op) {
+    auto size = valid->size();
+    const auto* l = lhs.data();
+    const auto* r = rhs.data();
+    auto* o = result->data();
+    auto* v = valid->data();
+    for (size_t i = 0; i < size; ++i) {
+        v[i] &= op(l[i], r[i], &o[i]);
+    }
+}
+
+template <typename T, typename Op>
+void compare(const std::vector<T>& lhs,
+             const std::vector<T>& rhs,
+             Column* result,
+             Op op) {
+    apply(lhs, rhs, &result->bools(), &result->valid(), [op](T a, T b, uint8_t* o) {
+        *o = op(a, b);
+        return true;
+    });
+}
+
+// The string pointers of the invalid rows are null, so skip them
+template <typename Op>
+void compareStrs(const Column& lhs, const Column& rhs, Column* result, Op op) {
+    auto& bools = result->bools();
+    const auto& valid = result->valid();
+    for (size_t i = 0; i < valid.size(); ++i) {
+        if (valid[i]) {
+            bools[i] = op(lhs.strs()[i]->compare(*rhs.strs()[i]), 0);
+        }
+    }
+}
+
+}   // namespace
+
+// static
+bool VectorizedEval::canEval(const Expression* expr) {
+    switch (expr->kind()) {
+        case Kind::kConstant:
+        case Kind::kInputProperty:
+        case Kind::kVarProperty:
+            return true;
+        case Kind::kAdd:
+        case Kind::kMinus:
+        case Kind::kMultiply:
+        case Kind::kDivision:
+        case Kind::kMod:
+        case Kind::kRelEQ:
+        case Kind::kRelNE:
+        case Kind::kRelLT:
+        case Kind::kRelLE:
+        case Kind::kRelGT:
+        case Kind::kRelGE: {
+            auto* binary = static_cast<const BinaryExpression*>(expr);
+            return canEval(binary->left()) && canEval(binary->right());
+        }
+        case Kind::kLogicalAnd:
+        case Kind::kLogicalOr: {
+            auto* logic = static_cast<const LogicalExpression*>(expr);
+            for (const auto& operand : logic->operands()) {
+                if (!canEval(operand.get())) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        case Kind::kUnaryNot:
+        case Kind::kUnaryNegate:
+            return canEval(static_cast<const UnaryExpression*>(expr)->operand());
+        default:
+            return false;
+    }
+}
+
+// static
+bool VectorizedEval::shouldEval(const Expression* expr) {
+    switch (expr->kind()) {
+        case Kind::kConstant:
+        case Kind::kInputProperty:
+        case Kind::kVarProperty:
+            return false;
+        default:
+            return canEval(expr);
+    }
+}
+
+// static
+std::shared_ptr<const Column> VectorizedEval::eval(const Expression* expr, ColumnBatch* batch) {
+    switch (expr->kind()) {
+        case Kind::kConstant: {
+            auto& val = static_cast<const ConstantExpression*>(expr)->value();
+            return std::make_shared<Column>(Column::constant(val, batch->size()));
+        }
+        case Kind::kInputProperty:
+        case Kind::kVarProperty:
+            return batch->column(*static_cast<const PropertyExpression*>(expr)->prop());
+        case Kind::kAdd:
+        case Kind::kMinus:
+        case Kind::kMultiply:
+        case Kind::kDivision:
+        case Kind::kMod:
+        case Kind::kRelEQ:
+        case Kind::kRelNE:
+        case Kind::kRelLT:
+        case Kind::kRelLE:
+        case Kind::kRelGT:
+        case Kind::kRelGE: {
+            auto* binary = static_cast<const BinaryExpression*>(expr);
+            auto lhs = eval(binary->left(), batch);
+            if (lhs == nullptr) {
+                return nullptr;
+            }
+            auto rhs = eval(binary->right(), batch);
+            if (rhs == nullptr || lhs->type() != rhs->type()) {
+                return nullptr;
+            }
+            if (isRelational(expr->kind())) {
+                return relational(expr->kind(), *lhs, *rhs);
+            }
+            return arithmetic(expr->kind(), *lhs, *rhs);
+        }
+        case Kind::kLogicalAnd:
+        case Kind::kLogicalOr:
+            return logical(expr, batch);
+        case Kind::kUnaryNot:
+        case Kind::kUnaryNegate: {
+            auto operand = eval(static_cast<const UnaryExpression*>(expr)->operand(), batch);
+            if (operand == nullptr) {
+                return nullptr;
+            }
+            return unary(expr->kind(), *operand);
+        }
+        default:
+            return nullptr;
+    }
+}
+
+// static
+std::shared_ptr<const Column> VectorizedEval::arithmetic(Kind kind,
+                                                         const Column& lhs,
+                                                         const Column& rhs) {
+    if (lhs.type() == Type::kInt) {
+        auto result = makeResult(Type::kInt, lhs, rhs);
+        auto* ints = &result->ints();
+        auto* valid = &result->valid();
+        switch (kind) {
+            case Kind::kAdd:
+                apply(lhs.ints(), rhs.ints(), ints, valid, [](int64_t a, int64_t b, int64_t* o) {
+                    return !__builtin_add_overflow(a, b, o);
+                });
+                return result;
+            case Kind::kMinus:
+                apply(lhs.ints(), rhs.ints(), ints, valid, [](int64_t a, int64_t b, int64_t* o) {
+                    return !__builtin_sub_overflow(a, b, o);
+                });
+                return result;
+            case Kind::kMultiply:
+                apply(lhs.ints(), rhs.ints(), ints, valid, [](int64_t a, int64_t b, int64_t* o) {
+                    return !__builtin_mul_overflow(a, b, o);
+                });
+                return result;
+            case Kind::kDivision:
+            case Kind::kMod: {
+                bool isDiv = kind == Kind::kDivision;
+                apply(lhs.ints(), rhs.ints(), ints, valid,
+                      [isDiv](int64_t a, int64_t b, int64_t* o) {
+                          if (b == 0 || (a == std::numeric_limits<int64_t>::min() && b == -1)) {
+                              return false;
+                          }
+                          *o = isDiv ? a / b : a % b;
+                          return true;
+                      });
+                return result;
+            }
+            default:
+                return nullptr;
+        }
+    }
+
+    if (lhs.type() == Type::kFloat) {
+        auto result = makeResult(Type::kFloat, lhs, rhs);
+        auto* floats = &result->floats();
+        auto* valid = &result->valid();
+        switch (kind) {
+            case Kind::kAdd:
+                apply(lhs.floats(), rhs.floats(), floats, valid, [](double a, double b, double* o) {
+                    *o = a + b;
+                    return true;
+                });
+                return result;
+            case Kind::kMinus:
+                apply(lhs.floats(), rhs.floats(), floats, valid, [](double a, double b, double* o) {
+                    *o = a - b;
+                    return true;
+                });
+                return result;
+            case Kind::kMultiply:
+                apply(lhs.floats(), rhs.floats(), floats, valid, [](double a, double b, double* o) {
+                    *o = a * b;
+                    return true;
+                });
+                return result;
+            case Kind::kDivision:
+                apply(lhs.floats(), rhs.floats(), floats, valid, [](double a, double b, double* o) {
+                    *o = b == 0.0 ? 0.0 : a / b;
+                    return b != 0.0;
+                });
+                return result;
+            default:
+                return nullptr;
+        }
+    }
+
+    return nullptr;
+}
+
+// static
+std::shared_ptr<const Column> VectorizedEval::relational(Kind kind,
+                                                         const Column& lhs,
+                                                         const Column& rhs) {
+    auto result = makeResult(Type::kBool, lhs, rhs);
+    switch (lhs.type()) {
+        case Type::kInt:
+            switch (kind) {
+                case Kind::kRelEQ:
+                    compare(lhs.ints(), rhs.ints(), result.get(), std::equal_to<int64_t>());
+                    return result;
+                case Kind::kRelNE:
+                    compare(lhs.ints(), rhs.ints(), result.get(), std::not_equal_to<int64_t>());
+                    return result;
+                case Kind::kRelLT:
+                    compare(lhs.ints(), rhs.ints(), result.get(), std::less<int64_t>());
+                    return result;
+                case Kind::kRelLE:
+                    compare(lhs.ints(), rhs.ints(), result.get(), std::less_equal<int64_t>());
+                    return result;
+                case Kind::kRelGT:
+                    compare(lhs.ints(), rhs.ints(), result.get(), std::greater<int64_t>());
+                    return result;
+                case Kind::kRelGE:
+                    compare(lhs.ints(), rhs.ints(), result.get(), std::greater_equal<int64_t>());
+                    return result;
+                default:
+                    return nullptr;
+            }
+        case Type::kFloat:
+            // The equality of floats is decided with the epsilon by Value, so leave them
+            switch (kind) {
+                case Kind::kRelLT:
+                    compare(lhs.floats(), rhs.floats(), result.get(), std::less<double>());
+                    return result;
+                case Kind::kRelGT:
+                    compare(lhs.floats(), rhs.floats(), result.get(), std::greater<double>());
+                    return result;
+                default:
+                    return nullptr;
+            }
+        case Type::kBool:
+            switch (kind) {
+                case Kind::kRelEQ:
+                    compare(lhs.bools(), rhs.bools(), result.get(), std::equal_to<uint8_t>());
+                    return result;
+                case Kind::kRelNE:
+                    compare(lhs.bools(), rhs.bools(), result.get(), std::not_equal_to<uint8_t>());
+                    return result;
+                default:
+                    return nullptr;
+            }
+        case Type::kString:
+            switch (kind) {
+                case Kind::kRelEQ:
+                    compareStrs(lhs, rhs, result.get(), std::equal_to<int>());
+                    return result;
+                case Kind::kRelNE:
+                    compareStrs(lhs, rhs, result.get(), std::not_equal_to<int>());
+                    return result;
+                case Kind::kRelLT:
+                    compareStrs(lhs, rhs, result.get(), std::less<int>());
+                    return result;
+                case Kind::kRelLE:
+                    compareStrs(lhs, rhs, result.get(), std::less_equal<int>());
+                    return result;
+                case Kind::kRelGT:
+                    compareStrs(lhs, rhs, result.get(), std::greater<int>());
+                    return result;
+                case Kind::kRelGE:
+                    compareStrs(lhs, rhs, result.get(), std::greater_equal<int>());
+                    return result;
+                default:
+                    return nullptr;
+            }
+    }
+    return nullptr;
+}
+
+// static
+std::shared_ptr<const Column> VectorizedEval::logical(const Expression* expr,
+                                                      ColumnBatch* batch) {
+    auto* logic = static_cast<const LogicalExpression*>(expr);
+    bool isAnd = expr->kind() == Kind::kLogicalAnd;
+    std::shared_ptr<Column> result;
+    for (const auto& operand : logic->operands()) {
+        auto column = eval(operand.get(), batch);
+        if (column == nullptr || column->type() != Type::kBool) {
+            return nullptr;
+        }
+        if (result == nullptr) {
+            result = std::make_shared<Column>(*column);
+            continue;
+        }
+        // Any invalid operand makes the row invalid, the short circuit of the nulls is left to
+        // the row by row evaluation
+        auto& valid = result->valid();
+        auto* bools = &result->bools();
+        if (isAnd) {
+            apply(*bools, column->bools(), bools, &valid, [](uint8_t a, uint8_t b, uint8_t* o) {
+                *o = a & b;
+                return true;
+            });
+        } else {
+            apply(*bools, column->bools(), bools, &valid, [](uint8_t a, uint8_t b, uint8_t* o) {
+                *o = a | b;
+                return true;
+            });
+        }
+        const auto* v = column->valid().data();
+        for (size_t i = 0; i < valid.size(); ++i) {
+            valid[i] &= v[i];
+        }
+    }
+    return result;
+}
+
+// static
+std::shared_ptr<const Column> VectorizedEval::unary(Kind kind, const Column& operand) {
+    auto result = std::make_shared<Column>(operand);
+    auto size = result->size();
+    auto* valid = result->valid().data();
+    if (kind == Kind::kUnaryNot && operand.type() == Type::kBool) {
+        auto* bools = result->bools().data();
+        for (size_t i = 0; i < size; ++i) {
+            bools[i] = !bools[i];
+        }
+        return result;
+    }
+    if (kind == Kind::kUnaryNegate && operand.type() == Type::kInt) {
+        auto* ints = result->ints().data();
+        for (size_t i = 0; i < size; ++i) {
+            valid[i] &= ints[i] != std::numeric_limits<int64_t>::min();
+            ints[i] = valid[i] ? -ints[i] : 0;
+        }
+        return result;
+    }
+    if (kind == Kind::kUnaryNegate && operand.type() == Type::kFloat) {
+        auto* floats = result->floats().data();
+        for (size_t i = 0; i < size; ++i) {
+            floats[i] = -floats[i];
+        }
+        return result;
+    }
+    return nullptr;
+}
+
+}   // namespace graph
+}   // namespace nebula
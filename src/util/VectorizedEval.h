@@ -0,0 +1,53 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef UTIL_VECTORIZEDEVAL_H_
+#define UTIL_VECTORIZEDEVAL_H_
+
+#include "common/expression/Expression.h"
+
+#include "context/ColumnBatch.h"
+
+namespace nebula {
+namespace graph {
+
+// Evaluate an expression over the columns of a batch of rows at once instead of row by row.
+// The constant, input/variable property, arithmetic, relational and logical expressions are
+// supported, and the kernels are plain loops over the typed vectors which the compiler
+// vectorizes. A row is left invalid in the result when the kernel can't decide it, e.g. for
+// the null operands, the overflow or the division by zero, and the caller must evaluate such
+// rows by Expression::eval, so the results are always the same as the row by row evaluation.
+class VectorizedEval final {
+public:
+    explicit VectorizedEval(...) = delete;
+
+    static bool canEval(const Expression* expr);
+
+    // Whether the expression is supported and computes something, a plain property or constant
+    // gains nothing from the columns.
+    static bool shouldEval(const Expression* expr);
+
+    // nullptr if the operands are not of the types the kernels expect
+    static std::shared_ptr<const Column> eval(const Expression* expr, ColumnBatch* batch);
+
+private:
+    static std::shared_ptr<const Column> arithmetic(Expression::Kind kind,
+                                                    const Column& lhs,
+                                                    const Column& rhs);
+
+    static std::shared_ptr<const Column> relational(Expression::Kind kind,
+                                                    const Column& lhs,
+                                                    const Column& rhs);
+
+    static std::shared_ptr<const Column> logical(const Expression* expr, ColumnBatch* batch);
+
+    static std::shared_ptr<const Column> unary(Expression::Kind kind, const Column& operand);
+};
+
+}   // namespace graph
+}   // namespace nebula
+
+#endif   // UTIL_VECTORIZEDEVAL_H_
@@ -0,0 +1,26 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include "util/VidInterner.h"
+
+namespace nebula {
+namespace graph {
+
+uint32_t VidInterner::intern(const Value& vid) {
+    auto result = ids_.emplace(vid, static_cast<uint32_t>(vids_.size()));
+    if (result.second) {
+        vids_.emplace_back(&result.first->first);
+    }
+    return result.first->second;
+}
+
+uint32_t VidInterner::find(const Value& vid) const {
+    auto found = ids_.find(vid);
+    return found == ids_.end() ? kNotFound : found->second;
+}
+
+}   // namespace graph
+}   // namespace nebula
@@ -0,0 +1,71 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#ifndef UTIL_VIDINTERNER_H_
+#define UTIL_VIDINTERNER_H_
+
+#include "common/base/Base.h"
+#include "common/datatypes/Value.h"
+
+namespace nebula {
+namespace graph {
+
+// Map the vids to the dense ids in the order they are met, so the states of the vertices can
+// be kept in the flat arrays and bitmaps indexed by the ids instead of the copies of the vids.
+// Interning a vid still hashes it as a set of the vids would, the executors intern the vid of
+// a vertex once for all its edges. It's not thread-safe, each traversal executor keeps its own
+// one for the whole query.
+class VidInterner final {
+public:
+    static constexpr uint32_t kNotFound = std::numeric_limits<uint32_t>::max();
+
+    uint32_t intern(const Value& vid);
+
+    // kNotFound if the vid was never interned
+    uint32_t find(const Value& vid) const;
+
+    const Value& vid(uint32_t id) const {
+        DCHECK_LT(id, vids_.size());
+        return *vids_[id];
+    }
+
+    size_t size() const {
+        return vids_.size();
+    }
+
+private:
+    // The nodes of the map are stable, so the vids are kept only once
+    std::unordered_map<Value, uint32_t> ids_;
+    std::vector<const Value*> vids_;
+};
+
+// The set of the vertices by their dense ids
+class VidBitmap final {
+public:
+    // Returns false if the id is in the set already
+    bool insert(uint32_t id) {
+        if (id >= bits_.size()) {
+            bits_.resize(std::max<size_t>(id + 1, bits_.size() * 2), false);
+        }
+        if (bits_[id]) {
+            return false;
+        }
+        bits_[id] = true;
+        return true;
+    }
+
+    bool contains(uint32_t id) const {
+        return id < bits_.size() && bits_[id];
+    }
+
+private:
+    std::vector<bool> bits_;
+};
+
+}   // namespace graph
+}   // namespace nebula
+
+#endif   // UTIL_VIDINTERNER_H_
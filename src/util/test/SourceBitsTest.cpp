@@ -0,0 +1,78 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include <gtest/gtest.h>
+
+#include "util/SourceBits.h"
+
+namespace nebula {
+namespace graph {
+
+TEST(SourceBitsTest, SetAndTest) {
+    SourceBits bits;
+    EXPECT_FALSE(bits.any());
+    bits.set(1);
+    bits.set(64);
+    bits.set(130);
+    EXPECT_TRUE(bits.any());
+    EXPECT_TRUE(bits.test(1));
+    EXPECT_TRUE(bits.test(64));
+    EXPECT_TRUE(bits.test(130));
+    EXPECT_FALSE(bits.test(0));
+    EXPECT_FALSE(bits.test(63));
+    EXPECT_FALSE(bits.test(1000));
+    EXPECT_EQ(bits.indexes(), std::vector<size_t>({1, 64, 130}));
+}
+
+TEST(SourceBitsTest, Operations) {
+    SourceBits lhs;
+    lhs.set(0);
+    lhs.set(65);
+    SourceBits rhs;
+    rhs.set(0);
+    rhs.set(3);
+    {
+        auto bits = lhs.minus(rhs);
+        EXPECT_EQ(bits.indexes(), std::vector<size_t>({65}));
+        EXPECT_TRUE(rhs.minus(rhs).indexes().empty());
+        EXPECT_FALSE(rhs.minus(rhs).any());
+    }
+    {
+        auto bits = rhs;
+        bits |= lhs;
+        EXPECT_EQ(bits.indexes(), std::vector<size_t>({0, 3, 65}));
+    }
+    {
+        // The missing words are zeros
+        auto bits = rhs.minus(lhs);
+        SourceBits expected;
+        expected.set(3);
+        EXPECT_EQ(bits, expected);
+    }
+    {
+        EXPECT_TRUE(lhs.intersects(rhs));
+        SourceBits bits;
+        bits.set(3);
+        EXPECT_FALSE(bits.intersects(lhs));
+        EXPECT_FALSE(lhs.intersects(SourceBits()));
+    }
+}
+
+TEST(SourceBitsTest, Encode) {
+    SourceBits bits;
+    EXPECT_EQ(SourceBits::decode(bits.encode()), bits);
+    bits.set(7);
+    bits.set(200);
+    auto decoded = SourceBits::decode(bits.encode());
+    EXPECT_EQ(decoded, bits);
+    EXPECT_EQ(decoded.indexes(), std::vector<size_t>({7, 200}));
+    // The trailing zero words are dropped
+    auto minus = bits.minus(SourceBits::decode(decoded.encode()));
+    EXPECT_TRUE(minus.encode().empty());
+}
+
+}   // namespace graph
+}   // namespace nebula
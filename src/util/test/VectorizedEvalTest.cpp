@@ -0,0 +1,140 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include <gtest/gtest.h>
+#include <limits>
+
+#include "common/expression/ArithmeticExpression.h"
+#include "common/expression/ConstantExpression.h"
+#include "common/expression/FunctionCallExpression.h"
+#include "common/expression/LogicalExpression.h"
+#include "common/expression/PropertyExpression.h"
+#include "common/expression/RelationalExpression.h"
+#include "common/expression/UnaryExpression.h"
+#include "util/VectorizedEval.h"
+
+namespace nebula {
+namespace graph {
+
+class VectorizedEvalTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        DataSet ds({"a", "b", "s"});
+        ds.emplace_back(Row({1, 2, "x"}));
+        ds.emplace_back(Row({Value::kNullValue, 3, "y"}));
+        ds.emplace_back(Row({std::numeric_limits<int64_t>::max(), 0, "z"}));
+        ds.emplace_back(Row({-4, -2, Value::kNullValue}));
+        iter_ = std::make_unique<SequentialIter>(std::make_shared<Value>(std::move(ds)));
+    }
+
+protected:
+    static Expression* prop(const std::string& name) {
+        return new InputPropertyExpression(new std::string(name));
+    }
+
+    std::unique_ptr<Iterator> iter_;
+};
+
+TEST_F(VectorizedEvalTest, CanEval) {
+    {
+        auto expr = std::make_unique<ArithmeticExpression>(
+            Expression::Kind::kAdd, prop("a"), new ConstantExpression(1));
+        EXPECT_TRUE(VectorizedEval::canEval(expr.get()));
+        EXPECT_TRUE(VectorizedEval::shouldEval(expr.get()));
+    }
+    {
+        auto expr = std::unique_ptr<Expression>(prop("a"));
+        EXPECT_TRUE(VectorizedEval::canEval(expr.get()));
+        EXPECT_FALSE(VectorizedEval::shouldEval(expr.get()));
+    }
+    {
+        auto expr = std::make_unique<RelationalExpression>(
+            Expression::Kind::kRelLT,
+            prop("a"),
+            new FunctionCallExpression(new std::string("abs"),
+                                       new ArgumentList()));
+        EXPECT_FALSE(VectorizedEval::canEval(expr.get()));
+    }
+}
+
+TEST_F(VectorizedEvalTest, Arithmetic) {
+    ColumnBatch batch(iter_.get());
+    {
+        // a + b
+        auto expr = std::make_unique<ArithmeticExpression>(
+            Expression::Kind::kAdd, prop("a"), prop("b"));
+        auto result = VectorizedEval::eval(expr.get(), &batch);
+        ASSERT_NE(result, nullptr);
+        EXPECT_EQ(result->type(), Column::Type::kInt);
+        EXPECT_EQ(result->value(0), Value(3));
+        // null
+        EXPECT_FALSE(result->isValid(1));
+        EXPECT_EQ(result->value(2), Value(std::numeric_limits<int64_t>::max()));
+        EXPECT_EQ(result->value(3), Value(-6));
+    }
+    {
+        // a * 2, overflow
+        auto expr = std::make_unique<ArithmeticExpression>(
+            Expression::Kind::kMultiply, prop("a"), new ConstantExpression(2));
+        auto result = VectorizedEval::eval(expr.get(), &batch);
+        ASSERT_NE(result, nullptr);
+        EXPECT_EQ(result->value(0), Value(2));
+        EXPECT_FALSE(result->isValid(2));
+        EXPECT_EQ(result->value(3), Value(-8));
+    }
+    {
+        // a / b, division by zero
+        auto expr = std::make_unique<ArithmeticExpression>(
+            Expression::Kind::kDivision, prop("a"), prop("b"));
+        auto result = VectorizedEval::eval(expr.get(), &batch);
+        ASSERT_NE(result, nullptr);
+        EXPECT_EQ(result->value(0), Value(0));
+        EXPECT_FALSE(result->isValid(2));
+        EXPECT_EQ(result->value(3), Value(2));
+    }
+    {
+        // a + 1.5, not the same type
+        auto expr = std::make_unique<ArithmeticExpression>(
+            Expression::Kind::kAdd, prop("a"), new ConstantExpression(1.5));
+        EXPECT_EQ(VectorizedEval::eval(expr.get(), &batch), nullptr);
+    }
+}
+
+TEST_F(VectorizedEvalTest, Predicate) {
+    ColumnBatch batch(iter_.get());
+    {
+        // a < b AND s != "z"
+        auto expr = std::make_unique<LogicalExpression>(
+            Expression::Kind::kLogicalAnd,
+            new RelationalExpression(Expression::Kind::kRelLT, prop("a"), prop("b")),
+            new RelationalExpression(
+                Expression::Kind::kRelNE, prop("s"), new ConstantExpression("z")));
+        auto result = VectorizedEval::eval(expr.get(), &batch);
+        ASSERT_NE(result, nullptr);
+        EXPECT_EQ(result->type(), Column::Type::kBool);
+        EXPECT_EQ(result->value(0), Value(true));
+        EXPECT_FALSE(result->isValid(1));
+        EXPECT_EQ(result->value(2), Value(false));
+        EXPECT_FALSE(result->isValid(3));
+    }
+    {
+        // NOT (b >= 2)
+        auto expr = std::make_unique<UnaryExpression>(
+            Expression::Kind::kUnaryNot,
+            new RelationalExpression(
+                Expression::Kind::kRelGE, prop("b"), new ConstantExpression(2)));
+        auto result = VectorizedEval::eval(expr.get(), &batch);
+        ASSERT_NE(result, nullptr);
+        ASSERT_TRUE(result->allValid());
+        EXPECT_EQ(result->value(0), Value(false));
+        EXPECT_EQ(result->value(1), Value(false));
+        EXPECT_EQ(result->value(2), Value(true));
+        EXPECT_EQ(result->value(3), Value(true));
+    }
+}
+
+}   // namespace graph
+}   // namespace nebula
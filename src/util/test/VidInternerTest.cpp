@@ -0,0 +1,42 @@
+/* Copyright (c) 2020 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License,
+ * attached with Common Clause Condition 1.0, found in the LICENSES directory.
+ */
+
+#include <gtest/gtest.h>
+
+#include "util/VidInterner.h"
+
+namespace nebula {
+namespace graph {
+
+TEST(VidInternerTest, Intern) {
+    VidInterner interner;
+    EXPECT_EQ(interner.find("a"), VidInterner::kNotFound);
+    EXPECT_EQ(interner.intern("a"), 0u);
+    EXPECT_EQ(interner.intern(1), 1u);
+    EXPECT_EQ(interner.intern("b"), 2u);
+    EXPECT_EQ(interner.intern("a"), 0u);
+    EXPECT_EQ(interner.find(1), 1u);
+    EXPECT_EQ(interner.find("c"), VidInterner::kNotFound);
+    EXPECT_EQ(interner.size(), 3u);
+    EXPECT_EQ(interner.vid(0), Value("a"));
+    EXPECT_EQ(interner.vid(1), Value(1));
+    EXPECT_EQ(interner.vid(2), Value("b"));
+}
+
+TEST(VidInternerTest, Bitmap) {
+    VidBitmap bitmap;
+    EXPECT_FALSE(bitmap.contains(0));
+    EXPECT_TRUE(bitmap.insert(3));
+    EXPECT_FALSE(bitmap.insert(3));
+    EXPECT_TRUE(bitmap.insert(100));
+    EXPECT_TRUE(bitmap.contains(3));
+    EXPECT_TRUE(bitmap.contains(100));
+    EXPECT_FALSE(bitmap.contains(4));
+    EXPECT_FALSE(bitmap.contains(1000));
+}
+
+}   // namespace graph
+}   // namespace nebula
@@ -315,6 +315,17 @@ Status ShowCharsetValidator::toPlan() {
     return Status::OK();
 }
 
+Status ShowQueriesValidator::validateImpl() {
+    return Status::OK();
+}
+
+Status ShowQueriesValidator::toPlan() {
+    auto *node = ShowQueries::make(qctx_, nullptr);
+    root_ = node;
+    tail_ = root_;
+    return Status::OK();
+}
+
 Status ShowCollationValidator::validateImpl() {
     return Status::OK();
 }
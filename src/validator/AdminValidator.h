@@ -203,6 +203,19 @@ private:
     Status toPlan() override;
 };
 
+class ShowQueriesValidator final : public Validator {
+public:
+    ShowQueriesValidator(Sentence* sentence, QueryContext* context)
+        : Validator(sentence, context) {
+        setNoSpaceRequired();
+    }
+
+private:
+    Status validateImpl() override;
+
+    Status toPlan() override;
+};
+
 class ShowCollationValidator final : public Validator {
 public:
     ShowCollationValidator(Sentence* sentence, QueryContext* context)
@@ -9,6 +9,7 @@
 #include "common/expression/VariableExpression.h"
 #include "planner/Algo.h"
 #include "planner/Logic.h"
+#include "util/SchemaUtil.h"
 
 namespace nebula {
 namespace graph {
@@ -21,12 +22,54 @@ Status FindPathValidator::validateImpl() {
     NG_RETURN_IF_ERROR(validateStarts(fpSentence->to(), to_));
     NG_RETURN_IF_ERROR(validateOver(fpSentence->over(), over_));
     NG_RETURN_IF_ERROR(validateStep(fpSentence->step(), steps_));
+    NG_RETURN_IF_ERROR(validateWeight(fpSentence->weight()));
 
     outputs_.emplace_back("path", Value::Type::PATH);
     return Status::OK();
 }
 
+Status FindPathValidator::validateWeight(const WeightClause* clause) {
+    if (clause == nullptr) {
+        return Status::OK();
+    }
+    const auto& edgeName = *clause->edge();
+    const auto& prop = *clause->prop();
+    auto* schemaMng = qctx_->schemaMng();
+    auto edgeType = schemaMng->toEdgeType(space_.id, edgeName);
+    if (!edgeType.ok()) {
+        return Status::SemanticError("%s not found in space [%s].",
+                                     edgeName.c_str(), space_.name.c_str());
+    }
+    for (auto type : over_.edgeTypes) {
+        if (type != edgeType.value()) {
+            return Status::SemanticError("Only the edge `%s' could be over when weighted by it",
+                                         edgeName.c_str());
+        }
+    }
+    auto schema = schemaMng->getEdgeSchema(space_.id, edgeType.value());
+    if (schema == nullptr) {
+        return Status::SemanticError("No schema found for `%s'", edgeName.c_str());
+    }
+    auto propType = schema->getFieldType(prop);
+    if (propType == meta::cpp2::PropertyType::UNKNOWN) {
+        return Status::SemanticError("`%s' not found in edge `%s'",
+                                     prop.c_str(), edgeName.c_str());
+    }
+    auto valueType = SchemaUtil::propTypeToValueType(propType);
+    if (valueType != Value::Type::INT && valueType != Value::Type::FLOAT) {
+        return Status::SemanticError("The weight `%s.%s' should be numeric",
+                                     edgeName.c_str(), prop.c_str());
+    }
+    isWeight_ = true;
+    weightProp_ = prop;
+    return Status::OK();
+}
+
 Status FindPathValidator::toPlan() {
+    if (isWeight_) {
+        // The hops of the paths don't tell their weights
+        return multiPairPlan();
+    }
     if (!isShortest_ || noLoop_) {
         return allPairPaths();
     }
@@ -53,21 +96,29 @@ void FindPathValidator::buildStart(Starts& starts,
 }
 
 Status FindPathValidator::singlePairPlan() {
-    auto* bodyStart = StartNode::make(qctx_);
-    auto* passThrough = PassThroughNode::make(qctx_, bodyStart);
-
+    // Only the side of the smaller frontier expands in each iteration
+    std::string fromStartVidsVar;
     std::string fromPathVar;
-    auto* forward = bfs(passThrough, from_, fromPathVar, false);
+    auto* forward = bfs(StartNode::make(qctx_), from_, fromStartVidsVar, fromPathVar, false);
     VLOG(1) << "forward: " << fromPathVar;
 
+    std::string toStartVidsVar;
     std::string toPathVar;
-    auto* backward = bfs(passThrough, to_, toPathVar, true);
+    auto* backward = bfs(StartNode::make(qctx_), to_, toStartVidsVar, toPathVar, true);
     VLOG(1) << "backward: " << toPathVar;
 
+    auto* bodyStart = StartNode::make(qctx_);
+    auto* select = Select::make(qctx_,
+                                bodyStart,
+                                forward,
+                                backward,
+                                buildBfsDirectionCondition(fromStartVidsVar, toStartVidsVar));
+
     auto* conjunct =
-        ConjunctPath::make(qctx_, forward, backward, ConjunctPath::PathKind::kBiBFS, steps_.steps);
+        ConjunctPath::make(qctx_, select, select, ConjunctPath::PathKind::kBiBFS, steps_.steps);
     conjunct->setLeftVar(fromPathVar);
     conjunct->setRightVar(toPathVar);
+    conjunct->setDirectionVar(select->outputVar());
     conjunct->setColNames({"_path"});
 
     auto* loop = Loop::make(
@@ -84,9 +135,9 @@ Status FindPathValidator::singlePairPlan() {
 
 PlanNode* FindPathValidator::bfs(PlanNode* dep,
                                  Starts& starts,
+                                 std::string& startVidsVar,
                                  std::string& pathVar,
                                  bool reverse) {
-    std::string startVidsVar;
     buildConstantInput(starts, startVidsVar);
 
     auto* gn = GetNeighbors::make(qctx_, dep, space_.id);
@@ -123,8 +174,21 @@ PlanNode* FindPathValidator::bfs(PlanNode* dep,
     return dedup;
 }
 
+Expression* FindPathValidator::buildBfsDirectionCondition(const std::string& fromStartVidsVar,
+                                                          const std::string& toStartVidsVar) {
+    // size(fromStartVidsVar) <= size(toStartVidsVar)
+    auto* fromArgs = new ArgumentList();
+    fromArgs->addArgument(std::make_unique<VariableExpression>(new std::string(fromStartVidsVar)));
+    auto* toArgs = new ArgumentList();
+    toArgs->addArgument(std::make_unique<VariableExpression>(new std::string(toStartVidsVar)));
+    return qctx_->objPool()->add(
+        new RelationalExpression(Expression::Kind::kRelLE,
+                                 new FunctionCallExpression(new std::string("size"), fromArgs),
+                                 new FunctionCallExpression(new std::string("size"), toArgs)));
+}
+
 Expression* FindPathValidator::buildBfsLoopCondition(uint32_t steps, const std::string& pathVar) {
-    // ++loopSteps{0} <= (steps/2+steps%2) && size(pathVar) == 0
+    // ++loopSteps{0} <= steps && size(pathVar) == 0
     auto loopSteps = vctx_->anonVarGen()->getVar();
     qctx_->ectx()->setValue(loopSteps, 0);
 
@@ -133,7 +197,7 @@ Expression* FindPathValidator::buildBfsLoopCondition(uint32_t steps, const std::
         new UnaryExpression(
             Expression::Kind::kUnaryIncr,
             new VersionedVariableExpression(new std::string(loopSteps), new ConstantExpression(0))),
-        new ConstantExpression(static_cast<int32_t>(steps / 2 + steps % 2)));
+        new ConstantExpression(static_cast<int32_t>(steps)));
 
     auto* args = new ArgumentList();
     args->addArgument(std::make_unique<VariableExpression>(new std::string(pathVar)));
@@ -161,7 +225,11 @@ void FindPathValidator::buildEdgeProps(GetNeighbors::EdgeProps& edgeProps,
         } else {
             ep.set_type(-e);
         }
-        ep.set_props({kDst, kType, kRank});
+        std::vector<std::string> props = {kDst, kType, kRank};
+        if (isWeight_) {
+            props.emplace_back(weightProp_);
+        }
+        ep.set_props(std::move(props));
         edgeProps->emplace_back(std::move(ep));
     }
 }
@@ -376,8 +444,10 @@ Status FindPathValidator::multiPairPlan() {
     auto* backward = multiPairShortestPath(passThrough, to_, toStartVidsVar, toPathVar, true);
     VLOG(1) << "backward: " << toPathVar;
 
-    auto* conjunct =
-        ConjunctPath::make(qctx_, forward, backward, ConjunctPath::PathKind::kFloyd, steps_.steps);
+    // The unweighted one tracks the starts reaching each vertex instead of the paths
+    auto pathKind = isWeight_ ? ConjunctPath::PathKind::kBiLabelCorrecting
+                              : ConjunctPath::PathKind::kMultiSourceBFS;
+    auto* conjunct = ConjunctPath::make(qctx_, forward, backward, pathKind, steps_.steps);
 
     conjunct->setLeftVar(fromPathVar);
     conjunct->setRightVar(toPathVar);
@@ -386,27 +456,42 @@ Status FindPathValidator::multiPairPlan() {
     PlanNode* projectFromDep = nullptr;
     linkLoopDepFromTo(projectFromDep);
 
-    auto* projectFrom = buildMultiPairFirstDataSet(projectFromDep, fromStartVidsVar, fromPathVar);
-    auto* projectTo = buildMultiPairFirstDataSet(projectFrom, toStartVidsVar, toPathVar);
+    PlanNode* projectFrom = nullptr;
+    PlanNode* cartesianProductDep = projectFromDep;
+    if (isWeight_) {
+        projectFrom = buildMultiPairFirstDataSet(projectFromDep, fromStartVidsVar, fromPathVar);
+        cartesianProductDep = buildMultiPairFirstDataSet(projectFrom, toStartVidsVar, toPathVar);
+    }
 
-    auto* cartesianProduct = CartesianProduct::make(qctx_, projectTo);
+    auto* cartesianProduct = CartesianProduct::make(qctx_, cartesianProductDep);
     NG_RETURN_IF_ERROR(cartesianProduct->addVar(fromStartVidsVar));
     NG_RETURN_IF_ERROR(cartesianProduct->addVar(toStartVidsVar));
 
     conjunct->setConditionalVar(cartesianProduct->outputVar());
+    if (!isWeight_) {
+        // The BFS stops as soon as no more shortest paths could be found
+        auto terminationVar = vctx_->anonVarGen()->getVar();
+        qctx_->ectx()->setValue(terminationVar, false);
+        conjunct->setTerminationVar(terminationVar);
+        conjunct->setFrontierVars(fromStartVidsVar, toStartVidsVar);
+    }
 
     auto* loop =
         Loop::make(qctx_,
                    cartesianProduct,
                    conjunct,
-                   buildMultiPairLoopCondition(steps_.steps, cartesianProduct->outputVar()));
+                   buildMultiPairLoopCondition(steps_.steps, conjunct->terminationVar()));
 
     auto* dataCollect = DataCollect::make(
         qctx_, loop, DataCollect::CollectKind::kMultiplePairShortest, {conjunct->outputVar()});
     dataCollect->setColNames({"path"});
 
     root_ = dataCollect;
-    tail_ = loopDepTail_ == nullptr ? projectFrom : loopDepTail_;
+    if (loopDepTail_ != nullptr) {
+        tail_ = loopDepTail_;
+    } else {
+        tail_ = isWeight_ ? projectFrom : cartesianProduct;
+    }
     return Status::OK();
 }
 
@@ -421,7 +506,13 @@ PlanNode* FindPathValidator::multiPairShortestPath(PlanNode* dep,
     gn->setInputVar(startVidsVar);
 
     auto* pssp = ProduceSemiShortestPath::make(qctx_, gn);
-    pssp->setColNames({kDst, kSrc, "cost", "paths"});
+    if (isWeight_) {
+        pssp->setColNames({kDst, kSrc, "cost", "paths"});
+        pssp->setWeightProp(weightProp_);
+    } else {
+        pssp->setColNames({kDst, "edge", "sources"});
+        pssp->setTrackSources(true);
+    }
     pathVar = pssp->outputVar();
 
     auto* columns = qctx_->objPool()->add(new YieldColumns());
@@ -441,8 +532,9 @@ PlanNode* FindPathValidator::multiPairShortestPath(PlanNode* dep,
 }
 
 Expression* FindPathValidator::buildMultiPairLoopCondition(uint32_t steps,
-                                                           std::string conditionalVar) {
-    // (++loopSteps{0} <= steps/2+steps%2) && (isWeight_ == true || size(conditionalVar) == 0)
+                                                           const std::string& terminationVar) {
+    // (++loopSteps{0} <= steps/2+steps%2) && !terminationVar, the weighted one can't tell
+    // whether the cheaper paths are still to be found, so it has no termination variable.
     auto loopSteps = vctx_->anonVarGen()->getVar();
     qctx_->ectx()->setValue(loopSteps, 0);
 
@@ -452,22 +544,14 @@ Expression* FindPathValidator::buildMultiPairLoopCondition(uint32_t steps,
             Expression::Kind::kUnaryIncr,
             new VersionedVariableExpression(new std::string(loopSteps), new ConstantExpression(0))),
         new ConstantExpression(static_cast<int32_t>(steps / 2 + steps % 2)));
+    if (terminationVar.empty()) {
+        return qctx_->objPool()->add(nSteps);
+    }
 
-    auto* args = new ArgumentList();
-    args->addArgument(std::make_unique<VariableExpression>(new std::string(conditionalVar)));
-    auto* notAllPathFind =
-        new RelationalExpression(Expression::Kind::kRelEQ,
-                                 new FunctionCallExpression(new std::string("size"), args),
-                                 new ConstantExpression(0));
-
-    auto* terminationCondition =
-        new LogicalExpression(Expression::Kind::kLogicalOr,
-                              new RelationalExpression(Expression::Kind::kRelEQ,
-                                                       new ConstantExpression(isWeight_),
-                                                       new ConstantExpression(true)),
-                              notAllPathFind);
+    auto* notTerminated = new UnaryExpression(
+        Expression::Kind::kUnaryNot, new VariableExpression(new std::string(terminationVar)));
     auto* condition =
-        new LogicalExpression(Expression::Kind::kLogicalAnd, nSteps, terminationCondition);
+        new LogicalExpression(Expression::Kind::kLogicalAnd, nSteps, notTerminated);
 
     return qctx_->objPool()->add(condition);
 }
@@ -22,14 +22,23 @@ private:
     Status validateImpl() override;
 
     Status toPlan() override;
+
+    Status validateWeight(const WeightClause* clause);
+
     void buildEdgeProps(GetNeighbors::EdgeProps& edgeProps, bool reverse, bool isInEdge);
     void buildStart(Starts& starts, std::string& startVidsVar, bool reverse);
     GetNeighbors::EdgeProps buildEdgeKey(bool reverse);
     void linkLoopDepFromTo(PlanNode*& projectDep);
     // bfs
     Status singlePairPlan();
-    PlanNode* bfs(PlanNode* dep, Starts& starts, std::string& pathVar, bool reverse);
+    PlanNode* bfs(PlanNode* dep,
+                  Starts& starts,
+                  std::string& startVidsVar,
+                  std::string& pathVar,
+                  bool reverse);
     Expression* buildBfsLoopCondition(uint32_t steps, const std::string& pathVar);
+    Expression* buildBfsDirectionCondition(const std::string& fromStartVidsVar,
+                                           const std::string& toStartVidsVar);
 
     // allPath
     Status allPairPaths();
@@ -50,7 +59,7 @@ private:
                                     std::string& startVidsVar,
                                     std::string& pathVar,
                                     bool reverse);
-    Expression* buildMultiPairLoopCondition(uint32_t steps, std::string conditionalVar);
+    Expression* buildMultiPairLoopCondition(uint32_t steps, const std::string& terminationVar);
     PlanNode* buildMultiPairFirstDataSet(PlanNode* dep,
                                          const std::string& inputVar,
                                          const std::string& outputVar);
@@ -58,6 +67,8 @@ private:
 private:
     bool isShortest_{false};
     bool isWeight_{false};
+    // The prop of the only edge over to weight the paths by
+    std::string weightProp_;
     bool noLoop_{false};
     Starts to_;
     Over over_;
@@ -25,6 +25,7 @@ Status GoValidator::validateImpl() {
     NG_RETURN_IF_ERROR(validateOver(goSentence->overClause(), over_));
     NG_RETURN_IF_ERROR(validateWhere(goSentence->whereClause()));
     NG_RETURN_IF_ERROR(validateYield(goSentence->yieldClause()));
+    NG_RETURN_IF_ERROR(validateTruncate(goSentence->truncateClause()));
 
     if (!exprProps_.inputProps().empty() && from_.fromType != kPipe) {
         return Status::SemanticError("$- must be referred in FROM before used in WHERE or YIELD");
@@ -137,6 +138,28 @@ Status GoValidator::validateYield(YieldClause* yield) {
     return Status::OK();
 }
 
+Status GoValidator::validateTruncate(const TruncateClause* truncate) {
+    if (truncate == nullptr) {
+        return Status::OK();
+    }
+    const auto& limits = truncate->limits();
+    auto steps = steps_.mToN == nullptr ? steps_.steps : steps_.mToN->nSteps;
+    if (limits.size() != steps) {
+        return Status::SemanticError("`%s', the length of the list must be equal to the steps %u",
+                                     truncate->toString().c_str(),
+                                     steps);
+    }
+    for (auto limit : limits) {
+        if (limit < 0) {
+            return Status::SemanticError("`%s', the limits must not be negative",
+                                         truncate->toString().c_str());
+        }
+        stepLimits_.emplace_back(limit);
+    }
+    sample_ = truncate->isSample();
+    return Status::OK();
+}
+
 Status GoValidator::toPlan() {
     if (steps_.mToN == nullptr) {
         if (steps_.steps == 0) {
@@ -162,6 +185,10 @@ Status GoValidator::oneStep(PlanNode* dependencyForGn,
     gn->setVertexProps(buildSrcVertexProps());
     gn->setEdgeProps(buildEdgeProps());
     gn->setInputVar(inputVarNameForGN);
+    if (!stepLimits_.empty()) {
+        // The last step
+        gn->setVertexLimits({stepLimits_.back()}, sample_);
+    }
     VLOG(1) << gn->outputVar();
 
     PlanNode* dependencyForProjectResult = gn;
@@ -235,6 +262,9 @@ Status GoValidator::buildNStepsPlan() {
     gn->setSrc(from_.src);
     gn->setEdgeProps(buildEdgeDst());
     gn->setInputVar(startVidsVar);
+    if (!stepLimits_.empty()) {
+        gn->setVertexLimits(stepLimits_, sample_, loopSteps_);
+    }
     VLOG(1) << gn->outputVar();
 
     PlanNode* dedupDstVids = projectDstVidsFromGN(gn, startVidsVar);
@@ -295,6 +325,9 @@ Status GoValidator::buildMToNPlan() {
     gn->setVertexProps(buildSrcVertexProps());
     gn->setEdgeProps(buildEdgeProps());
     gn->setInputVar(startVidsVar);
+    if (!stepLimits_.empty()) {
+        gn->setVertexLimits(stepLimits_, sample_, loopSteps_);
+    }
     VLOG(1) << gn->outputVar();
 
     PlanNode* dedupDstVids = projectDstVidsFromGN(gn, startVidsVar);
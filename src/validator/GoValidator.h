@@ -27,6 +27,8 @@ private:
 
     Status validateYield(YieldClause* yield);
 
+    Status validateTruncate(const TruncateClause* truncate);
+
     void extractPropExprs(const Expression* expr);
 
     std::unique_ptr<Expression> rewriteToInputProp(Expression* expr);
@@ -73,6 +75,9 @@ private:
     std::vector<std::string>                                colNames_;
     YieldColumns*                                           yields_{nullptr};
     bool                                                    distinct_{false};
+    // The max edges expanded from each vertex by step
+    std::vector<int64_t>                                    stepLimits_;
+    bool                                                    sample_{false};
 
     // Generated by validator if needed, and the lifecycle of raw pinters would
     // be managed by object pool
@@ -6,6 +6,7 @@
 
 #include "validator/MatchValidator.h"
 
+#include "service/GraphFlags.h"
 #include "util/ExpressionUtils.h"
 #include "visitor/RewriteMatchLabelVisitor.h"
 #include "planner/match/MatchSolver.h"
@@ -39,12 +40,9 @@ Status MatchValidator::validateImpl() {
             case ReadingClause::Kind::kMatch: {
                 auto *matchClause = static_cast<MatchClause *>(clauses[i].get());
 
-                if (matchClause->isOptional()) {
-                    return Status::SemanticError("OPTIONAL MATCH not supported");
-                }
-
                 auto matchClauseCtx = getContext<MatchClauseContext>();
                 matchClauseCtx->aliasesUsed = aliasesUsed;
+                matchClauseCtx->isOptional = matchClause->isOptional();
                 NG_RETURN_IF_ERROR(validatePath(matchClause->path(), *matchClauseCtx));
                 if (matchClause->where() != nullptr) {
                     auto whereClauseCtx = getContext<WhereClauseContext>();
@@ -53,6 +51,9 @@ Status MatchValidator::validateImpl() {
                         validateFilter(matchClause->where()->filter(), *whereClauseCtx));
                     matchClauseCtx->where = std::move(whereClauseCtx);
                 }
+                if (matchClauseCtx->isOptional) {
+                    NG_RETURN_IF_ERROR(validateOptional(*matchClauseCtx));
+                }
 
                 if (aliasesUsed) {
                     NG_RETURN_IF_ERROR(
@@ -139,6 +140,44 @@ Status MatchValidator::validatePath(const MatchPath *path,
     return Status::OK();
 }
 
+// The OPTIONAL MATCH starts from the node bound by the previous clauses, and is left outer
+// joined with them on that node.
+Status MatchValidator::validateOptional(MatchClauseContext &matchClauseCtx) const {
+    auto *aliasesUsed = matchClauseCtx.aliasesUsed;
+    if (aliasesUsed == nullptr) {
+        return Status::SemanticError("OPTIONAL MATCH should follow the other clauses");
+    }
+    if (matchClauseCtx.edgeInfos.empty()) {
+        return Status::SemanticError("OPTIONAL MATCH of a single node not supported");
+    }
+    NodeInfo *bound = nullptr;
+    for (auto &nodeInfo : matchClauseCtx.nodeInfos) {
+        if (nodeInfo.anonymous || nodeInfo.closing) {
+            continue;
+        }
+        auto found = aliasesUsed->find(*nodeInfo.alias);
+        if (found == aliasesUsed->end()) {
+            continue;
+        }
+        if (found->second != AliasType::kNode) {
+            return Status::SemanticError("`%s': Redefined alias", nodeInfo.alias->c_str());
+        }
+        if (bound != nullptr) {
+            return Status::SemanticError(
+                "OPTIONAL MATCH should share only one node with the previous clauses");
+        }
+        bound = &nodeInfo;
+    }
+    if (bound == nullptr) {
+        return Status::SemanticError(
+            "OPTIONAL MATCH should share one node with the previous clauses");
+    }
+    bound->bound = true;
+    // The alias is defined by the previous clauses
+    matchClauseCtx.aliasesGenerated.erase(*bound->alias);
+    return Status::OK();
+}
+
 Status MatchValidator::buildPathExpr(const MatchPath *path,
                                      MatchClauseContext &matchClauseCtx) const {
     auto* pathAlias = path->alias();
@@ -196,7 +235,9 @@ Status MatchValidator::buildNodeInfo(const MatchPath *path,
             anonymous = true;
             alias = saveObject(new std::string(vctx_->anonVarGen()->getVar()));
         }
-        if (!aliases.emplace(*alias, AliasType::kNode).second) {
+        auto closing = i == steps && steps > 0 && !anonymous && !nodeInfos[0].anonymous &&
+                       *alias == *nodeInfos[0].alias;
+        if (!closing && !aliases.emplace(*alias, AliasType::kNode).second) {
             return Status::SemanticError("`%s': Redefined alias", alias->c_str());
         }
         Expression *filter = nullptr;
@@ -217,6 +258,7 @@ Status MatchValidator::buildNodeInfo(const MatchPath *path,
         nodeInfos[i].alias = alias;
         nodeInfos[i].props = props;
         nodeInfos[i].filter = filter;
+        nodeInfos[i].closing = closing;
     }
 
     return Status::OK();
@@ -334,7 +376,8 @@ Status MatchValidator::validateReturn(MatchReturn *ret,
                 if (!matchClauseCtx->edgeInfos[i].anonymous) {
                     columns->addColumn(makeColumn(*matchClauseCtx->edgeInfos[i].alias));
                 }
-                if (!matchClauseCtx->nodeInfos[i+1].anonymous) {
+                if (!matchClauseCtx->nodeInfos[i+1].anonymous &&
+                    !matchClauseCtx->nodeInfos[i+1].closing) {
                     columns->addColumn(makeColumn(*matchClauseCtx->nodeInfos[i+1].alias));
                 }
             }
@@ -441,6 +484,13 @@ Status MatchValidator::validateStepRange(const MatchStepRange *range) const {
         return Status::SemanticError(
             "Cannot set negtive steps minumum hop for variable length relationships");
     }
+    // The paths grow exponentially with the hops, limited only by the edge uniqueness
+    if (FLAGS_max_match_hops > 0 && max > FLAGS_max_match_hops) {
+        return Status::SemanticError(
+            "Max hop %ld is over the limit %ld of variable length relationships",
+            max,
+            FLAGS_max_match_hops);
+    }
     return Status::OK();
 }
 
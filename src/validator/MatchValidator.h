@@ -29,6 +29,8 @@ private:
 
     Status validatePath(const MatchPath *path, MatchClauseContext &matchClauseCtx) const;
 
+    Status validateOptional(MatchClauseContext &matchClauseCtx) const;
+
     Status validateFilter(const Expression *filter, WhereClauseContext &whereClauseCtx) const;
 
     Status validateReturn(MatchReturn *ret,
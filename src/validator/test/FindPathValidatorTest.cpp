@@ -27,6 +27,8 @@ TEST_F(FindPathValidatorTest, SinglePairPath) {
             PK::kLoop,
             PK::kStart,
             PK::kConjunctPath,
+            PK::kSelect,
+            PK::kStart,
             PK::kDedup,
             PK::kDedup,
             PK::kProject,
@@ -35,7 +37,7 @@ TEST_F(FindPathValidatorTest, SinglePairPath) {
             PK::kBFSShortest,
             PK::kGetNeighbors,
             PK::kGetNeighbors,
-            PK::kPassThrough,
+            PK::kStart,
             PK::kStart,
         };
         EXPECT_TRUE(checkResult(query, expected));
@@ -47,6 +49,8 @@ TEST_F(FindPathValidatorTest, SinglePairPath) {
             PK::kLoop,
             PK::kStart,
             PK::kConjunctPath,
+            PK::kSelect,
+            PK::kStart,
             PK::kDedup,
             PK::kDedup,
             PK::kProject,
@@ -55,7 +59,7 @@ TEST_F(FindPathValidatorTest, SinglePairPath) {
             PK::kBFSShortest,
             PK::kGetNeighbors,
             PK::kGetNeighbors,
-            PK::kPassThrough,
+            PK::kStart,
             PK::kStart,
         };
         EXPECT_TRUE(checkResult(query, expected));
@@ -67,6 +71,8 @@ TEST_F(FindPathValidatorTest, SinglePairPath) {
             PK::kLoop,
             PK::kStart,
             PK::kConjunctPath,
+            PK::kSelect,
+            PK::kStart,
             PK::kDedup,
             PK::kDedup,
             PK::kProject,
@@ -75,7 +81,7 @@ TEST_F(FindPathValidatorTest, SinglePairPath) {
             PK::kBFSShortest,
             PK::kGetNeighbors,
             PK::kGetNeighbors,
-            PK::kPassThrough,
+            PK::kStart,
             PK::kStart,
         };
         EXPECT_TRUE(checkResult(query, expected));
@@ -90,13 +96,11 @@ TEST_F(FindPathValidatorTest, MultiPairPath) {
             PK::kLoop,
             PK::kCartesianProduct,
             PK::kConjunctPath,
-            PK::kProject,
+            PK::kStart,
             PK::kDedup,
             PK::kDedup,
             PK::kProject,
             PK::kProject,
-            PK::kProject,
-            PK::kStart,
             PK::kProduceSemiShortestPath,
             PK::kProduceSemiShortestPath,
             PK::kGetNeighbors,
@@ -113,13 +117,11 @@ TEST_F(FindPathValidatorTest, MultiPairPath) {
             PK::kLoop,
             PK::kCartesianProduct,
             PK::kConjunctPath,
-            PK::kProject,
+            PK::kStart,
             PK::kDedup,
             PK::kDedup,
             PK::kProject,
             PK::kProject,
-            PK::kProject,
-            PK::kStart,
             PK::kProduceSemiShortestPath,
             PK::kProduceSemiShortestPath,
             PK::kGetNeighbors,
@@ -137,13 +139,11 @@ TEST_F(FindPathValidatorTest, MultiPairPath) {
             PK::kLoop,
             PK::kCartesianProduct,
             PK::kConjunctPath,
-            PK::kProject,
+            PK::kStart,
             PK::kDedup,
             PK::kDedup,
             PK::kProject,
             PK::kProject,
-            PK::kProject,
-            PK::kStart,
             PK::kProduceSemiShortestPath,
             PK::kProduceSemiShortestPath,
             PK::kGetNeighbors,
@@ -256,7 +256,7 @@ TEST_F(FindPathValidatorTest, RunTimePath) {
             PK::kLoop,
             PK::kCartesianProduct,
             PK::kConjunctPath,
-            PK::kProject,
+            PK::kDedup,
             PK::kDedup,
             PK::kDedup,
             PK::kProject,
@@ -268,13 +268,11 @@ TEST_F(FindPathValidatorTest, RunTimePath) {
             PK::kProject,
             PK::kGetNeighbors,
             PK::kGetNeighbors,
-            PK::kDedup,
-            PK::kPassThrough,
-            PK::kProject,
-            PK::kStart,
             PK::kProject,
+            PK::kPassThrough,
             PK::kGetNeighbors,
             PK::kStart,
+            PK::kStart,
         };
         EXPECT_TRUE(checkResult(query, expected));
     }
@@ -317,22 +315,20 @@ TEST_F(FindPathValidatorTest, RunTimePath) {
             PK::kLoop,
             PK::kCartesianProduct,
             PK::kConjunctPath,
-            PK::kProject,
+            PK::kDedup,
             PK::kDedup,
             PK::kDedup,
             PK::kProject,
             PK::kProject,
             PK::kProject,
-            PK::kDedup,
+            PK::kProject,
             PK::kProduceSemiShortestPath,
             PK::kProduceSemiShortestPath,
-            PK::kProject,
             PK::kGetNeighbors,
             PK::kGetNeighbors,
-            PK::kProject,
-            PK::kPassThrough,
             PK::kGetNeighbors,
             PK::kStart,
+            PK::kPassThrough,
             PK::kStart,
         };
         EXPECT_TRUE(checkResult(query, expected));
@@ -346,22 +342,20 @@ TEST_F(FindPathValidatorTest, RunTimePath) {
             PK::kLoop,
             PK::kCartesianProduct,
             PK::kConjunctPath,
-            PK::kProject,
+            PK::kDedup,
             PK::kDedup,
             PK::kDedup,
             PK::kProject,
             PK::kProject,
             PK::kProject,
-            PK::kDedup,
+            PK::kProject,
             PK::kProduceSemiShortestPath,
             PK::kProduceSemiShortestPath,
-            PK::kProject,
             PK::kGetNeighbors,
             PK::kGetNeighbors,
-            PK::kProject,
-            PK::kPassThrough,
             PK::kGetNeighbors,
             PK::kStart,
+            PK::kPassThrough,
             PK::kStart,
         };
         EXPECT_TRUE(checkResult(query, expected));
@@ -375,7 +369,7 @@ TEST_F(FindPathValidatorTest, RunTimePath) {
             PK::kLoop,
             PK::kCartesianProduct,
             PK::kConjunctPath,
-            PK::kProject,
+            PK::kDedup,
             PK::kDedup,
             PK::kDedup,
             PK::kProject,
@@ -387,13 +381,11 @@ TEST_F(FindPathValidatorTest, RunTimePath) {
             PK::kProject,
             PK::kGetNeighbors,
             PK::kGetNeighbors,
-            PK::kDedup,
-            PK::kPassThrough,
-            PK::kProject,
-            PK::kStart,
             PK::kProject,
+            PK::kPassThrough,
             PK::kGetNeighbors,
             PK::kStart,
+            PK::kStart,
         };
         EXPECT_TRUE(checkResult(query, expected));
     }
@@ -406,7 +398,7 @@ TEST_F(FindPathValidatorTest, RunTimePath) {
             PK::kLoop,
             PK::kCartesianProduct,
             PK::kConjunctPath,
-            PK::kProject,
+            PK::kDedup,
             PK::kDedup,
             PK::kDedup,
             PK::kProject,
@@ -418,12 +410,10 @@ TEST_F(FindPathValidatorTest, RunTimePath) {
             PK::kProject,
             PK::kGetNeighbors,
             PK::kGetNeighbors,
-            PK::kDedup,
-            PK::kPassThrough,
-            PK::kProject,
-            PK::kStart,
             PK::kProject,
+            PK::kPassThrough,
             PK::kGetNeighbors,
+            PK::kStart,
             PK::kProject,
             PK::kGetNeighbors,
             PK::kStart,
@@ -439,7 +429,7 @@ TEST_F(FindPathValidatorTest, RunTimePath) {
             PK::kLoop,
             PK::kCartesianProduct,
             PK::kConjunctPath,
-            PK::kProject,
+            PK::kDedup,
             PK::kDedup,
             PK::kDedup,
             PK::kProject,
@@ -451,11 +441,9 @@ TEST_F(FindPathValidatorTest, RunTimePath) {
             PK::kProject,
             PK::kGetNeighbors,
             PK::kGetNeighbors,
-            PK::kDedup,
-            PK::kPassThrough,
             PK::kProject,
+            PK::kPassThrough,
             PK::kStart,
-            PK::kProject,
             PK::kStart,
         };
         EXPECT_TRUE(checkResult(query, expected));
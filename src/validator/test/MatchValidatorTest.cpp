@@ -6,6 +6,7 @@
 
 #include "validator/MatchValidator.h"
 
+#include "service/GraphFlags.h"
 #include "validator/test/ValidatorTestBase.h"
 
 namespace nebula {
@@ -75,6 +76,56 @@ TEST_F(MatchValidatorTest, SeekByTagIndex) {
     }
 }
 
+TEST_F(MatchValidatorTest, SeekByEdgeIndex) {
+    // edge properties index
+    {
+        std::string query = "MATCH (v1)-[e:like{likeness: 99}]->(v2) RETURN e;";
+        std::vector<PlanNode::Kind> expected = {PlanNode::Kind::kProject,
+                                                PlanNode::Kind::kFilter,
+                                                PlanNode::Kind::kProject,
+                                                PlanNode::Kind::kDataJoin,
+                                                PlanNode::Kind::kProject,
+                                                PlanNode::Kind::kGetVertices,
+                                                PlanNode::Kind::kDedup,
+                                                PlanNode::Kind::kProject,
+                                                PlanNode::Kind::kFilter,
+                                                PlanNode::Kind::kProject,
+                                                PlanNode::Kind::kFilter,
+                                                PlanNode::Kind::kGetNeighbors,
+                                                PlanNode::Kind::kDedup,
+                                                PlanNode::Kind::kProject,
+                                                PlanNode::Kind::kIndexScan,
+                                                PlanNode::Kind::kStart};
+        EXPECT_TRUE(checkResult(query, expected));
+    }
+    // edge properties index in where clause
+    {
+        std::string query = "MATCH (v1)-[e:like]->(v2) WHERE e.likeness > 90 RETURN e;";
+        std::vector<PlanNode::Kind> expected = {PlanNode::Kind::kProject,
+                                                PlanNode::Kind::kFilter,
+                                                PlanNode::Kind::kFilter,
+                                                PlanNode::Kind::kProject,
+                                                PlanNode::Kind::kDataJoin,
+                                                PlanNode::Kind::kProject,
+                                                PlanNode::Kind::kGetVertices,
+                                                PlanNode::Kind::kDedup,
+                                                PlanNode::Kind::kProject,
+                                                PlanNode::Kind::kFilter,
+                                                PlanNode::Kind::kProject,
+                                                PlanNode::Kind::kGetNeighbors,
+                                                PlanNode::Kind::kDedup,
+                                                PlanNode::Kind::kProject,
+                                                PlanNode::Kind::kIndexScan,
+                                                PlanNode::Kind::kStart};
+        EXPECT_TRUE(checkResult(query, expected));
+    }
+    // non index
+    {
+        std::string query = "MATCH (v1)-[e:serve{start: 2000}]->(v2) RETURN e;";
+        EXPECT_FALSE(validate(query));
+    }
+}
+
 TEST_F(MatchValidatorTest, groupby) {
     {
         std::string query = "MATCH(n:person)"
@@ -444,11 +495,11 @@ TEST_F(MatchValidatorTest, groupby) {
                                                 PlanNode::Kind::kFilter,
                                                 PlanNode::Kind::kProject,
                                                 PlanNode::Kind::kDataJoin,
+                                                PlanNode::Kind::kDataJoin,
                                                 PlanNode::Kind::kProject,
                                                 PlanNode::Kind::kGetVertices,
                                                 PlanNode::Kind::kDedup,
                                                 PlanNode::Kind::kProject,
-                                                PlanNode::Kind::kDataJoin,
                                                 PlanNode::Kind::kFilter,
                                                 PlanNode::Kind::kProject,
                                                 PlanNode::Kind::kGetNeighbors,
@@ -466,5 +517,53 @@ TEST_F(MatchValidatorTest, groupby) {
     }
 }
 
+TEST_F(MatchValidatorTest, OptionalMatch) {
+    {
+        std::string query = "MATCH (v:person) "
+                            "OPTIONAL MATCH (v)-[:like]->(b:book) "
+                            "RETURN id(v) AS id, b.name AS book;";
+        EXPECT_TRUE(validate(query));
+    }
+    // not following the other clauses
+    {
+        std::string query = "OPTIONAL MATCH (v:person)-[:like]->(b:book) RETURN b.name AS book;";
+        EXPECT_FALSE(validate(query));
+    }
+    // no node bound by the previous clauses
+    {
+        std::string query = "MATCH (v:person) "
+                            "OPTIONAL MATCH (p:person)-[:like]->(b:book) "
+                            "RETURN b.name AS book;";
+        EXPECT_FALSE(validate(query));
+    }
+    // more than one node bound
+    {
+        std::string query = "MATCH (v:person)-[:like]->(b:book) "
+                            "OPTIONAL MATCH (v)-[:like]->(b) "
+                            "RETURN b.name AS book;";
+        EXPECT_FALSE(validate(query));
+    }
+    // a single node
+    {
+        std::string query = "MATCH (v:person) OPTIONAL MATCH (v) RETURN id(v) AS id;";
+        EXPECT_FALSE(validate(query));
+    }
+}
+
+TEST_F(MatchValidatorTest, MaxHops) {
+    std::string query = "MATCH (v:person)-[e:like*1..100]->(b) RETURN e;";
+    // No limit by default
+    EXPECT_TRUE(validate(query));
+    {
+        gflags::FlagSaver flagSaver;
+        FLAGS_max_match_hops = 32;
+        auto result = checkResult(query);
+        EXPECT_EQ(std::string(result.message()),
+                  "SemanticError: Max hop 100 is over the limit 32 of variable length "
+                  "relationships");
+        EXPECT_TRUE(validate("MATCH (v:person)-[e:like*1..32]->(b) RETURN e;"));
+    }
+}
+
 }   // namespace graph
 }   // namespace nebula
@@ -11,6 +11,8 @@
 // tag index:
 //     person()
 //     book(name(32))
+// edge index:
+//     like(likeness)
 
 namespace nebula {
 namespace graph {
@@ -46,6 +48,25 @@ void MockIndexManager::init() {
         std::make_shared<meta::cpp2::IndexItem>(std::move(person_no_props_index)));
     tagIndexes_[1].emplace_back(
         std::make_shared<meta::cpp2::IndexItem>(std::move(book_name_index)));
+
+    meta::cpp2::IndexItem like_likeness_index;
+    like_likeness_index.set_index_id(235);
+    like_likeness_index.set_index_name("like_likeness_index");
+    meta::cpp2::SchemaID likeSchemaId;
+    likeSchemaId.set_edge_type(3);
+    like_likeness_index.set_schema_id(std::move(likeSchemaId));
+    like_likeness_index.set_schema_name("like");
+    meta::cpp2::ColumnDef likenessField;
+    likenessField.set_name("likeness");
+    meta::cpp2::ColumnTypeDef likenessType;
+    likenessType.set_type(meta::cpp2::PropertyType::INT64);
+    likenessField.set_type(std::move(likenessType));
+    like_likeness_index.set_fields({});
+    like_likeness_index.fields.emplace_back(std::move(likenessField));
+
+    edgeIndexes_.emplace(1, std::vector<std::shared_ptr<meta::cpp2::IndexItem>>{});
+    edgeIndexes_[1].emplace_back(
+        std::make_shared<meta::cpp2::IndexItem>(std::move(like_likeness_index)));
 }
 
 }   // namespace graph
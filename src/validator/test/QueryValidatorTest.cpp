@@ -1313,11 +1313,11 @@ TEST_F(QueryValidatorTest, TestMatch) {
             PK::kFilter,
             PK::kProject,
             PK::kDataJoin,
+            PK::kDataJoin,
             PK::kProject,
             PK::kGetVertices,
             PK::kDedup,
             PK::kProject,
-            PK::kDataJoin,
             PK::kFilter,
             PK::kProject,
             PK::kGetNeighbors,
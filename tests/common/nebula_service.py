@@ -66,6 +66,7 @@ class NebulaService(object):
         if name == 'graphd':
             param += ' --enable_optimizer=true'
             param += ' --enable_authorize=true'
+            param += ' --enable_plan_cache=true'
         if name == 'storaged':
             param += ' --raft_heartbeat_interval_secs=30'
         if debug_log:
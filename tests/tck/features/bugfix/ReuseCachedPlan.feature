@@ -0,0 +1,44 @@
+# Copyright (c) 2021 vesoft inc. All rights reserved.
+#
+# This source code is licensed under Apache 2.0 License,
+# attached with Common Clause Condition 1.0, found in the LICENSES directory.
+Feature: Reuse the cached plan
+
+  Background:
+    Given a graph with space named "nba"
+
+  Scenario: Run the same go sentence twice
+    When executing query:
+      """
+      GO FROM "Tony Parker" OVER like WHERE like.likeness > 90 YIELD like._dst AS dst, like.likeness AS likeness
+      """
+    Then the result should be, in any order:
+      | dst             | likeness |
+      | "Tim Duncan"    | 95       |
+      | "Manu Ginobili" | 95       |
+    When executing query:
+      """
+      GO FROM "Tony Parker" OVER like WHERE like.likeness > 90 YIELD like._dst AS dst, like.likeness AS likeness
+      """
+    Then the result should be, in any order:
+      | dst             | likeness |
+      | "Tim Duncan"    | 95       |
+      | "Manu Ginobili" | 95       |
+
+  Scenario: Run the same match sentence twice
+    When executing query:
+      """
+      MATCH (v:player{name:"Tony Parker"})-[e:like]->(n) WHERE e.likeness > 90 RETURN n.name AS name, e.likeness AS likeness
+      """
+    Then the result should be, in any order:
+      | name            | likeness |
+      | "Tim Duncan"    | 95       |
+      | "Manu Ginobili" | 95       |
+    When executing query:
+      """
+      MATCH (v:player{name:"Tony Parker"})-[e:like]->(n) WHERE e.likeness > 90 RETURN n.name AS name, e.likeness AS likeness
+      """
+    Then the result should be, in any order:
+      | name            | likeness |
+      | "Tim Duncan"    | 95       |
+      | "Manu Ginobili" | 95       |
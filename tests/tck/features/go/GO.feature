@@ -1625,3 +1625,38 @@ Feature: Go Sentence
     Then the result should be, in any order, with relax comparison:
       | like._dst     |
       | "Tony Parker" |
+
+  Scenario: Truncate the edges of each vertex
+    When executing query:
+      """
+      GO FROM "Tony Parker" OVER like YIELD like._dst AS dst LIMIT [2] | YIELD COUNT(*) AS n
+      """
+    Then the result should be, in any order:
+      | n |
+      | 2 |
+    When executing query:
+      """
+      GO FROM "Tony Parker" OVER like YIELD like._dst AS dst SAMPLE [2] | YIELD COUNT(*) AS n
+      """
+    Then the result should be, in any order:
+      | n |
+      | 2 |
+    When executing query:
+      """
+      GO 2 STEPS FROM "Tony Parker" OVER like YIELD like._dst AS dst LIMIT [1, 1] | YIELD COUNT(*) AS n
+      """
+    Then the result should be, in any order:
+      | n |
+      | 1 |
+    When executing query:
+      """
+      GO 1 TO 2 STEPS FROM "Tony Parker" OVER like YIELD like._dst AS dst LIMIT [3, 0] | YIELD COUNT(*) AS n
+      """
+    Then the result should be, in any order:
+      | n |
+      | 3 |
+    When executing query:
+      """
+      GO 2 STEPS FROM "Tony Parker" OVER like LIMIT [1]
+      """
+    Then a SemanticError should be raised at runtime: `LIMIT [1]', the length of the list must be equal to the steps 2
@@ -383,11 +383,6 @@ Feature: Basic match
       MATCH (v:player{age:23}:bachelor) RETURN v
       """
     Then a ExecutionError should be raised at runtime: Can't solve the start vids from the sentence: MATCH (v:player{age:23}:bachelor) RETURN v
-    When executing query:
-      """
-      MATCH () -[r:serve]-> () return *
-      """
-    Then a ExecutionError should be raised at runtime: Can't solve the start vids from the sentence: MATCH ()-[r:serve]->() RETURN *
     When executing query:
       """
       MATCH () -[]-> (v) return *
@@ -0,0 +1,69 @@
+# Copyright (c) 2020 vesoft inc. All rights reserved.
+#
+# This source code is licensed under Apache 2.0 License,
+# attached with Common Clause Condition 1.0, found in the LICENSES directory.
+Feature: Match cycles
+
+  Background:
+    Given a graph with space named "nba"
+
+  Scenario: two edges back to the start
+    When executing query:
+      """
+      MATCH (a)-[:like]->(b)-[:like]->(a)
+      WHERE id(a) == 'Tim Duncan'
+      RETURN id(a) AS a, id(b) AS b
+      """
+    Then the result should be, in any order:
+      | a            | b               |
+      | 'Tim Duncan' | 'Manu Ginobili' |
+      | 'Tim Duncan' | 'Tony Parker'   |
+    When executing query:
+      """
+      MATCH (a:player)-[:like]->(b)-[:like]->(a)
+      RETURN count(*) AS count
+      """
+    Then the result should be, in any order:
+      | count |
+      | 38    |
+
+  Scenario: triangles
+    When executing query:
+      """
+      MATCH (a)-[:like]->(b)-[:like]->(c)-[:like]->(a)
+      WHERE id(a) == 'Tim Duncan'
+      RETURN id(a) AS a, id(b) AS b, id(c) AS c
+      """
+    Then the result should be, in any order:
+      | a            | b             | c                   |
+      | 'Tim Duncan' | 'Tony Parker' | 'LaMarcus Aldridge' |
+      | 'Tim Duncan' | 'Tony Parker' | 'Manu Ginobili'     |
+    When executing query:
+      """
+      MATCH p = (a)-[:like]->(b)-[:like]->(c)-[:like]->(a)
+      WHERE id(a) == 'Tony Parker'
+      RETURN id(b) AS b, id(c) AS c, length(p) AS length
+      """
+    Then the result should be, in any order:
+      | b                   | c            | length |
+      | 'LaMarcus Aldridge' | 'Tim Duncan' | 3      |
+      | 'Manu Ginobili'     | 'Tim Duncan' | 3      |
+    When executing query:
+      """
+      MATCH (a:player)-[:like]->(b)-[:like]->(c)-[:like]->(a)
+      RETURN count(*) AS count
+      """
+    Then the result should be, in any order:
+      | count |
+      | 18    |
+
+  Scenario: variable length cycles
+    When executing query:
+      """
+      MATCH (a)-[:like*2]->(a)
+      WHERE id(a) == 'Tim Duncan'
+      RETURN count(*) AS count
+      """
+    Then the result should be, in any order:
+      | count |
+      | 2     |
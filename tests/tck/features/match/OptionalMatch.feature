@@ -0,0 +1,65 @@
+# Copyright (c) 2020 vesoft inc. All rights reserved.
+#
+# This source code is licensed under Apache 2.0 License,
+# attached with Common Clause Condition 1.0, found in the LICENSES directory.
+Feature: Optional match
+
+  Background:
+    Given a graph with space named "nba"
+
+  Scenario: keep the rows not matched
+    When executing query:
+      """
+      MATCH (a)-[:like]->(b)
+      WHERE id(a) == 'Tony Parker'
+      OPTIONAL MATCH (b)-[:teammate]->(c)
+      RETURN id(b) AS b, count(c) AS teammates
+      """
+    Then the result should be, in any order:
+      | b                   | teammates |
+      | 'Tim Duncan'        | 4         |
+      | 'Manu Ginobili'     | 2         |
+      | 'LaMarcus Aldridge' | 0         |
+    When executing query:
+      """
+      MATCH (a)-[:like]->(b)
+      WHERE id(a) == 'Tony Parker'
+      OPTIONAL MATCH (b)-[:teammate]->(c)
+      WHERE c.name == 'Danny Green'
+      RETURN id(b) AS b, count(c) AS teammates
+      """
+    Then the result should be, in any order:
+      | b                   | teammates |
+      | 'Tim Duncan'        | 1         |
+      | 'Manu Ginobili'     | 0         |
+      | 'LaMarcus Aldridge' | 0         |
+
+  Scenario: the same node bound by several rows
+    When executing query:
+      """
+      MATCH (a)-[:like]->(b)
+      WHERE id(a) IN ['Tony Parker', 'Manu Ginobili']
+      OPTIONAL MATCH (b)-[:teammate]->(c)
+      RETURN id(a) AS a, id(b) AS b, count(c) AS teammates
+      """
+    Then the result should be, in any order:
+      | a               | b                   | teammates |
+      | 'Tony Parker'   | 'Tim Duncan'        | 4         |
+      | 'Tony Parker'   | 'Manu Ginobili'     | 2         |
+      | 'Tony Parker'   | 'LaMarcus Aldridge' | 0         |
+      | 'Manu Ginobili' | 'Tim Duncan'        | 4         |
+
+  Scenario: not bound by the previous clauses
+    When executing query:
+      """
+      OPTIONAL MATCH (a)-[:like]->(b) RETURN b
+      """
+    Then a SemanticError should be raised at runtime: OPTIONAL MATCH should follow the other clauses
+    When executing query:
+      """
+      MATCH (a)-[:like]->(b)
+      WHERE id(a) == 'Tony Parker'
+      OPTIONAL MATCH (c)-[:teammate]->(d)
+      RETURN id(b) AS b
+      """
+    Then a SemanticError should be raised at runtime: OPTIONAL MATCH should share one node with the previous clauses
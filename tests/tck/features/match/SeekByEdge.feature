@@ -0,0 +1,57 @@
+Feature: Match seek by edge
+
+  Background: Prepare space
+    Given a graph with space named "nba"
+
+  Scenario: seek by edge index
+    When executing query:
+      """
+      MATCH (v)-[e:serve]->(t)
+      RETURN count(*) AS count
+      """
+    Then the result should be, in any order:
+      | count |
+      | 152   |
+    And no side effects
+
+  Scenario: seek by edge properties index
+    When executing query:
+      """
+      MATCH (v)-[e:serve{start_year: 2019}]->(t)
+      RETURN id(v) AS player, id(t) AS team, e.end_year AS end_year
+      """
+    Then the result should be, in any order:
+      | player               | team        | end_year |
+      | 'Kristaps Porzingis' | 'Mavericks' | 2020     |
+      | 'Jonathon Simmons'   | '76ers'     | 2019     |
+      | 'DeAndre Jordan'     | 'Knicks'    | 2019     |
+      | 'Paul Gasol'         | 'Bucks'     | 2020     |
+      | 'Marc Gasol'         | 'Raptors'   | 2019     |
+    And no side effects
+    When executing query:
+      """
+      MATCH (t)<-[e:serve]-(v)
+      WHERE e.start_year == 2019
+      RETURN id(t) AS team, id(v) AS player
+      """
+    Then the result should be, in any order:
+      | team        | player               |
+      | 'Mavericks' | 'Kristaps Porzingis' |
+      | '76ers'     | 'Jonathon Simmons'   |
+      | 'Knicks'    | 'DeAndre Jordan'     |
+      | 'Bucks'     | 'Paul Gasol'         |
+      | 'Raptors'   | 'Marc Gasol'         |
+    And no side effects
+
+  Scenario: seek by edge properties index and expand to both sides
+    When executing query:
+      """
+      MATCH (v:player)-[:like]->(p)-[e:serve{start_year: 2019}]->(t)
+      RETURN id(v) AS v, id(p) AS p, id(t) AS t
+      """
+    Then the result should be, in any order:
+      | v             | p                    | t           |
+      | 'Luka Doncic' | 'Kristaps Porzingis' | 'Mavericks' |
+      | 'Paul Gasol'  | 'Marc Gasol'         | 'Raptors'   |
+      | 'Marc Gasol'  | 'Paul Gasol'         | 'Bucks'     |
+    And no side effects
@@ -327,3 +327,14 @@ Feature: Variable length Pattern match (m to n)
       | [[:like "Tim Duncan"<-"LaMarcus Aldridge"], [:like "LaMarcus Aldridge"<-"Tony Parker"]] | [:serve "Tony Parker"->"Spurs"] |
       | [[:like "Tim Duncan"->"Tony Parker"]]                                                   | [:serve "Tony Parker"->"Spurs"] |
       | [[:like "Tim Duncan"<-"Tony Parker"]]                                                   | [:serve "Tony Parker"->"Spurs"] |
+
+  Scenario: start node with properties
+    When executing query:
+      """
+      MATCH (v:player{name: 'Tim Duncan'})-[e:serve*1..2]->()
+      WHERE v.age > 40
+      RETURN DISTINCT v
+      """
+    Then the result should be, in any order:
+      | v                                                                                                           |
+      | ("Tim Duncan" :bachelor{name: "Tim Duncan", speciality: "psychology"} :player{age: 42, name: "Tim Duncan"}) |
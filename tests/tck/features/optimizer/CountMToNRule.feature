@@ -0,0 +1,75 @@
+# Copyright (c) 2021 vesoft inc. All rights reserved.
+#
+# This source code is licensed under Apache 2.0 License,
+# attached with Common Clause Condition 1.0, found in the LICENSES directory.
+Feature: Count M to N rule
+
+  Background:
+    Given a graph with space named "nba"
+
+  Scenario: apply count m to n rule
+    When profiling query:
+      """
+      GO 1 TO 2 STEPS FROM "Tony Parker" OVER like YIELD like._dst AS dst | YIELD COUNT(*)
+      """
+    Then the result should be, in any order:
+      | COUNT(*) |
+      | 8        |
+    And the execution plan should be:
+      | name        | dependencies | operator info      |
+      | DataCollect | 1            | kind: M TO N COUNT |
+      | Loop        | 2            |                    |
+      | Start       |              |                    |
+    When profiling query:
+      """
+      GO 2 TO 3 STEPS FROM "Tony Parker" OVER like YIELD like._dst AS dst | YIELD COUNT(*) AS n
+      """
+    Then the result should be, in any order:
+      | n  |
+      | 11 |
+    And the execution plan should be:
+      | name        | dependencies | operator info      |
+      | DataCollect | 1            | kind: M TO N COUNT |
+      | Loop        | 2            |                    |
+      | Start       |              |                    |
+
+  Scenario: fail to apply count m to n rule
+    When profiling query:
+      """
+      GO 1 TO 2 STEPS FROM "Tony Parker" OVER like YIELD DISTINCT like._dst AS dst | YIELD COUNT(*)
+      """
+    Then the result should be, in any order:
+      | COUNT(*) |
+      | 4        |
+    And the execution plan should be:
+      | name        | dependencies | operator info |
+      | Aggregate   | 1            |               |
+      | DataCollect | 2            |               |
+      | Loop        | 3            |               |
+      | Start       |              |               |
+    When profiling query:
+      """
+      GO 1 TO 2 STEPS FROM "Tony Parker" OVER like YIELD like._dst AS dst | YIELD COUNT($-.dst)
+      """
+    Then the result should be, in any order:
+      | COUNT($-.dst) |
+      | 8             |
+    And the execution plan should be:
+      | name        | dependencies | operator info |
+      | Aggregate   | 1            |               |
+      | DataCollect | 2            |               |
+      | Loop        | 3            |               |
+      | Start       |              |               |
+    When profiling query:
+      """
+      GO 1 TO 2 STEPS FROM "Tony Parker" OVER like YIELD like._dst AS dst | YIELD COUNT(DISTINCT *) AS n
+      """
+    Then the result should be, in any order:
+      | n |
+      | 1 |
+    And the execution plan should be:
+      | name        | dependencies | operator info |
+      | Aggregate   | 1            |               |
+      | DataCollect | 2            |               |
+      | Loop        | 3            |               |
+      | Start       |              |               |